@@ -42,7 +42,7 @@ public:
     ByteBuffer& operator=(ByteBuffer&& other)
     {
         if (this != &other) {
-            if (!m_inline)
+            if (!m_inline && !m_has_external_storage)
                 kfree_sized(m_outline_buffer, m_outline_capacity);
             move_from(move(other));
         }
@@ -52,6 +52,10 @@ public:
     ByteBuffer& operator=(ByteBuffer const& other)
     {
         if (this != &other) {
+            // NOTE: Like a buffer that's moved in, a copy gets storage of its own instead of trying to fit into
+            //       external storage that can't grow.
+            if (m_has_external_storage)
+                clear();
             if (m_size > other.size()) {
                 trim(other.size(), true);
             } else {
@@ -78,6 +82,19 @@ public:
         return { move(buffer) };
     }
 
+    // Creates an empty buffer that grows into `storage` instead of allocating. The buffer never frees or moves
+    // the storage, and can't grow past it; the caller has to keep it alive for as long as the buffer is.
+    // Assigning another buffer to it (by copy or move) makes it stop using the storage.
+    [[nodiscard]] static ByteBuffer create_with_external_storage(Bytes storage)
+    {
+        auto buffer = ByteBuffer();
+        buffer.m_outline_buffer = storage.data();
+        buffer.m_outline_capacity = storage.size();
+        buffer.m_inline = false;
+        buffer.m_has_external_storage = true;
+        return buffer;
+    }
+
     [[nodiscard]] static ErrorOr<ByteBuffer> copy(void const* data, size_t size)
     {
         auto buffer = TRY(create_uninitialized(size));
@@ -173,8 +190,10 @@ public:
     void clear()
     {
         if (!m_inline) {
-            kfree_sized(m_outline_buffer, m_outline_capacity);
+            if (!m_has_external_storage)
+                kfree_sized(m_outline_buffer, m_outline_capacity);
             m_inline = true;
+            m_has_external_storage = false;
         }
         m_size = 0;
     }
@@ -192,7 +211,7 @@ public:
     void trim(size_t size, bool may_discard_existing_data)
     {
         VERIFY(size <= m_size);
-        if (!m_inline && size <= inline_capacity)
+        if (!m_inline && !m_has_external_storage && size <= inline_capacity)
             shrink_into_inline_buffer(size, may_discard_existing_data);
         m_size = size;
     }
@@ -311,6 +330,7 @@ public:
 
     ALWAYS_INLINE size_t capacity() const { return m_inline ? inline_capacity : m_outline_capacity; }
     ALWAYS_INLINE bool is_inline() const { return m_inline; }
+    ALWAYS_INLINE bool has_external_storage() const { return m_has_external_storage; }
 
     struct OutlineBuffer {
         Bytes buffer;
@@ -320,6 +340,7 @@ public:
     {
         if (m_inline)
             return {};
+        VERIFY(!m_has_external_storage);
 
         auto buffer = bytes();
         m_inline = true;
@@ -333,6 +354,7 @@ private:
     {
         m_size = other.m_size;
         m_inline = other.m_inline;
+        m_has_external_storage = other.m_has_external_storage;
         if (!other.m_inline) {
             m_outline_buffer = other.m_outline_buffer;
             m_outline_capacity = other.m_outline_capacity;
@@ -342,6 +364,7 @@ private:
         }
         other.m_size = 0;
         other.m_inline = true;
+        other.m_has_external_storage = false;
     }
 
     NEVER_INLINE void shrink_into_inline_buffer(size_t size, bool may_discard_existing_data)
@@ -357,6 +380,9 @@ private:
 
     NEVER_INLINE ErrorOr<void> try_ensure_capacity_slowpath(size_t new_capacity)
     {
+        if (m_has_external_storage)
+            return Error::from_errno(ENOMEM);
+
         // When we are asked to raise the capacity by very small amounts,
         // the caller is perhaps appending very little data in many calls.
         // To avoid copying the entire ByteBuffer every single time,
@@ -390,6 +416,7 @@ private:
     };
     size_t m_size { 0 };
     bool m_inline { true };
+    bool m_has_external_storage { false };
 };
 
 }
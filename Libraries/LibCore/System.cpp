@@ -141,6 +141,13 @@ ErrorOr<void> munmap(void* address, size_t size)
     return {};
 }
 
+ErrorOr<void> mprotect(void* address, size_t size, int protection)
+{
+    if (::mprotect(address, size, protection) < 0)
+        return Error::from_syscall("mprotect"sv, errno);
+    return {};
+}
+
 ErrorOr<int> anon_create([[maybe_unused]] size_t size, [[maybe_unused]] int options)
 {
     int fd = -1;
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/QuickSort.h>
+#include <LibGC/AllocationSampler.h>
+#include <LibGC/Cell.h>
+
+namespace GC {
+
+AllocationSampler::AllocationSampler(Heap& heap, size_t sampling_interval, AllocationSiteCallback allocation_site)
+    : WeakContainer(heap)
+    , m_sampling_interval(max(sampling_interval, 1uz))
+    , m_bytes_until_next_sample(m_sampling_interval)
+    , m_allocation_site(move(allocation_site))
+{
+}
+
+void AllocationSampler::take_sample(Cell& cell, size_t size)
+{
+    auto estimated_bytes = m_sampling_interval - m_bytes_until_next_sample + size;
+
+    // NOTE: Reset the countdown before calling out to the embedder, in case it allocates something itself.
+    m_bytes_until_next_sample = m_sampling_interval;
+
+    auto location = m_allocation_site ? m_allocation_site() : String {};
+    auto class_name = cell.class_name();
+    auto key = MUST(String::formatted("{}\n{}", class_name, location));
+
+    auto site_index = m_site_indices.ensure(key, [&] {
+        m_sites.append({ class_name, move(location) });
+        return m_sites.size() - 1;
+    });
+
+    m_live_samples.set(&cell, { site_index, estimated_bytes });
+}
+
+void AllocationSampler::remove_dead_cells(Badge<Heap>)
+{
+    m_live_samples.remove_all_matching([](Cell* cell, Sample const&) {
+        return !cell->is_marked();
+    });
+
+    if (m_should_dump_after_each_collection)
+        dump_live_heap();
+}
+
+struct SiteTotals {
+    size_t site_index { 0 };
+    size_t sampled_cells { 0 };
+    size_t estimated_bytes { 0 };
+};
+
+static Vector<SiteTotals> live_totals_by_site(size_t site_count, auto const& live_samples)
+{
+    Vector<SiteTotals> totals;
+    totals.resize(site_count);
+    for (size_t i = 0; i < site_count; ++i)
+        totals[i].site_index = i;
+
+    for (auto const& it : live_samples) {
+        auto& site_totals = totals[it.value.site_index];
+        ++site_totals.sampled_cells;
+        site_totals.estimated_bytes += it.value.estimated_bytes;
+    }
+
+    totals.remove_all_matching([](auto const& site_totals) { return site_totals.sampled_cells == 0; });
+    quick_sort(totals, [](auto const& a, auto const& b) { return a.estimated_bytes > b.estimated_bytes; });
+    return totals;
+}
+
+AK::JsonObject AllocationSampler::live_heap_snapshot() const
+{
+    AK::JsonArray sites;
+    for (auto const& site_totals : live_totals_by_site(m_sites.size(), m_live_samples)) {
+        auto const& site = m_sites[site_totals.site_index];
+        AK::JsonObject site_object;
+        site_object.set("class_name"sv, site.class_name);
+        site_object.set("location"sv, site.location);
+        site_object.set("sampled_cells"sv, site_totals.sampled_cells);
+        site_object.set("estimated_bytes"sv, site_totals.estimated_bytes);
+        sites.must_append(move(site_object));
+    }
+
+    AK::JsonObject snapshot;
+    snapshot.set("sampling_interval"sv, m_sampling_interval);
+    snapshot.set("sampled_cells"sv, m_live_samples.size());
+    snapshot.set("sites"sv, move(sites));
+    return snapshot;
+}
+
+void AllocationSampler::dump_live_heap(size_t max_sites) const
+{
+    auto totals = live_totals_by_site(m_sites.size(), m_live_samples);
+
+    size_t total_estimated_bytes = 0;
+    for (auto const& site_totals : totals)
+        total_estimated_bytes += site_totals.estimated_bytes;
+
+    dbgln("Live heap by allocation site (sampled every {} bytes)", m_sampling_interval);
+    dbgln("=============================================");
+    for (size_t i = 0; i < min(max_sites, totals.size()); ++i) {
+        auto const& site = m_sites[totals[i].site_index];
+        dbgln("{:>12} bytes {:>6} samples  {} @ {}", totals[i].estimated_bytes, totals[i].sampled_cells, site.class_name, site.location.is_empty() ? "<unknown>"sv : site.location.bytes_as_string_view());
+    }
+    dbgln("{:>12} bytes {:>6} samples  total", total_estimated_bytes, m_live_samples.size());
+    dbgln("=============================================");
+}
+
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/HashMap.h>
+#include <AK/String.h>
+#include <AK/Vector.h>
+#include <LibGC/Forward.h>
+#include <LibGC/WeakContainer.h>
+
+namespace GC {
+
+// Records the class and allocation site of roughly one cell per `sampling_interval` allocated bytes, and keeps
+// track of which of those cells are still alive. This gives a statistical breakdown of the live heap by
+// allocation site without having to walk (or annotate) every cell.
+class GC_API AllocationSampler final : public WeakContainer {
+    AK_MAKE_NONCOPYABLE(AllocationSampler);
+    AK_MAKE_NONMOVABLE(AllocationSampler);
+
+public:
+    // Describes where the current allocation is happening, e.g. the source location of the running script.
+    using AllocationSiteCallback = AK::Function<String()>;
+
+    AllocationSampler(Heap&, size_t sampling_interval, AllocationSiteCallback);
+    virtual ~AllocationSampler() override = default;
+
+    size_t sampling_interval() const { return m_sampling_interval; }
+
+    ALWAYS_INLINE void did_allocate(Cell& cell, size_t size)
+    {
+        if (size < m_bytes_until_next_sample) {
+            m_bytes_until_next_sample -= size;
+            return;
+        }
+        take_sample(cell, size);
+    }
+
+    // { "sampling_interval": ..., "sampled_cells": ..., "sites": [{ "class_name", "location", "sampled_cells", "estimated_bytes" }, ...] }
+    // Sites are sorted by their estimated share of the live heap, largest first.
+    AK::JsonObject live_heap_snapshot() const;
+    void dump_live_heap(size_t max_sites = 20) const;
+
+    bool should_dump_after_each_collection() const { return m_should_dump_after_each_collection; }
+    void set_should_dump_after_each_collection(bool b) { m_should_dump_after_each_collection = b; }
+
+    virtual void remove_dead_cells(Badge<Heap>) override;
+
+private:
+    void take_sample(Cell&, size_t size);
+
+    struct Site {
+        StringView class_name;
+        String location;
+    };
+
+    struct Sample {
+        size_t site_index { 0 };
+        // A sampled cell stands in for all the bytes allocated since the previous sample.
+        size_t estimated_bytes { 0 };
+    };
+
+    size_t const m_sampling_interval;
+    size_t m_bytes_until_next_sample { 0 };
+    AllocationSiteCallback m_allocation_site;
+
+    Vector<Site> m_sites;
+    HashMap<String, size_t> m_site_indices;
+    HashMap<Cell*, Sample> m_live_samples;
+
+    bool m_should_dump_after_each_collection { false };
+};
+
+}
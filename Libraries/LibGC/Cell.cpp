@@ -5,10 +5,17 @@
  */
 
 #include <LibGC/Cell.h>
+#include <LibGC/Heap.h>
 #include <LibGC/NanBoxedValue.h>
 
 namespace GC {
 
+void Cell::remember()
+{
+    m_is_remembered = true;
+    heap().remember_cell({}, *this);
+}
+
 void GC::Cell::Visitor::visit(NanBoxedValue const& value)
 {
     if (value.is_cell())
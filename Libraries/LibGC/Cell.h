@@ -37,6 +37,10 @@ public:                                            \
     }                                              \
     friend class GC::Heap;
 
+// Opts cells of exactly this type (not its subclasses) into write barriers, see Cell::write_barrier().
+#define GC_DECLARE_WRITE_BARRIERS(ClassName) \
+    using WriteBarrieredCellType = ClassName
+
 class GC_API Cell {
     AK_MAKE_NONCOPYABLE(Cell);
     AK_MAKE_NONMOVABLE(Cell);
@@ -55,6 +59,21 @@ public:
     State state() const { return m_state; }
     void set_state(State state) { m_state = state; }
 
+    // Cells of types that declare GC_DECLARE_WRITE_BARRIERS() must call this whenever they store a new pointer to
+    // another cell. Written-to cells that are already marked end up in the heap's remembered set, which is all that
+    // young generation collections (and the end of incremental marking) look at to find new edges out of marked cells.
+    ALWAYS_INLINE void write_barrier()
+    {
+        if (m_mark && m_has_write_barriers && !m_is_remembered) [[unlikely]]
+            remember();
+    }
+
+    bool has_write_barriers() const { return m_has_write_barriers; }
+    void enable_write_barriers(Badge<Heap>) { m_has_write_barriers = true; }
+
+    bool is_remembered() const { return m_is_remembered; }
+    void set_remembered(Badge<Heap>, bool remembered) { m_is_remembered = remembered; }
+
     virtual StringView class_name() const = 0;
 
     class GC_API Visitor {
@@ -188,8 +207,12 @@ protected:
     void set_overrides_must_survive_garbage_collection(bool b) { m_overrides_must_survive_garbage_collection = b; }
 
 private:
+    void remember();
+
     bool m_mark { false };
     bool m_overrides_must_survive_garbage_collection { false };
+    bool m_has_write_barriers { false };
+    bool m_is_remembered { false };
     State m_state { State::Live };
 } SWIFT_UNSAFE_REFERENCE;
 
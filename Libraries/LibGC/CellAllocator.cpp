@@ -5,6 +5,7 @@
  */
 
 #include <AK/Badge.h>
+#include <LibCore/ElapsedTimer.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/Heap.h>
@@ -23,6 +24,16 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     if (!m_list_node.is_in_list())
         heap.register_cell_allocator({}, *this);
 
+    if (m_usable_blocks.is_empty() && !m_blocks_to_sweep.is_empty()) {
+        auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        size_t swept_blocks = 0;
+        while (m_usable_blocks.is_empty() && !m_blocks_to_sweep.is_empty()) {
+            (void)sweep_deferred_block(*m_blocks_to_sweep.first());
+            ++swept_blocks;
+        }
+        heap.did_sweep_blocks_lazily({}, swept_blocks, timer.elapsed_time());
+    }
+
     if (m_usable_blocks.is_empty()) {
         auto block = HeapBlock::create_with_cell_size(heap, *this, m_cell_size, m_class_name);
         auto block_ptr = reinterpret_cast<FlatPtr>(block.ptr());
@@ -36,12 +47,21 @@ Cell* CellAllocator::allocate_cell(Heap& heap)
     auto& block = *m_usable_blocks.last();
     auto* cell = block.allocate();
     VERIFY(cell);
+    if (!block.is_in_nursery()) {
+        block.set_in_nursery(true);
+        m_nursery_blocks.append(&block);
+    }
     if (block.is_full())
         m_full_blocks.append(*m_usable_blocks.last());
     return cell;
 }
 
 void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
+{
+    deallocate_block(block);
+}
+
+void CellAllocator::deallocate_block(HeapBlock& block)
 {
     block.m_list_node.remove();
     // NOTE: HeapBlocks are managed by the BlockAllocator, so we don't want to `delete` the block here.
@@ -49,6 +69,50 @@ void CellAllocator::block_did_become_empty(Badge<Heap>, HeapBlock& block)
     m_block_allocator.deallocate_block(&block);
 }
 
+void CellAllocator::add_block_to_nursery(Badge<Heap>, HeapBlock& block)
+{
+    if (block.is_in_nursery())
+        return;
+    block.set_in_nursery(true);
+    m_nursery_blocks.append(&block);
+}
+
+void CellAllocator::clear_nursery(Badge<Heap>)
+{
+    for (auto* block : m_nursery_blocks)
+        block->set_in_nursery(false);
+    m_nursery_blocks.clear_with_capacity();
+}
+
+void CellAllocator::defer_sweeping_of_block(Badge<Heap>, HeapBlock& block)
+{
+    block.m_list_node.remove();
+    m_blocks_to_sweep.append(block);
+}
+
+bool CellAllocator::sweep_deferred_block(HeapBlock& block)
+{
+    block.m_list_node.remove();
+    auto result = block.sweep();
+    if (block.is_full())
+        m_full_blocks.append(block);
+    else
+        m_usable_blocks.append(block);
+    return result.live_cells > 0;
+}
+
+size_t CellAllocator::sweep_deferred_blocks(Badge<Heap>, size_t max_blocks)
+{
+    size_t swept_blocks = 0;
+    while (!m_blocks_to_sweep.is_empty() && swept_blocks < max_blocks) {
+        auto& block = *m_blocks_to_sweep.first();
+        if (!sweep_deferred_block(block))
+            deallocate_block(block);
+        ++swept_blocks;
+    }
+    return swept_blocks;
+}
+
 void CellAllocator::block_did_become_usable(Badge<Heap>, HeapBlock& block)
 {
     VERIFY(!block.is_full());
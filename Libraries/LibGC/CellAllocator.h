@@ -9,6 +9,8 @@
 #include <AK/IntrusiveList.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/NumericLimits.h>
+#include <AK/Vector.h>
 #include <LibGC/BlockAllocator.h>
 #include <LibGC/Forward.h>
 #include <LibGC/HeapBlock.h>
@@ -41,12 +43,36 @@ public:
             if (callback(block) == IterationDecision::Break)
                 return IterationDecision::Break;
         }
+        for (auto& block : m_blocks_to_sweep) {
+            if (callback(block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
+        return IterationDecision::Continue;
+    }
+
+    template<typename Callback>
+    IterationDecision for_each_nursery_block(Callback callback)
+    {
+        for (auto* block : m_nursery_blocks) {
+            if (callback(*block) == IterationDecision::Break)
+                return IterationDecision::Break;
+        }
         return IterationDecision::Continue;
     }
 
     void block_did_become_empty(Badge<Heap>, HeapBlock&);
     void block_did_become_usable(Badge<Heap>, HeapBlock&);
 
+    void add_block_to_nursery(Badge<Heap>, HeapBlock&);
+    void clear_nursery(Badge<Heap>);
+
+    // Leaves `block` to be swept lazily, either when we need somewhere to allocate or by sweep_deferred_blocks().
+    void defer_sweeping_of_block(Badge<Heap>, HeapBlock&);
+
+    // Sweeps (up to `max_blocks`) blocks whose sweeping was deferred, and gives back the blocks that turned out to be empty.
+    // Returns the number of blocks swept.
+    size_t sweep_deferred_blocks(Badge<Heap>, size_t max_blocks = NumericLimits<size_t>::max());
+
     IntrusiveListNode<CellAllocator> m_list_node;
     using List = IntrusiveList<&CellAllocator::m_list_node>;
 
@@ -55,6 +81,10 @@ public:
     FlatPtr max_block_address() const { return m_max_block_address; }
 
 private:
+    // Returns whether the block has any live cells left.
+    bool sweep_deferred_block(HeapBlock&);
+    void deallocate_block(HeapBlock&);
+
     char const* const m_class_name { nullptr };
     size_t const m_cell_size;
 
@@ -63,6 +93,10 @@ private:
     using BlockList = IntrusiveList<&HeapBlock::m_list_node>;
     BlockList m_full_blocks;
     BlockList m_usable_blocks;
+    BlockList m_blocks_to_sweep;
+
+    // Blocks that cells have been allocated in since the last garbage collection.
+    Vector<HeapBlock*> m_nursery_blocks;
     FlatPtr m_min_block_address { explode_byte(0xff) };
     FlatPtr m_max_block_address { 0 };
 };
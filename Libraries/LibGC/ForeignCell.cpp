@@ -41,6 +41,7 @@ Ref<ForeignCell> ForeignCell::create(Heap& heap, size_t size, ForeignCell::Vtabl
     auto& allocator = heap.allocator_for_size(sizeof(ForeignCell) + round_up_to_power_of_two(size, vtable.alignment));
     auto* memory = allocator.allocate_cell(heap);
     auto* foreign_cell = new (memory) ForeignCell(move(vtable));
+    HeapBlock::from_cell(foreign_cell)->set_has_cells_without_write_barriers();
     return *foreign_cell;
 }
 
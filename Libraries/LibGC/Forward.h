@@ -11,6 +11,7 @@
 
 namespace GC {
 
+class AllocationSampler;
 class Cell;
 class CellAllocator;
 class DeferGC;
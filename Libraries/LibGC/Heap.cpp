@@ -49,6 +49,16 @@ Heap::~Heap()
     collect_garbage(CollectionType::CollectEverything);
 }
 
+void Heap::start_allocation_sampling(size_t sampling_interval, AllocationSampler::AllocationSiteCallback allocation_site)
+{
+    m_allocation_sampler = make<AllocationSampler>(*this, sampling_interval, move(allocation_site));
+}
+
+void Heap::stop_allocation_sampling()
+{
+    m_allocation_sampler = nullptr;
+}
+
 void Heap::will_allocate(size_t size)
 {
     if (should_collect_on_every_allocation()) {
@@ -56,7 +66,7 @@ void Heap::will_allocate(size_t size)
         collect_garbage();
     } else if (m_allocated_bytes_since_last_gc + size > m_gc_bytes_threshold) {
         m_allocated_bytes_since_last_gc = 0;
-        collect_garbage();
+        collect_garbage(CollectionType::CollectYoungGeneration);
     }
 
     m_allocated_bytes_since_last_gc += size;
@@ -232,6 +242,7 @@ private:
 
 AK::JsonObject Heap::dump_graph()
 {
+    finish_lazy_sweeping();
     HashMap<Cell*, HeapRoot> roots;
     gather_roots(roots);
     GraphConstructorVisitor visitor(*this, roots);
@@ -243,25 +254,53 @@ void Heap::collect_garbage(CollectionType collection_type, bool print_report)
 {
     VERIFY(!m_collecting_garbage);
 
+    // If a full collection is already being marked incrementally, finish that one instead of starting over.
+    if (m_incremental_marking_visitor) {
+        if (collection_type == CollectionType::CollectEverything)
+            m_incremental_marking_visitor = nullptr;
+        else
+            collection_type = CollectionType::CollectGarbage;
+    }
+
+    // Once enough has been promoted into the old generation, it's time to look for garbage there as well.
+    if (collection_type == CollectionType::CollectYoungGeneration && m_promoted_bytes_since_last_full_gc > m_gc_bytes_threshold)
+        collection_type = CollectionType::CollectGarbage;
+
     {
         TemporaryChange change(m_collecting_garbage, true);
 
-        Core::ElapsedTimer collection_measurement_timer;
-        if (print_report)
-            collection_measurement_timer.start();
-
-        if (collection_type == CollectionType::CollectGarbage) {
+        if (collection_type != CollectionType::CollectEverything) {
             if (m_gc_deferrals) {
                 m_should_gc_when_deferral_ends = true;
                 return;
             }
+        }
+
+        // NOTE: Unswept blocks still contain dead cells in the Live state, so they have to go before we start looking for live ones.
+        finish_lazy_sweeping();
+
+        Core::ElapsedTimer collection_measurement_timer;
+        if (print_report)
+            collection_measurement_timer.start();
+
+        // NOTE: Mark bits are sticky: cells that survive a collection stay marked, which is what makes them
+        //       part of the old generation. A young generation collection keeps them that way, everything
+        //       else starts over from scratch.
+        if (collection_type != CollectionType::CollectYoungGeneration && !m_incremental_marking_visitor)
+            unmark_all_cells();
+
+        size_t marked_cell_bytes = 0;
+        if (collection_type != CollectionType::CollectEverything) {
             HashMap<Cell*, HeapRoot> roots;
             gather_roots(roots);
-            mark_live_cells(roots);
+            marked_cell_bytes = mark_live_cells(roots, collection_type);
         }
-        finalize_unmarked_cells();
+        forget_remembered_cells();
+        auto marking_time = print_report ? collection_measurement_timer.elapsed_time() : AK::Duration {};
+
+        finalize_unmarked_cells(collection_type);
         sweep_weak_blocks();
-        sweep_dead_cells(print_report, collection_measurement_timer);
+        sweep_dead_cells(collection_type, marked_cell_bytes, print_report, collection_measurement_timer, marking_time);
     }
 
     auto tasks = move(m_post_gc_tasks);
@@ -389,6 +428,7 @@ public:
         dbgln_if(HEAP_DEBUG, "  ! {}", &cell);
 
         cell.set_marked(true);
+        m_marked_cell_bytes += HeapBlock::from_cell(&cell)->cell_size();
         m_work_queue.append(cell);
     }
 
@@ -406,6 +446,7 @@ public:
             if (cell->state() != Cell::State::Live)
                 return;
             cell->set_marked(true);
+            m_marked_cell_bytes += HeapBlock::from_cell(cell)->cell_size();
             m_work_queue.append(*cell);
         });
     }
@@ -417,26 +458,89 @@ public:
         }
     }
 
+    // Marks until there is nothing left to mark or `budget` has been spent. Returns true if marking is done.
+    bool mark_live_cells(AK::Duration budget)
+    {
+        // NOTE: Checking the time is not free, so only do it every so often.
+        static constexpr size_t cells_between_deadline_checks = 256;
+
+        auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+        size_t cells_visited = 0;
+        while (!m_work_queue.is_empty()) {
+            m_work_queue.take_last()->visit_edges(*this);
+            if (++cells_visited % cells_between_deadline_checks == 0 && timer.elapsed_time() >= budget)
+                break;
+        }
+        return m_work_queue.is_empty();
+    }
+
+    size_t marked_cell_bytes() const { return m_marked_cell_bytes; }
+
 private:
     Heap& m_heap;
+    size_t m_marked_cell_bytes { 0 };
     Vector<Ref<Cell>> m_work_queue;
     HashTable<HeapBlock*> m_all_live_heap_blocks;
     FlatPtr m_min_block_address;
     FlatPtr m_max_block_address;
 };
 
-void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
+void Heap::unmark_all_cells()
+{
+    for_each_block([&](auto& block) {
+        block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
+            cell->set_marked(false);
+        });
+        return IterationDecision::Continue;
+    });
+}
+
+size_t Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots, CollectionType collection_type)
 {
     dbgln_if(HEAP_DEBUG, "mark_live_cells:");
 
     MarkingVisitor visitor(*this, roots);
 
+    size_t marked_cell_bytes = 0;
+    bool is_finishing_incremental_marking = false;
+    if (m_incremental_marking_visitor) {
+        VERIFY(collection_type == CollectionType::CollectGarbage);
+        m_incremental_marking_visitor->mark_all_live_cells();
+        marked_cell_bytes += m_incremental_marking_visitor->marked_cell_bytes();
+        m_incremental_marking_visitor = nullptr;
+        is_finishing_incremental_marking = true;
+    }
+
+    if (collection_type == CollectionType::CollectYoungGeneration || is_finishing_incremental_marking) {
+        // NOTE: Marked cells may have been made to point at unmarked ones since the last collection (or, when finishing
+        //       incremental marking, since they were marked). Their edges are visited so that those unmarked cells get
+        //       marked, but marked cells are not traced any further. Cells with write barriers tell us when that may
+        //       have happened by ending up in the remembered set. Any other marked cell has to be rescanned, but we only
+        //       have to look for those in blocks that such cells have been allocated in.
+        for (auto* cell : m_remembered_cells)
+            cell->visit_edges(visitor);
+        for_each_block([&](auto& block) {
+            if (!block.has_cells_without_write_barriers())
+                return IterationDecision::Continue;
+            block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+                if (cell->is_marked() && !cell->has_write_barriers())
+                    cell->visit_edges(visitor);
+            });
+            return IterationDecision::Continue;
+        });
+    }
+
     visitor.mark_all_live_cells();
+    marked_cell_bytes += visitor.marked_cell_bytes();
 
-    for (auto& inverse_root : m_uprooted_cells)
+    for (auto& inverse_root : m_uprooted_cells) {
         inverse_root->set_marked(false);
+        // NOTE: Uprooted cells may well be old, so make sure their blocks get swept.
+        auto& block = *HeapBlock::from_cell(inverse_root);
+        block.cell_allocator().add_block_to_nursery({}, block);
+    }
 
-    for_each_block([&](auto& block) {
+    for_each_block_to_sweep(collection_type, [&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
             if (!cell->is_marked() && cell_must_survive_garbage_collection(*cell))
                 cell->visit_edges(visitor);
@@ -445,6 +549,57 @@ void Heap::mark_live_cells(HashMap<Cell*, HeapRoot> const& roots)
     });
 
     m_uprooted_cells.clear();
+
+    return marked_cell_bytes;
+}
+
+void Heap::perform_incremental_collection_slice()
+{
+    if (m_collecting_garbage || m_gc_deferrals)
+        return;
+
+    if (!m_incremental_marking_visitor && sweep_lazily_for(m_incremental_marking_slice_budget))
+        return;
+
+    if (!m_incremental_marking_visitor) {
+        // Start marking once the old generation is halfway to needing a full collection, so that the
+        // collection can hopefully be done in idle time before an allocation would have to do it.
+        if (m_promoted_bytes_since_last_full_gc < m_gc_bytes_threshold / 2)
+            return;
+        start_incremental_marking();
+    }
+
+    bool is_done_marking = false;
+    {
+        TemporaryChange change(m_collecting_garbage, true);
+        is_done_marking = m_incremental_marking_visitor->mark_live_cells(m_incremental_marking_slice_budget);
+    }
+
+    if (is_done_marking) {
+        m_allocated_bytes_since_last_gc = 0;
+        collect_garbage();
+    }
+}
+
+void Heap::start_incremental_marking()
+{
+    VERIFY(!m_incremental_marking_visitor);
+    dbgln_if(HEAP_DEBUG, "start_incremental_marking:");
+
+    TemporaryChange change(m_collecting_garbage, true);
+    finish_lazy_sweeping();
+    unmark_all_cells();
+    forget_remembered_cells();
+    HashMap<Cell*, HeapRoot> roots;
+    gather_roots(roots);
+    m_incremental_marking_visitor = make<MarkingVisitor>(*this, roots);
+}
+
+void Heap::forget_remembered_cells()
+{
+    for (auto* cell : m_remembered_cells)
+        cell->set_remembered({}, false);
+    m_remembered_cells.clear();
 }
 
 bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
@@ -454,9 +609,9 @@ bool Heap::cell_must_survive_garbage_collection(Cell const& cell)
     return cell.must_survive_garbage_collection();
 }
 
-void Heap::finalize_unmarked_cells()
+void Heap::finalize_unmarked_cells(CollectionType collection_type)
 {
-    for_each_block([&](auto& block) {
+    for_each_block_to_sweep(collection_type, [&](auto& block) {
         block.template for_each_cell_in_state<Cell::State::Live>([](Cell* cell) {
             if (!cell->is_marked())
                 cell->finalize();
@@ -481,34 +636,34 @@ void Heap::sweep_weak_blocks()
     }
 }
 
-void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measurement_timer)
+void Heap::sweep_dead_cells(CollectionType collection_type, size_t marked_cell_bytes, bool print_report, Core::ElapsedTimer const& measurement_timer, AK::Duration marking_time)
 {
     dbgln_if(HEAP_DEBUG, "sweep_dead_cells:");
     Vector<HeapBlock*, 32> empty_blocks;
     Vector<HeapBlock*, 32> full_blocks_that_became_usable;
+    Vector<HeapBlock*, 32> blocks_to_sweep_lazily;
 
     size_t collected_cells = 0;
     size_t live_cells = 0;
     size_t collected_cell_bytes = 0;
     size_t live_cell_bytes = 0;
 
-    for_each_block([&](auto& block) {
-        bool block_has_live_cells = false;
+    // OPTIMIZATION: After a full collection, blocks are swept lazily, when their allocator next needs somewhere to
+    //               allocate (or at the start of the next collection), so that we don't run all the destructors now.
+    bool const should_sweep_lazily = collection_type == CollectionType::CollectGarbage;
+
+    for_each_block_to_sweep(collection_type, [&](auto& block) {
+        if (should_sweep_lazily) {
+            blocks_to_sweep_lazily.append(&block);
+            return IterationDecision::Continue;
+        }
         bool block_was_full = block.is_full();
-        block.template for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
-            if (!cell->is_marked()) {
-                dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
-                block.deallocate(cell);
-                ++collected_cells;
-                collected_cell_bytes += block.cell_size();
-            } else {
-                cell->set_marked(false);
-                block_has_live_cells = true;
-                ++live_cells;
-                live_cell_bytes += block.cell_size();
-            }
-        });
-        if (!block_has_live_cells)
+        auto result = block.sweep();
+        collected_cells += result.collected_cells;
+        collected_cell_bytes += result.collected_cells * block.cell_size();
+        live_cells += result.live_cells;
+        live_cell_bytes += result.live_cells * block.cell_size();
+        if (result.live_cells == 0)
             empty_blocks.append(&block);
         else if (block_was_full != block.is_full())
             full_blocks_that_became_usable.append(&block);
@@ -518,6 +673,10 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
     for (auto& weak_container : m_weak_containers)
         weak_container.remove_dead_cells({});
 
+    // NOTE: This must happen before empty blocks are given back to the block allocator below.
+    for (auto& allocator : m_all_cell_allocators)
+        allocator.clear_nursery({});
+
     for (auto* block : empty_blocks) {
         dbgln_if(HEAP_DEBUG, " - HeapBlock empty @ {}: cell_size={}", block, block->cell_size());
         block->cell_allocator().block_did_become_empty({}, *block);
@@ -528,6 +687,10 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         block->cell_allocator().block_did_become_usable({}, *block);
     }
 
+    for (auto* block : blocks_to_sweep_lazily)
+        block->cell_allocator().defer_sweeping_of_block({}, *block);
+    m_blocks_left_to_sweep_lazily = blocks_to_sweep_lazily.size();
+
     if constexpr (HEAP_DEBUG) {
         for_each_block([&](auto& block) {
             dbgln(" > Live HeapBlock @ {}: cell_size={}", &block, block.cell_size());
@@ -535,7 +698,12 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
         });
     }
 
-    m_gc_bytes_threshold = live_cell_bytes > GC_MIN_BYTES_THRESHOLD ? live_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+    if (collection_type != CollectionType::CollectYoungGeneration) {
+        m_gc_bytes_threshold = marked_cell_bytes > GC_MIN_BYTES_THRESHOLD ? marked_cell_bytes : GC_MIN_BYTES_THRESHOLD;
+        m_promoted_bytes_since_last_full_gc = 0;
+    } else {
+        m_promoted_bytes_since_last_full_gc += marked_cell_bytes;
+    }
 
     if (print_report) {
         AK::Duration const time_spent = measurement_timer.elapsed_time();
@@ -547,13 +715,64 @@ void Heap::sweep_dead_cells(bool print_report, Core::ElapsedTimer const& measure
 
         dbgln("Garbage collection report");
         dbgln("=============================================");
+        dbgln("     Collection: {}", collection_type == CollectionType::CollectYoungGeneration ? "young generation"sv : "full"sv);
         dbgln("     Time spent: {} ms", time_spent.to_milliseconds());
+        dbgln("        Marking: {} ms", marking_time.to_milliseconds());
+        dbgln("       Sweeping: {} ms ({} blocks left to sweep lazily)", (time_spent - marking_time).to_milliseconds(), blocks_to_sweep_lazily.size());
+        dbgln("  Lazy sweeping: {} ms ({} blocks) since the previous collection", m_lazy_sweeping_time_since_last_gc.to_milliseconds(), m_lazily_swept_blocks_since_last_gc);
+        dbgln("   Marked cells: {} bytes", marked_cell_bytes);
         dbgln("     Live cells: {} ({} bytes)", live_cells, live_cell_bytes);
         dbgln("Collected cells: {} ({} bytes)", collected_cells, collected_cell_bytes);
         dbgln("    Live blocks: {} ({} bytes)", live_block_count, live_block_count * HeapBlock::block_size);
         dbgln("   Freed blocks: {} ({} bytes)", empty_blocks.size(), empty_blocks.size() * HeapBlock::block_size);
         dbgln("=============================================");
+
+        if (m_allocation_sampler && !m_allocation_sampler->should_dump_after_each_collection())
+            m_allocation_sampler->dump_live_heap();
     }
+
+    m_lazily_swept_blocks_since_last_gc = 0;
+    m_lazy_sweeping_time_since_last_gc = {};
+}
+
+void Heap::finish_lazy_sweeping()
+{
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    size_t swept_blocks = 0;
+    for (auto& allocator : m_all_cell_allocators)
+        swept_blocks += allocator.sweep_deferred_blocks({});
+    m_blocks_left_to_sweep_lazily = 0;
+    if (swept_blocks == 0)
+        return;
+    m_lazily_swept_blocks_since_last_gc += swept_blocks;
+    m_lazy_sweeping_time_since_last_gc += timer.elapsed_time();
+}
+
+// Returns false if there was nothing left to sweep.
+bool Heap::sweep_lazily_for(AK::Duration budget)
+{
+    static constexpr size_t blocks_between_deadline_checks = 16;
+
+    auto timer = Core::ElapsedTimer::start_new(Core::TimerType::Precise);
+    size_t swept_blocks = 0;
+    for (auto& allocator : m_all_cell_allocators) {
+        while (true) {
+            auto swept_blocks_in_allocator = allocator.sweep_deferred_blocks({}, blocks_between_deadline_checks);
+            if (swept_blocks_in_allocator == 0)
+                break;
+            swept_blocks += swept_blocks_in_allocator;
+            if (timer.elapsed_time() >= budget)
+                break;
+        }
+        if (timer.elapsed_time() >= budget)
+            break;
+    }
+    if (swept_blocks == 0)
+        return false;
+    m_blocks_left_to_sweep_lazily -= min(swept_blocks, m_blocks_left_to_sweep_lazily);
+    m_lazily_swept_blocks_since_last_gc += swept_blocks;
+    m_lazy_sweeping_time_since_last_gc += timer.elapsed_time();
+    return true;
 }
 
 void Heap::defer_gc()
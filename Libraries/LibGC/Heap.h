@@ -11,11 +11,14 @@
 #include <AK/IntrusiveList.h>
 #include <AK/Noncopyable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/Swift.h>
+#include <AK/Time.h>
 #include <AK/Types.h>
 #include <AK/Vector.h>
 #include <LibCore/Forward.h>
+#include <LibGC/AllocationSampler.h>
 #include <LibGC/Cell.h>
 #include <LibGC/CellAllocator.h>
 #include <LibGC/ConservativeVector.h>
@@ -30,6 +33,8 @@
 
 namespace GC {
 
+class MarkingVisitor;
+
 class GC_API Heap : public HeapBase {
     AK_MAKE_NONCOPYABLE(Heap);
     AK_MAKE_NONMOVABLE(Heap);
@@ -45,17 +50,39 @@ public:
         defer_gc();
         new (memory) T(forward<Args>(args)...);
         undefer_gc();
+        if constexpr (has_write_barriers<T>())
+            memory->enable_write_barriers({});
+        else
+            HeapBlock::from_cell(memory)->set_has_cells_without_write_barriers();
+        if (m_allocation_sampler) [[unlikely]]
+            m_allocation_sampler->did_allocate(*static_cast<T*>(memory), sizeof(T));
         return *static_cast<T*>(memory);
     }
 
     enum class CollectionType {
         CollectGarbage,
+        CollectYoungGeneration,
         CollectEverything,
     };
 
     void collect_garbage(CollectionType = CollectionType::CollectGarbage, bool print_report = false);
+
+    // Performs a bounded amount of work towards the next full collection: sweeps blocks left over by the
+    // previous one, starts marking if it's about time, marks for at most the configured slice budget, and
+    // finishes the collection once marking is done. Embedders should call this when they are idle.
+    void perform_incremental_collection_slice();
+    bool is_incremental_marking_in_progress() const { return m_incremental_marking_visitor; }
+    bool has_incremental_collection_work() const { return is_incremental_marking_in_progress() || m_blocks_left_to_sweep_lazily > 0; }
+
+    AK::Duration incremental_marking_slice_budget() const { return m_incremental_marking_slice_budget; }
+    void set_incremental_marking_slice_budget(AK::Duration budget) { m_incremental_marking_slice_budget = budget; }
     AK::JsonObject dump_graph();
 
+    // Samples roughly one allocation per `sampling_interval` bytes, see AllocationSampler.
+    void start_allocation_sampling(size_t sampling_interval, AllocationSampler::AllocationSiteCallback);
+    void stop_allocation_sampling();
+    AllocationSampler* allocation_sampler() { return m_allocation_sampler.ptr(); }
+
     bool should_collect_on_every_allocation() const { return m_should_collect_on_every_allocation; }
     void set_should_collect_on_every_allocation(bool b) { m_should_collect_on_every_allocation = b; }
 
@@ -75,9 +102,12 @@ public:
     void did_destroy_weak_container(Badge<WeakContainer>, WeakContainer&);
 
     void register_cell_allocator(Badge<CellAllocator>, CellAllocator&);
+    void did_sweep_blocks_lazily(Badge<CellAllocator>, size_t block_count, AK::Duration);
 
     void uproot_cell(Cell* cell);
 
+    void remember_cell(Badge<Cell>, Cell& cell) { m_remembered_cells.append(&cell); }
+
     bool is_gc_deferred() const { return m_gc_deferrals > 0; }
 
     void enqueue_post_gc_task(AK::Function<void()>);
@@ -95,6 +125,14 @@ private:
 
     static bool cell_must_survive_garbage_collection(Cell const&);
 
+    template<typename T>
+    static constexpr bool has_write_barriers()
+    {
+        if constexpr (requires { typename T::WriteBarrieredCellType; })
+            return IsSame<T, typename T::WriteBarrieredCellType>;
+        return false;
+    }
+
     template<typename T>
     Cell* allocate_cell()
     {
@@ -113,9 +151,14 @@ private:
     void gather_roots(HashMap<Cell*, HeapRoot>&);
     void gather_conservative_roots(HashMap<Cell*, HeapRoot>&);
     void gather_asan_fake_stack_roots(HashMap<FlatPtr, HeapRoot>&, FlatPtr, FlatPtr min_block_address, FlatPtr max_block_address);
-    void mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells);
-    void finalize_unmarked_cells();
-    void sweep_dead_cells(bool print_report, Core::ElapsedTimer const&);
+    void unmark_all_cells();
+    void start_incremental_marking();
+    void forget_remembered_cells();
+    size_t mark_live_cells(HashMap<Cell*, HeapRoot> const& live_cells, CollectionType);
+    void finalize_unmarked_cells(CollectionType);
+    void sweep_dead_cells(CollectionType, size_t marked_cell_bytes, bool print_report, Core::ElapsedTimer const&, AK::Duration marking_time);
+    void finish_lazy_sweeping();
+    bool sweep_lazily_for(AK::Duration budget);
     void sweep_weak_blocks();
 
     ALWAYS_INLINE CellAllocator& allocator_for_size(size_t cell_size)
@@ -138,10 +181,41 @@ private:
         }
     }
 
+    template<typename Callback>
+    void for_each_nursery_block(Callback callback)
+    {
+        for (auto& allocator : m_all_cell_allocators) {
+            if (allocator.for_each_nursery_block(callback) == IterationDecision::Break)
+                return;
+        }
+    }
+
+    // Young generation collections only finalize and sweep nursery blocks, full collections look at every block.
+    template<typename Callback>
+    void for_each_block_to_sweep(CollectionType collection_type, Callback callback)
+    {
+        if (collection_type == CollectionType::CollectYoungGeneration)
+            for_each_nursery_block(callback);
+        else
+            for_each_block(callback);
+    }
+
     static constexpr size_t GC_MIN_BYTES_THRESHOLD { 4 * 1024 * 1024 };
     size_t m_gc_bytes_threshold { GC_MIN_BYTES_THRESHOLD };
     size_t m_allocated_bytes_since_last_gc { 0 };
 
+    // Bytes that survived young generation collections (and thus joined the old generation) since the last full collection.
+    size_t m_promoted_bytes_since_last_full_gc { 0 };
+
+    // Marking state of a full collection that is being performed in slices, see perform_incremental_collection_slice().
+    OwnPtr<MarkingVisitor> m_incremental_marking_visitor;
+    AK::Duration m_incremental_marking_slice_budget { AK::Duration::from_milliseconds(2) };
+
+    // Full collections leave dead cells to be swept lazily, these keep track of that work for the GC report.
+    size_t m_blocks_left_to_sweep_lazily { 0 };
+    size_t m_lazily_swept_blocks_since_last_gc { 0 };
+    AK::Duration m_lazy_sweeping_time_since_last_gc;
+
     bool m_should_collect_on_every_allocation { false };
 
     Vector<NonnullOwnPtr<CellAllocator>> m_size_based_cell_allocators;
@@ -155,6 +229,9 @@ private:
 
     Vector<Ptr<Cell>> m_uprooted_cells;
 
+    // Marked cells with write barriers that have been written to since the last collection, see Cell::write_barrier().
+    Vector<Cell*> m_remembered_cells;
+
     size_t m_gc_deferrals { 0 };
     bool m_should_gc_when_deferral_ends { false };
 
@@ -166,6 +243,9 @@ private:
 
     WeakBlock::List m_usable_weak_blocks;
     WeakBlock::List m_full_weak_blocks;
+
+    // NOTE: This is a WeakContainer, so it must be destroyed before m_weak_containers is.
+    OwnPtr<AllocationSampler> m_allocation_sampler;
 } SWIFT_IMMORTAL_REFERENCE;
 
 inline void Heap::did_create_root(Badge<RootImpl>, RootImpl& impl)
@@ -233,4 +313,11 @@ inline void Heap::register_cell_allocator(Badge<CellAllocator>, CellAllocator& a
     m_all_cell_allocators.append(allocator);
 }
 
+inline void Heap::did_sweep_blocks_lazily(Badge<CellAllocator>, size_t block_count, AK::Duration time_spent)
+{
+    m_blocks_left_to_sweep_lazily -= min(block_count, m_blocks_left_to_sweep_lazily);
+    m_lazily_swept_blocks_since_last_gc += block_count;
+    m_lazy_sweeping_time_since_last_gc += time_spent;
+}
+
 }
@@ -5,6 +5,7 @@
  */
 
 #include <AK/Assertions.h>
+#include <AK/Debug.h>
 #include <AK/NonnullOwnPtr.h>
 #include <AK/Platform.h>
 #include <LibGC/Heap.h>
@@ -37,6 +38,21 @@ HeapBlock::HeapBlock(Heap& heap, CellAllocator& cell_allocator, size_t cell_size
     ASAN_POISON_MEMORY_REGION(m_storage, block_size - sizeof(HeapBlock));
 }
 
+HeapBlock::SweepResult HeapBlock::sweep()
+{
+    SweepResult result;
+    for_each_cell_in_state<Cell::State::Live>([&](Cell* cell) {
+        if (!cell->is_marked()) {
+            dbgln_if(HEAP_DEBUG, "  ~ {}", cell);
+            deallocate(cell);
+            ++result.collected_cells;
+        } else {
+            ++result.live_cells;
+        }
+    });
+    return result;
+}
+
 void HeapBlock::deallocate(Cell* cell)
 {
     VERIFY(is_valid_cell_pointer(cell));
@@ -50,6 +50,14 @@ public:
 
     void deallocate(Cell*);
 
+    struct SweepResult {
+        size_t collected_cells { 0 };
+        size_t live_cells { 0 };
+    };
+
+    // Deallocates every live cell that was not marked by the last garbage collection.
+    SweepResult sweep();
+
     template<typename Callback>
     void for_each_cell(Callback callback)
     {
@@ -92,6 +100,15 @@ public:
 
     CellAllocator& cell_allocator() { return m_cell_allocator; }
 
+    // A block is in the nursery if cells have been allocated in it since the last garbage collection.
+    bool is_in_nursery() const { return m_in_nursery; }
+    void set_in_nursery(bool in_nursery) { m_in_nursery = in_nursery; }
+
+    // Old cells without write barriers have to be rescanned by every young generation collection, so we keep track of
+    // which blocks could contain any.
+    bool has_cells_without_write_barriers() const { return m_has_cells_without_write_barriers; }
+    void set_has_cells_without_write_barriers() { m_has_cells_without_write_barriers = true; }
+
 private:
     HeapBlock(Heap&, CellAllocator&, size_t cell_size);
 
@@ -111,6 +128,8 @@ private:
     CellAllocator& m_cell_allocator;
     size_t m_cell_size { 0 };
     size_t m_next_lazy_freelist_index { 0 };
+    bool m_in_nursery { false };
+    bool m_has_cells_without_write_barriers { false };
     Ptr<FreelistEntry> m_freelist;
     alignas(__BIGGEST_ALIGNMENT__) u8 m_storage[];
 
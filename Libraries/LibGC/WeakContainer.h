@@ -16,6 +16,8 @@ public:
     explicit WeakContainer(Heap&);
     virtual ~WeakContainer();
 
+    // NOTE: This is called right after marking, possibly before dead cells have been swept.
+    //       At that point, a cell is dead if and only if it's not marked.
     virtual void remove_dead_cells(Badge<Heap>) = 0;
 
 protected:
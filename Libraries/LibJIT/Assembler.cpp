@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJIT/Assembler.h>
+
+namespace JIT {
+
+void Assembler::load_extended(Reg dst, Reg base, i32 displacement, size_t size, bool sign_extend)
+{
+    VERIFY(base != Reg::RSP && base != Reg::R12);
+    switch (size) {
+    case 1:
+    case 2:
+        // movsx dst, byte/word [...] or movzx dst, byte/word [...]
+        emit_rex(sign_extend, dst, base);
+        emit8(0x0f);
+        emit8((sign_extend ? 0xbe : 0xb6) | (size == 2 ? 1 : 0));
+        break;
+    case 4:
+        // movsxd dst, dword [...] or mov dst32, dword [...]
+        emit_rex(sign_extend, dst, base);
+        emit8(sign_extend ? 0x63 : 0x8b);
+        break;
+    case 8:
+        emit_rex(true, dst, base);
+        emit8(0x8b);
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+    emit_modrm_disp32(dst, base, displacement);
+}
+
+void Assembler::store_truncated(Reg base, i32 displacement, Reg src, size_t size)
+{
+    VERIFY(base != Reg::RSP && base != Reg::R12);
+    switch (size) {
+    case 1:
+        // NOTE: Always emit a REX prefix so that registers 4-7 mean spl/bpl/sil/dil rather than ah/ch/dh/bh.
+        emit_rex(false, src, base, true);
+        emit8(0x88);
+        break;
+    case 2:
+        emit8(0x66);
+        emit_rex(false, src, base);
+        emit8(0x89);
+        break;
+    case 4:
+        emit_rex(false, src, base);
+        emit8(0x89);
+        break;
+    case 8:
+        emit_rex(true, src, base);
+        emit8(0x89);
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+    emit_modrm_disp32(src, base, displacement);
+}
+
+void Assembler::sign_extend64(Reg dst, Reg src, size_t from_size)
+{
+    switch (from_size) {
+    case 1:
+    case 2:
+        emit_rex(true, dst, src);
+        emit8(0x0f);
+        emit8(from_size == 1 ? 0xbe : 0xbf);
+        break;
+    case 4:
+        emit_rex(true, dst, src);
+        emit8(0x63);
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+    emit_modrm_reg(dst, src);
+}
+
+void Assembler::set_if(Condition condition, Reg dst)
+{
+    // NOTE: Always emit a REX prefix so that registers 4-7 mean spl/bpl/sil/dil rather than ah/ch/dh/bh.
+    emit8(0x40 | ((to_underlying(dst) >> 3) & 1));
+    emit8(0x0f);
+    emit8(0x90 | to_underlying(condition));
+    emit_modrm_reg(Reg::RAX, dst);
+
+    emit_rex(false, dst, dst, true);
+    emit8(0x0f);
+    emit8(0xb6);
+    emit_modrm_reg(dst, dst);
+}
+
+void Assembler::link(Jump jump, size_t target_offset)
+{
+    auto relative = static_cast<i64>(target_offset) - static_cast<i64>(jump.offset_of_rel32 + 4);
+    VERIFY(relative >= NumericLimits<i32>::min() && relative <= NumericLimits<i32>::max());
+    auto value = static_cast<u32>(static_cast<i32>(relative));
+    for (size_t i = 0; i < 4; ++i)
+        m_output[jump.offset_of_rel32 + i] = (value >> (i * 8)) & 0xff;
+}
+
+}
@@ -0,0 +1,335 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/NumericLimits.h>
+#include <AK/StdLibExtras.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+
+namespace JIT {
+
+// A deliberately tiny x86-64 assembler, shared by the LibJS baseline tier and the LibWasm baseline
+// compiler. It only knows the handful of encodings they need, and always uses 32-bit displacements /
+// relative offsets so that instruction sizes never depend on operand values.
+class Assembler {
+public:
+    enum class Reg : u8 {
+        RAX = 0,
+        RCX = 1,
+        RDX = 2,
+        RBX = 3,
+        RSP = 4,
+        RBP = 5,
+        RSI = 6,
+        RDI = 7,
+        R8 = 8,
+        R9 = 9,
+        R10 = 10,
+        R11 = 11,
+        R12 = 12,
+        R13 = 13,
+        R14 = 14,
+        R15 = 15,
+    };
+
+    enum class Condition : u8 {
+        Overflow = 0x0,
+        NotOverflow = 0x1,
+        Below = 0x2,
+        AboveOrEqual = 0x3,
+        Equal = 0x4,
+        NotEqual = 0x5,
+        BelowOrEqual = 0x6,
+        Above = 0x7,
+        Sign = 0x8,
+        NotSign = 0x9,
+        LessThan = 0xc,
+        GreaterThanOrEqual = 0xd,
+        LessThanOrEqual = 0xe,
+        GreaterThan = 0xf,
+    };
+
+    enum class Width : u8 {
+        Bits32,
+        Bits64,
+    };
+
+    enum class ShiftKind : u8 {
+        RotateLeft = 0,
+        RotateRight = 1,
+        Left = 4,
+        LogicalRight = 5,
+        ArithmeticRight = 7,
+    };
+
+    // A forward or backward reference to a rel32 field that gets patched later.
+    struct Jump {
+        size_t offset_of_rel32 { 0 };
+    };
+
+    explicit Assembler(Vector<u8>& output)
+        : m_output(output)
+    {
+    }
+
+    size_t current_offset() const { return m_output.size(); }
+
+    // mov dst, qword [base + displacement]
+    void load64(Reg dst, Reg base, i32 displacement)
+    {
+        VERIFY(base != Reg::RSP && base != Reg::R12);
+        emit_rex(true, dst, base);
+        emit8(0x8b);
+        emit_modrm_disp32(dst, base, displacement);
+    }
+
+    // mov qword [base + displacement], src
+    void store64(Reg base, i32 displacement, Reg src)
+    {
+        VERIFY(base != Reg::RSP && base != Reg::R12);
+        emit_rex(true, src, base);
+        emit8(0x89);
+        emit_modrm_disp32(src, base, displacement);
+    }
+
+    // Loads `size` bytes from [base + displacement] into dst, sign- or zero-extending them to 64 bits.
+    void load_extended(Reg dst, Reg base, i32 displacement, size_t size, bool sign_extend);
+
+    // Stores the low `size` bytes of src to [base + displacement].
+    void store_truncated(Reg base, i32 displacement, Reg src, size_t size);
+
+    // mov dst, imm64
+    void mov64(Reg dst, u64 imm)
+    {
+        emit_rex(true, Reg::RAX, dst);
+        emit8(0xb8 | (to_underlying(dst) & 7));
+        emit64(imm);
+    }
+
+    // mov dst, imm32 (zero-extends into the upper half)
+    void mov32(Reg dst, u32 imm)
+    {
+        emit_rex(false, Reg::RAX, dst);
+        emit8(0xb8 | (to_underlying(dst) & 7));
+        emit32(imm);
+    }
+
+    // mov dst, src (64-bit)
+    void mov64(Reg dst, Reg src)
+    {
+        emit_rex(true, src, dst);
+        emit8(0x89);
+        emit_modrm_reg(src, dst);
+    }
+
+    // mov dst, src (32-bit, zero-extends into the upper half)
+    void mov32(Reg dst, Reg src)
+    {
+        emit_rex(false, src, dst);
+        emit8(0x89);
+        emit_modrm_reg(src, dst);
+    }
+
+    // movsx dst, src8/src16/src32 (64-bit)
+    void sign_extend64(Reg dst, Reg src, size_t from_size);
+
+    // shr dst, imm8 (64-bit)
+    void shift_right64(Reg dst, u8 amount)
+    {
+        emit_rex(true, Reg::RAX, dst);
+        emit8(0xc1);
+        emit_modrm_reg(static_cast<Reg>(5), dst);
+        emit8(amount);
+    }
+
+    // shl/shr/sar/rol/ror dst, cl
+    void shift_by_cl(Width width, ShiftKind kind, Reg dst)
+    {
+        emit_rex(width == Width::Bits64, Reg::RAX, dst);
+        emit8(0xd3);
+        emit_modrm_reg(static_cast<Reg>(to_underlying(kind)), dst);
+    }
+
+    void add(Width width, Reg dst, Reg src) { emit_alu(0x01, width, dst, src); }
+    void sub(Width width, Reg dst, Reg src) { emit_alu(0x29, width, dst, src); }
+    void and_(Width width, Reg dst, Reg src) { emit_alu(0x21, width, dst, src); }
+    void or_(Width width, Reg dst, Reg src) { emit_alu(0x09, width, dst, src); }
+    void xor_(Width width, Reg dst, Reg src) { emit_alu(0x31, width, dst, src); }
+    void cmp(Width width, Reg lhs, Reg rhs) { emit_alu(0x39, width, lhs, rhs); }
+    void test(Width width, Reg lhs, Reg rhs) { emit_alu(0x85, width, lhs, rhs); }
+
+    // add dst, imm32
+    void add(Width width, Reg dst, i32 imm) { emit_alu_imm(0, width, dst, imm); }
+
+    // sub dst, imm32
+    void sub(Width width, Reg dst, i32 imm) { emit_alu_imm(5, width, dst, imm); }
+
+    // cmp dst, imm32 (sign-extended in 64-bit mode)
+    void cmp(Width width, Reg dst, i32 imm) { emit_alu_imm(7, width, dst, imm); }
+
+    // imul dst, src
+    void imul(Width width, Reg dst, Reg src)
+    {
+        emit_rex(width == Width::Bits64, dst, src);
+        emit8(0x0f);
+        emit8(0xaf);
+        emit_modrm_reg(dst, src);
+    }
+
+    // cdq / cqo: sign-extend rax into rdx:rax
+    void sign_extend_into_rdx(Width width)
+    {
+        if (width == Width::Bits64)
+            emit8(0x48);
+        emit8(0x99);
+    }
+
+    // div src / idiv src: rdx:rax / src, quotient in rax and remainder in rdx
+    void divide(Width width, Reg src, bool is_signed)
+    {
+        emit_rex(width == Width::Bits64, Reg::RAX, src);
+        emit8(0xf7);
+        emit_modrm_reg(static_cast<Reg>(is_signed ? 7 : 6), src);
+    }
+
+    // cmovcc dst, src (64-bit)
+    void move_if(Condition condition, Reg dst, Reg src)
+    {
+        emit_rex(true, dst, src);
+        emit8(0x0f);
+        emit8(0x40 | to_underlying(condition));
+        emit_modrm_reg(dst, src);
+    }
+
+    // setcc dst8; movzx dst, dst8
+    void set_if(Condition, Reg dst);
+
+    // test al, al
+    void test_al()
+    {
+        emit8(0x84);
+        emit8(0xc0);
+    }
+
+    void push(Reg reg)
+    {
+        if (to_underlying(reg) >= 8)
+            emit8(0x41);
+        emit8(0x50 | (to_underlying(reg) & 7));
+    }
+
+    void pop(Reg reg)
+    {
+        if (to_underlying(reg) >= 8)
+            emit8(0x41);
+        emit8(0x58 | (to_underlying(reg) & 7));
+    }
+
+    // call reg
+    void call(Reg reg)
+    {
+        emit_rex(false, Reg::RAX, reg);
+        emit8(0xff);
+        emit_modrm_reg(static_cast<Reg>(2), reg);
+    }
+
+    // jmp reg
+    void jump(Reg reg)
+    {
+        emit_rex(false, Reg::RAX, reg);
+        emit8(0xff);
+        emit_modrm_reg(static_cast<Reg>(4), reg);
+    }
+
+    void ret() { emit8(0xc3); }
+
+    // jmp rel32 (target patched later)
+    [[nodiscard]] Jump jump()
+    {
+        emit8(0xe9);
+        return emit_rel32_placeholder();
+    }
+
+    // jcc rel32 (target patched later)
+    [[nodiscard]] Jump jump_if(Condition condition)
+    {
+        emit8(0x0f);
+        emit8(0x80 | to_underlying(condition));
+        return emit_rel32_placeholder();
+    }
+
+    void link(Jump, size_t target_offset);
+
+    void link_to_here(Jump jump) { link(jump, current_offset()); }
+
+private:
+    void emit8(u8 value) { m_output.append(value); }
+
+    void emit32(u32 value)
+    {
+        for (size_t i = 0; i < 4; ++i)
+            emit8((value >> (i * 8)) & 0xff);
+    }
+
+    void emit64(u64 value)
+    {
+        for (size_t i = 0; i < 8; ++i)
+            emit8((value >> (i * 8)) & 0xff);
+    }
+
+    Jump emit_rel32_placeholder()
+    {
+        Jump jump { current_offset() };
+        emit32(0);
+        return jump;
+    }
+
+    // Emits a REX prefix if one is needed. `reg` goes in ModRM.reg and `rm` in ModRM.rm.
+    void emit_rex(bool is_64bit, Reg reg, Reg rm, bool force = false)
+    {
+        u8 rex = 0x40;
+        if (is_64bit)
+            rex |= 0x08;
+        if (to_underlying(reg) >= 8)
+            rex |= 0x04;
+        if (to_underlying(rm) >= 8)
+            rex |= 0x01;
+        if (rex != 0x40 || force)
+            emit8(rex);
+    }
+
+    void emit_modrm_reg(Reg reg, Reg rm)
+    {
+        emit8(0xc0 | ((to_underlying(reg) & 7) << 3) | (to_underlying(rm) & 7));
+    }
+
+    void emit_modrm_disp32(Reg reg, Reg base, i32 displacement)
+    {
+        emit8(0x80 | ((to_underlying(reg) & 7) << 3) | (to_underlying(base) & 7));
+        emit32(static_cast<u32>(displacement));
+    }
+
+    void emit_alu(u8 opcode, Width width, Reg dst, Reg src)
+    {
+        emit_rex(width == Width::Bits64, src, dst);
+        emit8(opcode);
+        emit_modrm_reg(src, dst);
+    }
+
+    void emit_alu_imm(u8 extension, Width width, Reg dst, i32 imm)
+    {
+        emit_rex(width == Width::Bits64, Reg::RAX, dst);
+        emit8(0x81);
+        emit_modrm_reg(static_cast<Reg>(extension), dst);
+        emit32(static_cast<u32>(imm));
+    }
+
+    Vector<u8>& m_output;
+};
+
+}
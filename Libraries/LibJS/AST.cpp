@@ -802,7 +802,7 @@ void BindingPattern::dump(int indent) const
     }
 }
 
-FunctionNode::FunctionNode(RefPtr<Identifier const> name, ByteString source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
+FunctionNode::FunctionNode(RefPtr<Identifier const> name, SourceText source_text, NonnullRefPtr<Statement const> body, NonnullRefPtr<FunctionParameters const> parameters, i32 function_length, FunctionKind kind, bool is_strict_mode, FunctionParsingInsights parsing_insights, bool is_arrow_function, Vector<LocalVariable> local_variables_names)
     : m_name(move(name))
     , m_source_text(move(source_text))
     , m_body(move(body))
@@ -820,14 +820,17 @@ FunctionNode::FunctionNode(RefPtr<Identifier const> name, ByteString source_text
 
 FunctionNode::~FunctionNode() = default;
 
-void FunctionNode::set_shared_data(GC::Ptr<SharedFunctionInstanceData> shared_data) const
+void FunctionNode::set_shared_data(Realm& realm, GC::Ptr<SharedFunctionInstanceData> shared_data) const
 {
-    m_shared_data = move(shared_data);
+    m_shared_data = shared_data.ptr();
+    m_shared_data_realm = realm;
 }
 
-GC::Ptr<SharedFunctionInstanceData> FunctionNode::shared_data() const
+GC::Ptr<SharedFunctionInstanceData> FunctionNode::shared_data(Realm const& realm) const
 {
-    return m_shared_data.ptr();
+    if (m_shared_data_realm && &*m_shared_data_realm == &realm)
+        return m_shared_data.ptr();
+    return nullptr;
 }
 
 void FunctionNode::dump(int indent, ByteString const& class_name) const
@@ -7,7 +7,9 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/RegexTable.h>
+#include <LibJS/JIT/NativeExecutable.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/SourceCode.h>
 
@@ -39,7 +41,29 @@ Executable::Executable(
     global_variable_caches.resize(number_of_global_variable_caches);
 }
 
-Executable::~Executable() = default;
+Executable::~Executable()
+{
+    if constexpr (JS_PROPERTY_LOOKUP_CACHE_DEBUG) {
+        if (g_dump_property_lookup_cache_statistics)
+            property_lookup_cache_statistics.dump(name);
+    }
+}
+
+void PropertyLookupCacheStatistics::dump(Utf16View const& name) const
+{
+    if (lookups() == 0)
+        return;
+
+    warnln("Property lookup caches for \"{}\": {} lookups, {} hits, {} megamorphic hits, {} misses ({:.1f}% hit rate), {} went megamorphic, {} were reset",
+        name,
+        lookups(),
+        hits,
+        megamorphic_hits,
+        misses,
+        100.0 * static_cast<double>(hits + megamorphic_hits) / static_cast<double>(lookups()),
+        megamorphic_transitions,
+        megamorphic_resets);
+}
 
 void Executable::dump() const
 {
@@ -23,6 +23,12 @@
 #include <LibJS/Runtime/EnvironmentCoordinate.h>
 #include <LibJS/SourceRange.h>
 
+namespace JS::JIT {
+
+class NativeExecutable;
+
+}
+
 namespace JS::Bytecode {
 
 // Represents one polymorphic inline cache used for property lookups.
@@ -46,6 +52,28 @@ struct PropertyLookupCache {
         Optional<u32> shape_dictionary_generation;
     };
     AK::Array<Entry, max_number_of_shapes_to_remember> entries;
+
+    // Set once this cache has seen more shapes than it can remember. From then on, lookups that
+    // miss all entries go to the interpreter's shared MegamorphicPropertyLookupCache instead.
+    bool is_megamorphic { false };
+
+    // Once this many lookups have gone to the megamorphic cache, the entries are forgotten and the cache
+    // starts over as a polymorphic one. This way, a site that was only briefly megamorphic recovers.
+    static constexpr u16 megamorphic_lookups_before_reset = 1024;
+    u16 megamorphic_lookups_until_reset { 0 };
+};
+
+// Counts of what the property lookup caches of an executable, or of a whole interpreter, did.
+// NOTE: These are only counted in builds with JS_PROPERTY_LOOKUP_CACHE_DEBUG, as the lookup fast paths are too hot for it otherwise.
+struct PropertyLookupCacheStatistics {
+    u64 hits { 0 };
+    u64 megamorphic_hits { 0 };
+    u64 misses { 0 };
+    u64 megamorphic_transitions { 0 };
+    u64 megamorphic_resets { 0 };
+
+    u64 lookups() const { return hits + megamorphic_hits + misses; }
+    void dump(Utf16View const& name) const;
 };
 
 struct GlobalVariableCache : public PropertyLookupCache {
@@ -110,6 +138,13 @@ public:
 
     Optional<IdentifierTableIndex> length_identifier;
 
+    // Baseline tier state. Hotness is bumped on each entry into the executable and on each loop back-edge.
+    u32 hotness_counter { 0 };
+    bool did_try_baseline_compilation { false };
+    OwnPtr<JIT::NativeExecutable> native_executable;
+
+    PropertyLookupCacheStatistics property_lookup_cache_statistics;
+
     Utf16String const& get_string(StringTableIndex index) const { return string_table->get(index); }
     Utf16FlyString const& get_identifier(IdentifierTableIndex index) const { return identifier_table->get(index); }
 
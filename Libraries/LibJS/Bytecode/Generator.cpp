@@ -10,6 +10,7 @@
 #include <LibJS/Bytecode/BasicBlock.h>
 #include <LibJS/Bytecode/Generator.h>
 #include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
@@ -215,6 +216,100 @@ CodeGenerationErrorOr<void> Generator::emit_function_declaration_instantiation(E
     return {};
 }
 
+struct BytecodeOptimizationStatistics {
+    size_t instructions_before { 0 };
+    size_t instructions_after { 0 };
+    size_t threaded_jumps { 0 };
+    size_t removed_blocks { 0 };
+    size_t removed_movs { 0 };
+};
+
+static size_t count_instructions(ReadonlyBytes bytecode)
+{
+    size_t count = 0;
+    for (InstructionStreamIterator it(bytecode); !it.at_end(); ++it)
+        ++count;
+    return count;
+}
+
+// If the block consists of nothing but an unconditional Jump, returns the index of the block it jumps to.
+static Optional<size_t> forwarding_target(BasicBlock const& block)
+{
+    if (!block.is_terminated() || block.size() == 0)
+        return {};
+    auto const& instruction = *InstructionStreamIterator { block.instruction_stream() };
+    if (instruction.type() != Instruction::Type::Jump || instruction.length() != block.size())
+        return {};
+    return static_cast<Op::Jump const&>(instruction).target().basic_block_index();
+}
+
+// Pass: Retarget every label that points at a block which does nothing but jump somewhere else.
+static size_t thread_jumps(Vector<NonnullOwnPtr<BasicBlock>> const& blocks)
+{
+    size_t threaded_jumps = 0;
+    for (auto& block : blocks) {
+        for (InstructionStreamIterator it(block->instruction_stream()); !it.at_end(); ++it) {
+            const_cast<Instruction&>(*it).visit_labels([&](Label& label) {
+                auto target = label.basic_block_index();
+                // NOTE: Jump-only blocks can form a cycle (e.g. `for (;;) {}`), so bound the number of hops.
+                for (size_t hops = 0; hops < blocks.size(); ++hops) {
+                    auto next_target = forwarding_target(*blocks[target]);
+                    if (!next_target.has_value() || *next_target == target)
+                        break;
+                    target = *next_target;
+                }
+                if (target != label.basic_block_index()) {
+                    label = Label { static_cast<u32>(target) };
+                    ++threaded_jumps;
+                }
+            });
+        }
+    }
+    return threaded_jumps;
+}
+
+// Pass: Find the blocks reachable from the entry block, either through a label or as an exception handler or finalizer.
+static Vector<bool> find_reachable_blocks(Vector<NonnullOwnPtr<BasicBlock>> const& blocks)
+{
+    Vector<bool> reachable;
+    reachable.resize(blocks.size());
+
+    Vector<size_t> worklist;
+    auto mark_reachable = [&](size_t index) {
+        if (reachable[index])
+            return;
+        reachable[index] = true;
+        worklist.append(index);
+    };
+
+    mark_reachable(0);
+    while (!worklist.is_empty()) {
+        auto const& block = *blocks[worklist.take_last()];
+        if (block.handler())
+            mark_reachable(block.handler()->index());
+        if (block.finalizer())
+            mark_reachable(block.finalizer()->index());
+        for (InstructionStreamIterator it(block.instruction_stream()); !it.at_end(); ++it) {
+            const_cast<Instruction&>(*it).visit_labels([&](Label& label) {
+                mark_reachable(label.basic_block_index());
+            });
+        }
+    }
+    return reachable;
+}
+
+// A Mov is redundant if it doesn't change anything, or if the very next instruction overwrites its destination
+// without reading it first. Mov can't throw, so nothing can observe the destination in between.
+static bool is_redundant_mov(Op::Mov const& mov, InstructionStreamIterator next)
+{
+    if (mov.dst() == mov.src())
+        return true;
+    if (next.at_end() || (*next).type() != Instruction::Type::Mov)
+        return false;
+    auto const& next_mov = static_cast<Op::Mov const&>(*next);
+    return next_mov.dst() == mov.dst() && next_mov.src() != mov.dst();
+}
+
 CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode const& node, FunctionKind enclosing_function_kind, GC::Ptr<ECMAScriptFunctionObject const> function, MustPropagateCompletion must_propagate_completion, Vector<LocalVariable> local_variable_names)
 {
     Generator generator(vm, function, must_propagate_completion);
@@ -268,8 +363,31 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     else if (is<FunctionDeclaration>(node))
         is_strict_mode = static_cast<FunctionDeclaration const&>(node).is_strict_mode();
 
+    BytecodeOptimizationStatistics statistics;
+    if (g_dump_bytecode_optimization_statistics) {
+        for (auto& block : generator.m_root_basic_blocks)
+            statistics.instructions_before += count_instructions(block->instruction_stream());
+    }
+
+    if (g_bytecode_jump_threading_enabled)
+        statistics.threaded_jumps = thread_jumps(generator.m_root_basic_blocks);
+
+    Vector<BasicBlock const*> blocks_to_emit;
+    blocks_to_emit.ensure_capacity(generator.m_root_basic_blocks.size());
+    if (g_bytecode_unreachable_block_elimination_enabled) {
+        auto reachable_blocks = find_reachable_blocks(generator.m_root_basic_blocks);
+        for (auto& block : generator.m_root_basic_blocks) {
+            if (reachable_blocks[block->index()])
+                blocks_to_emit.unchecked_append(block.ptr());
+        }
+        statistics.removed_blocks = generator.m_root_basic_blocks.size() - blocks_to_emit.size();
+    } else {
+        for (auto& block : generator.m_root_basic_blocks)
+            blocks_to_emit.unchecked_append(block.ptr());
+    }
+
     size_t size_needed = 0;
-    for (auto& block : generator.m_root_basic_blocks) {
+    for (auto const* block : blocks_to_emit) {
         size_needed += block->size();
     }
 
@@ -340,7 +458,11 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
     if (undefined_constant.has_value())
         undefined_constant.value().operand().offset_index_by(number_of_registers);
 
-    for (auto& block : generator.m_root_basic_blocks) {
+    for (size_t block_index = 0; block_index < blocks_to_emit.size(); ++block_index) {
+        auto const* block = blocks_to_emit[block_index];
+        // NOTE: This is the block we fall through into if the current one ends without jumping.
+        auto next_block_index = block_index + 1 < blocks_to_emit.size() ? blocks_to_emit[block_index + 1]->index() : NumericLimits<size_t>::max();
+
         basic_block_start_offsets.append(bytecode.size());
         if (block->handler() || block->finalizer()) {
             unlinked_exception_handlers.append({
@@ -351,21 +473,31 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
             });
         }
 
-        block_offsets.set(block.ptr(), bytecode.size());
-
-        for (auto& [offset, source_record] : block->source_map()) {
-            source_map.set(bytecode.size() + offset, source_record);
-        }
+        block_offsets.set(block, bytecode.size());
 
         Bytecode::InstructionStreamIterator it(block->instruction_stream());
         while (!it.at_end()) {
             auto& instruction = const_cast<Instruction&>(*it);
 
+            // OPTIMIZATION: Don't emit moves whose effect can never be observed.
+            if (g_bytecode_redundant_mov_elimination_enabled && instruction.type() == Instruction::Type::Mov) {
+                auto next = it;
+                ++next;
+                if (is_redundant_mov(static_cast<Op::Mov const&>(instruction), next)) {
+                    ++statistics.removed_movs;
+                    ++it;
+                    continue;
+                }
+            }
+
+            if (auto source_record = block->source_map().get(it.offset()); source_record.has_value())
+                source_map.set(bytecode.size(), *source_record);
+
             if (instruction.type() == Instruction::Type::Jump) {
                 auto& jump = static_cast<Bytecode::Op::Jump&>(instruction);
 
                 // OPTIMIZATION: Don't emit jumps that just jump to the next block.
-                if (jump.target().basic_block_index() == block->index() + 1) {
+                if (jump.target().basic_block_index() == next_block_index) {
                     if (basic_block_start_offsets.last() == bytecode.size()) {
                         // This block is empty, just skip it.
                         basic_block_start_offsets.take_last();
@@ -402,7 +534,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
             //               we can emit a `JumpTrue` or `JumpFalse` (to the other block) instead.
             if (instruction.type() == Instruction::Type::JumpIf) {
                 auto& jump = static_cast<Bytecode::Op::JumpIf&>(instruction);
-                if (jump.true_target().basic_block_index() == block->index() + 1) {
+                if (jump.true_target().basic_block_index() == next_block_index) {
                     Op::JumpFalse jump_false(jump.condition(), Label { jump.false_target() });
                     auto& label = jump_false.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_false));
@@ -411,7 +543,7 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
                     ++it;
                     continue;
                 }
-                if (jump.false_target().basic_block_index() == block->index() + 1) {
+                if (jump.false_target().basic_block_index() == next_block_index) {
                     Op::JumpTrue jump_true(jump.condition(), Label { jump.true_target() });
                     auto& label = jump_true.target();
                     size_t label_offset = bytecode.size() + (bit_cast<FlatPtr>(&label) - bit_cast<FlatPtr>(&jump_true));
@@ -443,6 +575,17 @@ CodeGenerationErrorOr<GC::Ref<Executable>> Generator::compile(VM& vm, ASTNode co
         label.set_address(block_offsets.get(block).value());
     }
 
+    if (g_dump_bytecode_optimization_statistics) {
+        statistics.instructions_after = count_instructions(bytecode);
+        warnln("Bytecode optimization statistics for {}: {} -> {} instructions ({} jumps threaded, {} unreachable blocks removed, {} redundant movs removed)",
+            function ? function->name() : "<top-level>"_utf16_fly_string,
+            statistics.instructions_before,
+            statistics.instructions_after,
+            statistics.threaded_jumps,
+            statistics.removed_blocks,
+            statistics.removed_movs);
+    }
+
     auto executable = vm.heap().allocate<Executable>(
         move(bytecode),
         move(generator.m_identifier_table),
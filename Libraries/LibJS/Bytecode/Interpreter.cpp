@@ -18,6 +18,8 @@
 #include <LibJS/Bytecode/Op.h>
 #include <LibJS/Bytecode/PropertyAccess.h>
 #include <LibJS/Export.h>
+#include <LibJS/JIT/Compiler.h>
+#include <LibJS/JIT/NativeExecutable.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Array.h>
@@ -27,6 +29,7 @@
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/Environment.h>
 #include <LibJS/Runtime/FunctionEnvironment.h>
+#include <LibJS/Runtime/GeneratorPrototype.h>
 #include <LibJS/Runtime/GeneratorResult.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/GlobalObject.h>
@@ -38,6 +41,7 @@
 #include <LibJS/Runtime/Realm.h>
 #include <LibJS/Runtime/Reference.h>
 #include <LibJS/Runtime/RegExpObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/TypedArray.h>
 #include <LibJS/Runtime/Value.h>
 #include <LibJS/Runtime/ValueInlines.h>
@@ -46,6 +50,26 @@
 namespace JS::Bytecode {
 
 bool g_dump_bytecode = false;
+bool g_baseline_tier_enabled = false;
+bool g_dump_property_lookup_cache_statistics = false;
+bool g_dump_bytecode_optimization_statistics = false;
+bool g_bytecode_jump_threading_enabled = true;
+bool g_bytecode_redundant_mov_elimination_enabled = true;
+bool g_bytecode_unreachable_block_elimination_enabled = true;
+u32 g_baseline_tier_hotness_threshold = 1000;
+
+bool disable_bytecode_optimization_pass(StringView name)
+{
+    if (name == "jump-threading"sv)
+        g_bytecode_jump_threading_enabled = false;
+    else if (name == "redundant-mov-elimination"sv)
+        g_bytecode_redundant_mov_elimination_enabled = false;
+    else if (name == "unreachable-block-elimination"sv)
+        g_bytecode_unreachable_block_elimination_enabled = false;
+    else
+        return false;
+    return true;
+}
 
 static ByteString format_operand(StringView name, Operand operand, Bytecode::Executable const& executable)
 {
@@ -377,6 +401,10 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
     for (;;) {
     start:
+        // NOTE: Function entry and every taken jump pass through here, which makes it our sampling safe point.
+        if (auto* profiler = vm().sampling_profiler(); profiler && profiler->sample_requested()) [[unlikely]]
+            profiler->take_sample();
+
         for (;;) {
             goto* bytecode_dispatch_table[static_cast<size_t>((*reinterpret_cast<Instruction const*>(&bytecode[program_counter])).type())];
 
@@ -394,7 +422,10 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
 
         handle_Jump: {
             auto& instruction = *reinterpret_cast<Op::Jump const*>(&bytecode[program_counter]);
-            program_counter = instruction.target().address();
+            auto target = instruction.target().address();
+            if (g_baseline_tier_enabled && target < program_counter) [[unlikely]]
+                target = run_baseline_code(target);
+            program_counter = target;
             goto start;
         }
 
@@ -705,6 +736,57 @@ FLATTEN_ON_CLANG void Interpreter::run_bytecode(size_t entry_point)
     }
 }
 
+// Runs the current executable's native code from `program_counter` if it has any, and returns the bytecode
+// offset the interpreter should continue at. Executables are compiled once they become hot enough.
+NEVER_INLINE size_t Interpreter::run_baseline_code(size_t program_counter)
+{
+    auto& executable = current_executable();
+
+    if (!executable.native_executable) {
+        if (executable.did_try_baseline_compilation)
+            return program_counter;
+        if (++executable.hotness_counter < g_baseline_tier_hotness_threshold)
+            return program_counter;
+        executable.did_try_baseline_compilation = true;
+        executable.native_executable = JIT::Compiler::compile(executable, vm());
+        if (!executable.native_executable)
+            return program_counter;
+    }
+
+    auto native_offset = executable.native_executable->native_offset_for_entry_point(program_counter);
+    if (!native_offset.has_value())
+        return program_counter;
+
+    return executable.native_executable->run(m_registers_and_constants_and_locals_arguments.data(), *this, *native_offset);
+}
+
+void Interpreter::count_property_lookup_slow(u64 PropertyLookupCacheStatistics::* counter)
+{
+    ++(m_property_lookup_cache_statistics.*counter);
+
+    if (!m_current_executable)
+        return;
+    auto& statistics = m_current_executable->property_lookup_cache_statistics;
+    if (statistics.lookups() == 0 && statistics.megamorphic_transitions == 0 && statistics.megamorphic_resets == 0)
+        m_executables_with_property_lookup_statistics.append(*m_current_executable);
+    ++(statistics.*counter);
+}
+
+void Interpreter::dump_property_lookup_cache_statistics() const
+{
+    if constexpr (!JS_PROPERTY_LOOKUP_CACHE_DEBUG) {
+        warnln("Property lookup cache statistics are only counted in builds with JS_PROPERTY_LOOKUP_CACHE_DEBUG");
+        return;
+    }
+
+    // Executables that have been collected already printed their statistics on the way out.
+    for (auto const& executable : m_executables_with_property_lookup_statistics) {
+        if (executable)
+            executable->property_lookup_cache_statistics.dump(executable->name);
+    }
+    m_property_lookup_cache_statistics.dump("all executables"_utf16);
+}
+
 Utf16FlyString const& Interpreter::get_identifier(IdentifierTableIndex index) const
 {
     return m_identifier_table.data()[index.value];
@@ -745,7 +827,11 @@ Interpreter::ResultAndReturnRegister Interpreter::run_executable(Executable& exe
         registers_and_constants_and_locals_and_arguments[executable.number_of_registers + i] = executable.constants[i];
     }
 
-    run_bytecode(entry_point.value_or(0));
+    auto program_counter = entry_point.value_or(0);
+    if (g_baseline_tier_enabled) [[unlikely]]
+        program_counter = run_baseline_code(program_counter);
+
+    run_bytecode(program_counter);
 
     dbgln_if(JS_BYTECODE_DEBUG, "Bytecode::Interpreter did run unit {:p}", &executable);
 
@@ -949,7 +1035,7 @@ inline ThrowCompletionOr<Value> get_by_value(VM& vm, Optional<IdentifierTableInd
         auto& object = base_value.as_object();
         auto index = static_cast<u32>(property_key_value.as_i32());
 
-        auto const* object_storage = object.indexed_properties().storage();
+        auto const* object_storage = static_cast<Object const&>(object).indexed_properties().storage();
 
         // For "non-typed arrays":
         if (!object.may_interfere_with_indexed_property_access()
@@ -1162,6 +1248,7 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
                     if (can_use_cache) [[likely]] {
                         auto value_in_prototype = cached_prototype->get_direct(cache.property_offset.value());
                         if (value_in_prototype.is_accessor()) [[unlikely]] {
+                            vm.bytecode_interpreter().count_property_lookup(&PropertyLookupCacheStatistics::hits);
                             (void)TRY(call(vm, value_in_prototype.as_accessor().setter(), this_value, value));
                             return {};
                         }
@@ -1178,6 +1265,7 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
                             break;
                     }
 
+                    vm.bytecode_interpreter().count_property_lookup(&PropertyLookupCacheStatistics::hits);
                     auto value_in_object = object->get_direct(cache.property_offset.value());
                     if (value_in_object.is_accessor()) [[unlikely]] {
                         (void)TRY(call(vm, value_in_object.as_accessor().setter(), this_value, value));
@@ -1205,6 +1293,7 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
                     auto cached_prototype_chain_validity = cache.prototype_chain_validity.ptr();
                     if (cached_prototype_chain_validity && !cached_prototype_chain_validity->is_valid()) [[unlikely]]
                         break;
+                    vm.bytecode_interpreter().count_property_lookup(&PropertyLookupCacheStatistics::hits);
                     object->unsafe_set_shape(*cached_shape);
                     object->put_direct(*cache.property_offset, value);
                     return {};
@@ -1215,6 +1304,9 @@ ThrowCompletionOr<void> put_by_property_key(VM& vm, Value base, Value this_value
             }
         }
 
+        if (caches)
+            vm.bytecode_interpreter().count_property_lookup(&PropertyLookupCacheStatistics::misses);
+
         CacheableSetPropertyMetadata cacheable_metadata;
         bool succeeded = TRY(object->internal_set(name, value, this_value, &cacheable_metadata));
 
@@ -1407,6 +1499,7 @@ inline ThrowCompletionOr<void> put_by_value(VM& vm, Value base, Optional<Utf16Fl
             if (maybe_value.has_value()) {
                 auto existing_value = maybe_value->value;
                 if (!existing_value.is_accessor()) {
+                    object.write_barrier();
                     storage->put(index, value);
                     return {};
                 }
@@ -2840,7 +2933,7 @@ void GetImportMeta::execute_impl(Bytecode::Interpreter& interpreter) const
     interpreter.set(dst(), interpreter.vm().get_import_meta());
 }
 
-static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, ReadonlySpan<Operand> arguments)
+static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& interpreter, Bytecode::Builtin builtin, Value this_value, ReadonlySpan<Operand> arguments)
 {
     switch (builtin) {
     case Builtin::MathAbs:
@@ -2874,6 +2967,8 @@ static ThrowCompletionOr<Value> dispatch_builtin_call(Bytecode::Interpreter& int
     case Builtin::SetIteratorPrototypeNext:
     case Builtin::StringIteratorPrototypeNext:
         VERIFY_NOT_REACHED();
+    case Builtin::GeneratorPrototypeNext:
+        return TRY(GeneratorPrototype::next_impl(interpreter.vm(), this_value, interpreter.get(arguments[0])));
     case Builtin::OrdinaryHasInstance:
         VERIFY_NOT_REACHED();
     case Bytecode::Builtin::__Count:
@@ -2943,7 +3038,7 @@ ThrowCompletionOr<void> CallBuiltin::execute_impl(Bytecode::Interpreter& interpr
     auto callee = interpreter.get(m_callee);
 
     if (m_argument_count == Bytecode::builtin_argument_count(m_builtin) && callee.is_object() && interpreter.realm().get_builtin_value(m_builtin) == &callee.as_object()) {
-        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, { m_arguments, m_argument_count })));
+        interpreter.set(dst(), TRY(dispatch_builtin_call(interpreter, m_builtin, interpreter.get(m_this_value), { m_arguments, m_argument_count })));
         return {};
     }
 
@@ -6,8 +6,10 @@
 
 #pragma once
 
+#include <AK/Debug.h>
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/Label.h>
+#include <LibJS/Bytecode/MegamorphicPropertyLookupCache.h>
 #include <LibJS/Bytecode/Register.h>
 #include <LibJS/Export.h>
 #include <LibJS/Forward.h>
@@ -80,6 +82,19 @@ public:
 
     ExecutionContext& running_execution_context() { return *m_running_execution_context; }
 
+    MegamorphicPropertyLookupCache& megamorphic_property_lookup_cache() { return m_megamorphic_property_lookup_cache; }
+
+    PropertyLookupCacheStatistics const& property_lookup_cache_statistics() const { return m_property_lookup_cache_statistics; }
+    void dump_property_lookup_cache_statistics() const;
+
+    // Bumps one of the property lookup cache counters, both for the whole interpreter and for the current executable.
+    // This compiles to nothing unless JS_PROPERTY_LOOKUP_CACHE_DEBUG is enabled.
+    ALWAYS_INLINE void count_property_lookup(u64 PropertyLookupCacheStatistics::* counter)
+    {
+        if constexpr (JS_PROPERTY_LOOKUP_CACHE_DEBUG)
+            count_property_lookup_slow(counter);
+    }
+
     [[nodiscard]] Utf16FlyString const& get_identifier(IdentifierTableIndex) const;
     [[nodiscard]] Optional<Utf16FlyString const&> get_identifier(Optional<IdentifierTableIndex> index) const
     {
@@ -90,6 +105,8 @@ public:
 
 private:
     void run_bytecode(size_t entry_point);
+    void count_property_lookup_slow(u64 PropertyLookupCacheStatistics::* counter);
+    [[nodiscard]] size_t run_baseline_code(size_t program_counter);
 
     enum class HandleExceptionResponse {
         ExitFromExecutable,
@@ -106,9 +123,26 @@ private:
     Span<Value> m_registers_and_constants_and_locals_arguments;
     ExecutionContext* m_running_execution_context { nullptr };
     ReadonlySpan<Utf16FlyString> m_identifier_table;
+    MegamorphicPropertyLookupCache m_megamorphic_property_lookup_cache;
+    PropertyLookupCacheStatistics m_property_lookup_cache_statistics;
+    Vector<GC::Weak<Executable>> m_executables_with_property_lookup_statistics;
 };
 
 JS_API extern bool g_dump_bytecode;
+JS_API extern bool g_baseline_tier_enabled;
+JS_API extern bool g_dump_property_lookup_cache_statistics;
+JS_API extern bool g_dump_bytecode_optimization_statistics;
+
+// Number of entries and loop back-edges after which an executable is handed to the baseline compiler.
+JS_API extern u32 g_baseline_tier_hotness_threshold;
+
+// Individually toggleable bytecode optimization passes, run by Generator::compile().
+JS_API extern bool g_bytecode_jump_threading_enabled;
+JS_API extern bool g_bytecode_redundant_mov_elimination_enabled;
+JS_API extern bool g_bytecode_unreachable_block_elimination_enabled;
+
+// Turns off the pass with the given name (e.g. "jump-threading"). Returns false if there is no such pass.
+JS_API bool disable_bytecode_optimization_pass(StringView name);
 
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ASTNode const&, JS::FunctionKind kind, Utf16FlyString const& name);
 ThrowCompletionOr<GC::Ref<Bytecode::Executable>> compile(VM&, ECMAScriptFunctionObject const&);
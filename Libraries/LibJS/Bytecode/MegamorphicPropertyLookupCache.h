@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashFunctions.h>
+#include <AK/Noncopyable.h>
+#include <AK/Utf16FlyString.h>
+#include <AK/Vector.h>
+#include <LibJS/Bytecode/Executable.h>
+
+namespace JS::Bytecode {
+
+// A direct-mapped table of (shape, property name) -> property lookup, shared by every
+// call site whose own PropertyLookupCache has overflowed (i.e. has gone megamorphic).
+class MegamorphicPropertyLookupCache {
+    AK_MAKE_NONCOPYABLE(MegamorphicPropertyLookupCache);
+    AK_MAKE_NONMOVABLE(MegamorphicPropertyLookupCache);
+
+public:
+    static constexpr size_t number_of_entries = 1024;
+    static_assert(is_power_of_two(number_of_entries));
+
+    struct Entry {
+        Utf16FlyString property_name;
+        PropertyLookupCache::Entry cache_entry;
+    };
+
+    MegamorphicPropertyLookupCache() = default;
+
+    [[nodiscard]] Entry* find(Shape const& shape, Utf16FlyString const& property_name)
+    {
+        if (m_entries.is_empty())
+            return nullptr;
+        auto& entry = m_entries[index_for(shape, property_name)];
+        if (&shape != entry.cache_entry.shape || entry.property_name != property_name)
+            return nullptr;
+        return &entry;
+    }
+
+    // Returns the slot for `shape` and `property_name`, evicting whatever was cached there before.
+    [[nodiscard]] Entry& slot_for(Shape const& shape, Utf16FlyString const& property_name)
+    {
+        if (m_entries.is_empty())
+            m_entries.resize(number_of_entries);
+        auto& entry = m_entries[index_for(shape, property_name)];
+        entry = { property_name, {} };
+        return entry;
+    }
+
+private:
+    static size_t index_for(Shape const& shape, Utf16FlyString const& property_name)
+    {
+        return pair_int_hash(ptr_hash(&shape), property_name.hash()) & (number_of_entries - 1);
+    }
+
+    // NOTE: This is allocated lazily, since most VMs never see a megamorphic property access.
+    Vector<Entry> m_entries;
+};
+
+}
@@ -8,6 +8,7 @@
 
 #include <LibJS/Bytecode/Executable.h>
 #include <LibJS/Bytecode/IdentifierTable.h>
+#include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Accessor.h>
 #include <LibJS/Runtime/Completion.h>
@@ -67,6 +68,56 @@ ALWAYS_INLINE ThrowCompletionOr<GC::Ref<Object>> base_object_for_get(VM& vm, Val
     return throw_null_or_undefined_property_get(vm, base_value, get_base_identifier, get_property_name);
 }
 
+// Returns the property that `cache_entry` remembers for `base_object`, if the entry is still valid for it.
+// NOTE: The returned value is the raw property slot, which may hold an accessor.
+ALWAYS_INLINE Optional<Value> get_from_cache_entry(Object& base_object, PropertyLookupCache::Entry& cache_entry)
+{
+    auto& shape = base_object.shape();
+    if (&shape != cache_entry.shape)
+        return {};
+
+    if (shape.is_dictionary()) {
+        VERIFY(cache_entry.shape_dictionary_generation.has_value());
+        if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation.value()) [[unlikely]]
+            return {};
+    }
+
+    if (auto cached_prototype = cache_entry.prototype.ptr()) {
+        // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
+        auto cached_prototype_chain_validity = cache_entry.prototype_chain_validity.ptr();
+        if (!cached_prototype_chain_validity || !cached_prototype_chain_validity->is_valid()) [[unlikely]]
+            return {};
+        return cached_prototype->get_direct(cache_entry.property_offset.value());
+    }
+
+    // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
+    return base_object.get_direct(cache_entry.property_offset.value());
+}
+
+// Looks up the property cached for `base_object`'s shape, without any side effects.
+// NOTE: The returned value is the raw property slot, which may hold an accessor.
+ALWAYS_INLINE Optional<Value> get_by_id_from_cache(Object& base_object, PropertyLookupCache& cache)
+{
+    for (auto& cache_entry : cache.entries) {
+        if (auto value = get_from_cache_entry(base_object, cache_entry); value.has_value())
+            return value;
+    }
+    return {};
+}
+
+// Only string-keyed lookups go into the megamorphic cache.
+ALWAYS_INLINE Optional<Utf16FlyString const&> megamorphic_cache_key(Utf16FlyString const& property_name)
+{
+    return property_name;
+}
+
+ALWAYS_INLINE Optional<Utf16FlyString const&> megamorphic_cache_key(PropertyKey const& property_key)
+{
+    if (!property_key.is_string())
+        return {};
+    return property_key.as_string();
+}
+
 template<GetByIdMode mode, typename GetBaseIdentifier, typename GetPropertyName>
 ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_base_identifier, GetPropertyName get_property_name, Value base_value, Value this_value, PropertyLookupCache& cache)
 {
@@ -81,64 +132,48 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     if constexpr (mode == GetByIdMode::Length) {
         // OPTIMIZATION: Fast path for the magical "length" property on Array objects.
         if (base_obj->has_magical_length_property()) {
-            return Value { base_obj->indexed_properties().array_like_size() };
+            return Value { static_cast<Object const&>(*base_obj).indexed_properties().array_like_size() };
         }
     }
 
-    auto& shape = base_obj->shape();
+    auto& interpreter = vm.bytecode_interpreter();
 
-    GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
-    if (shape.prototype())
-        prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
+    if (auto cached_value = get_by_id_from_cache(*base_obj, cache); cached_value.has_value()) [[likely]] {
+        interpreter.count_property_lookup(&PropertyLookupCacheStatistics::hits);
+        if (cached_value->is_accessor())
+            return TRY(call(vm, cached_value->as_accessor().getter(), this_value));
+        return *cached_value;
+    }
 
-    for (auto& cache_entry : cache.entries) {
-        auto cached_prototype = cache_entry.prototype.ptr();
-        if (cached_prototype) {
-            // OPTIMIZATION: If the prototype chain hasn't been mutated in a way that would invalidate the cache, we can use it.
-            bool can_use_cache = [&]() -> bool {
-                if (&shape != cache_entry.shape) [[unlikely]]
-                    return false;
-
-                if (shape.is_dictionary()) {
-                    VERIFY(cache_entry.shape_dictionary_generation.has_value());
-                    if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation.value()) [[unlikely]] {
-                        return false;
-                    }
-                }
+    auto& shape = base_obj->shape();
+    auto& megamorphic_cache = interpreter.megamorphic_property_lookup_cache();
 
-                auto cached_prototype_chain_validity = cache_entry.prototype_chain_validity.ptr();
-                if (!cached_prototype_chain_validity) [[unlikely]]
-                    return false;
-                if (!cached_prototype_chain_validity->is_valid()) [[unlikely]]
-                    return false;
-                return true;
-            }();
-            if (can_use_cache) [[likely]] {
-                auto value = cached_prototype->get_direct(cache_entry.property_offset.value());
-                if (value.is_accessor())
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
-                return value;
-            }
-        } else if (&shape == cache_entry.shape) {
-            // OPTIMIZATION: If the shape of the object hasn't changed, we can use the cached property offset.
-            bool can_use_cache = true;
-            if (shape.is_dictionary()) {
-                VERIFY(cache_entry.shape_dictionary_generation.has_value());
-                if (shape.dictionary_generation() != cache_entry.shape_dictionary_generation.value()) [[unlikely]] {
-                    can_use_cache = false;
-                }
-            }
+    if (cache.is_megamorphic && --cache.megamorphic_lookups_until_reset == 0) {
+        cache.entries = {};
+        cache.is_megamorphic = false;
+        interpreter.count_property_lookup(&PropertyLookupCacheStatistics::megamorphic_resets);
+    }
 
-            if (can_use_cache) [[likely]] {
-                auto value = base_obj->get_direct(cache_entry.property_offset.value());
-                if (value.is_accessor()) {
-                    return TRY(call(vm, value.as_accessor().getter(), this_value));
+    if (cache.is_megamorphic) {
+        auto const& property_name = get_property_name();
+        if (auto key = megamorphic_cache_key(property_name); key.has_value()) {
+            if (auto* entry = megamorphic_cache.find(shape, *key)) {
+                if (auto cached_value = get_from_cache_entry(*base_obj, entry->cache_entry); cached_value.has_value()) {
+                    interpreter.count_property_lookup(&PropertyLookupCacheStatistics::megamorphic_hits);
+                    if (cached_value->is_accessor())
+                        return TRY(call(vm, cached_value->as_accessor().getter(), this_value));
+                    return *cached_value;
                 }
-                return value;
             }
         }
     }
 
+    interpreter.count_property_lookup(&PropertyLookupCacheStatistics::misses);
+
+    GC::Ptr<PrototypeChainValidity> prototype_chain_validity;
+    if (shape.prototype())
+        prototype_chain_validity = shape.prototype()->shape().prototype_chain_validity();
+
     CacheableGetPropertyMetadata cacheable_metadata;
     auto value = TRY(base_obj->internal_get(get_property_name(), this_value, &cacheable_metadata));
 
@@ -146,7 +181,23 @@ ALWAYS_INLINE ThrowCompletionOr<Value> get_by_id(VM& vm, GetBaseIdentifier get_b
     // that collected metadata is valid, e.g. if getter in prototype chain added
     // property with the same name into the object itself.
     if (&shape == &base_obj->shape()) {
+        // NOTE: Once every entry is in use, we stop evicting entries (which would just thrash the cache),
+        //       and remember further shapes in the shared megamorphic cache instead.
+        PropertyLookupCache::Entry megamorphic_scratch_entry;
         auto get_cache_slot = [&] -> PropertyLookupCache::Entry& {
+            if (!cache.is_megamorphic && cache.entries.last().shape) {
+                cache.is_megamorphic = true;
+                cache.megamorphic_lookups_until_reset = PropertyLookupCache::megamorphic_lookups_before_reset;
+                interpreter.count_property_lookup(&PropertyLookupCacheStatistics::megamorphic_transitions);
+            }
+
+            if (cache.is_megamorphic) {
+                auto const& property_name = get_property_name();
+                if (auto key = megamorphic_cache_key(property_name); key.has_value())
+                    return megamorphic_cache.slot_for(shape, *key).cache_entry;
+                return megamorphic_scratch_entry;
+            }
+
             for (size_t i = cache.entries.size() - 1; i >= 1; --i) {
                 cache.entries[i] = cache.entries[i - 1];
             }
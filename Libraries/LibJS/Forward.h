@@ -201,6 +201,7 @@ class Parser;
 struct ParserError;
 class PrimitiveString;
 class Program;
+class ProgramCache;
 class PromiseCapability;
 class PromiseReaction;
 class PropertyAttributes;
@@ -208,6 +209,8 @@ class PropertyDescriptor;
 class PropertyKey;
 class Realm;
 class Reference;
+class RopeString;
+class SamplingProfiler;
 class ScopeNode;
 class Script;
 class Shape;
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/Debug.h>
+#include <AK/Platform.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Bytecode/PropertyAccess.h>
+#include <LibJS/JIT/Compiler.h>
+#include <LibJS/Runtime/DeclarativeEnvironment.h>
+#include <LibJS/Runtime/Object.h>
+#include <LibJS/Runtime/Value.h>
+
+namespace JS::JIT {
+
+using Reg = Assembler::Reg;
+using Condition = Assembler::Condition;
+using Width = Assembler::Width;
+
+// Native code register assignment.
+static constexpr auto REGISTER_FILE_BASE = Reg::RBX;
+static constexpr auto INTERPRETER = Reg::R12;
+
+// Helpers called from native code. They must never have observable side effects
+// unless they succeed, so that native code can fall back to the interpreter by
+// simply re-executing the instruction.
+static bool native_get_by_id(Bytecode::Interpreter* interpreter, Bytecode::Op::GetById const* instruction, Value* registers)
+{
+    auto base_value = registers[instruction->base().index()];
+    if (!base_value.is_object())
+        return false;
+
+    auto& cache = interpreter->current_executable().property_lookup_caches[instruction->cache_index()];
+    auto value = Bytecode::get_by_id_from_cache(base_value.as_object(), cache);
+    if (!value.has_value() || value->is_accessor())
+        return false;
+
+    registers[instruction->dst().index()] = *value;
+    return true;
+}
+
+static bool native_get_global(Bytecode::Interpreter* interpreter, Bytecode::Op::GetGlobal const* instruction, Value* registers)
+{
+    auto& cache = interpreter->current_executable().global_variable_caches[instruction->cache_index()];
+    if (cache.environment_serial_number != interpreter->global_declarative_environment().environment_serial_number())
+        return false;
+
+    auto& binding_object = interpreter->global_object();
+    auto& shape = binding_object.shape();
+    auto& cache_entry = cache.entries[0];
+    if (&shape != cache_entry.shape)
+        return false;
+    if (shape.is_dictionary() && shape.dictionary_generation() != cache_entry.shape_dictionary_generation.value())
+        return false;
+
+    auto value = binding_object.get_direct(cache_entry.property_offset.value());
+    if (value.is_accessor())
+        return false;
+
+    registers[instruction->dst().index()] = value;
+    return true;
+}
+
+static i32 operand_displacement(Bytecode::Operand operand)
+{
+    auto displacement = static_cast<u64>(operand.index()) * sizeof(Value);
+    VERIFY(displacement <= static_cast<u64>(NumericLimits<i32>::max()));
+    return static_cast<i32>(displacement);
+}
+
+void Compiler::load_operand(Reg dst, Bytecode::Operand operand)
+{
+    m_assembler.load64(dst, REGISTER_FILE_BASE, operand_displacement(operand));
+}
+
+void Compiler::store_operand(Bytecode::Operand operand, Reg src)
+{
+    m_assembler.store64(REGISTER_FILE_BASE, operand_displacement(operand), src);
+}
+
+void Compiler::emit_exit(size_t bytecode_offset)
+{
+    m_assembler.mov64(Reg::RAX, bytecode_offset);
+    m_assembler.link(m_assembler.jump(), m_epilogue_offset);
+}
+
+void Compiler::emit_exit_if(Condition condition, size_t bytecode_offset)
+{
+    // NOTE: Exit stubs are emitted out of line once all blocks have been compiled.
+    m_pending_exits.append({ m_assembler.jump_if(condition), bytecode_offset });
+}
+
+void Compiler::emit_jump_to_bytecode_offset(size_t bytecode_offset)
+{
+    // NOTE: Jumps are linked once all blocks have been compiled, since most of them go forward.
+    m_pending_jumps.append({ m_assembler.jump(), bytecode_offset });
+}
+
+void Compiler::emit_sampling_safe_point(size_t bytecode_offset)
+{
+    m_assembler.mov64(Reg::RAX, reinterpret_cast<FlatPtr>(m_vm.sample_requested().ptr()));
+    m_assembler.load_extended(Reg::RAX, Reg::RAX, 0, 1, false);
+    m_assembler.test(Width::Bits32, Reg::RAX, Reg::RAX);
+    emit_exit_if(Condition::NotEqual, bytecode_offset);
+}
+
+void Compiler::load_int32_operand_or_exit(Reg dst, Bytecode::Operand operand, size_t bytecode_offset)
+{
+    load_operand(dst, operand);
+    m_assembler.mov64(Reg::RDX, dst);
+    m_assembler.shift_right64(Reg::RDX, static_cast<u8>(GC::TAG_SHIFT));
+    m_assembler.cmp(Width::Bits32, Reg::RDX, static_cast<i32>(INT32_TAG));
+    emit_exit_if(Condition::NotEqual, bytecode_offset);
+}
+
+void Compiler::store_int32_result(Bytecode::Operand dst, Reg src)
+{
+    m_assembler.mov32(src, src);
+    m_assembler.mov64(Reg::RDX, SHIFTED_INT32_TAG);
+    m_assembler.or_(Width::Bits64, src, Reg::RDX);
+    store_operand(dst, src);
+}
+
+void Compiler::store_boolean_result_if(Condition condition, Bytecode::Operand dst)
+{
+    m_assembler.set_if(condition, Reg::RAX);
+    m_assembler.mov64(Reg::RDX, SHIFTED_BOOLEAN_TAG);
+    m_assembler.or_(Width::Bits64, Reg::RAX, Reg::RDX);
+    store_operand(dst, Reg::RAX);
+}
+
+// Leaves ZF set if the operand is falsy. Only booleans and int32s are handled natively.
+void Compiler::test_truthiness_or_exit(Bytecode::Operand operand, size_t bytecode_offset)
+{
+    load_operand(Reg::RAX, operand);
+    m_assembler.mov64(Reg::RDX, Reg::RAX);
+    m_assembler.shift_right64(Reg::RDX, static_cast<u8>(GC::TAG_SHIFT));
+    m_assembler.cmp(Width::Bits32, Reg::RDX, static_cast<i32>(BOOLEAN_TAG));
+    auto is_boolean = m_assembler.jump_if(Condition::Equal);
+    m_assembler.cmp(Width::Bits32, Reg::RDX, static_cast<i32>(INT32_TAG));
+    emit_exit_if(Condition::NotEqual, bytecode_offset);
+    m_assembler.link_to_here(is_boolean);
+    m_assembler.test(Width::Bits32, Reg::RAX, Reg::RAX);
+}
+
+void Compiler::call_helper(FlatPtr helper, void const* instruction, size_t bytecode_offset)
+{
+    m_assembler.mov64(Reg::RDI, INTERPRETER);
+    m_assembler.mov64(Reg::RSI, reinterpret_cast<FlatPtr>(instruction));
+    m_assembler.mov64(Reg::RDX, REGISTER_FILE_BASE);
+    m_assembler.mov64(Reg::RAX, helper);
+    m_assembler.call(Reg::RAX);
+    m_assembler.test_al();
+    emit_exit_if(Condition::Equal, bytecode_offset);
+}
+
+void Compiler::emit_prologue_and_epilogue()
+{
+    // The entry trampoline: fn(Value* registers, Interpreter*, void const* native_entry) -> size_t.
+    // NOTE: Three pushes keep the stack 16-byte aligned for calls into helpers.
+    m_assembler.push(Reg::RBX);
+    m_assembler.push(Reg::R12);
+    m_assembler.push(Reg::R13);
+    m_assembler.mov64(REGISTER_FILE_BASE, Reg::RDI);
+    m_assembler.mov64(INTERPRETER, Reg::RSI);
+    m_assembler.jump(Reg::RDX);
+
+    // Every exit lands here with the bytecode offset to resume at in RAX.
+    m_epilogue_offset = m_assembler.current_offset();
+    m_assembler.pop(Reg::R13);
+    m_assembler.pop(Reg::R12);
+    m_assembler.pop(Reg::RBX);
+    m_assembler.ret();
+}
+
+bool Compiler::compile_instruction(Bytecode::Instruction const& instruction, size_t offset)
+{
+    using Type = Bytecode::Instruction::Type;
+
+    switch (instruction.type()) {
+    case Type::Mov: {
+        auto& op = static_cast<Bytecode::Op::Mov const&>(instruction);
+        load_operand(Reg::RAX, op.src());
+        store_operand(op.dst(), Reg::RAX);
+        return true;
+    }
+
+#define COMPILE_INT32_BINARY_OP(OpTitleCase, emit_operation)                    \
+    case Type::OpTitleCase: {                                                   \
+        auto& op = static_cast<Bytecode::Op::OpTitleCase const&>(instruction); \
+        load_int32_operand_or_exit(Reg::RAX, op.lhs(), offset);                 \
+        load_int32_operand_or_exit(Reg::RCX, op.rhs(), offset);                 \
+        emit_operation;                                                         \
+        store_int32_result(op.dst(), Reg::RAX);                                 \
+        return true;                                                            \
+    }
+
+        COMPILE_INT32_BINARY_OP(Add, m_assembler.add(Width::Bits32, Reg::RAX, Reg::RCX); emit_exit_if(Condition::Overflow, offset))
+        COMPILE_INT32_BINARY_OP(Sub, m_assembler.sub(Width::Bits32, Reg::RAX, Reg::RCX); emit_exit_if(Condition::Overflow, offset))
+        COMPILE_INT32_BINARY_OP(BitwiseAnd, m_assembler.and_(Width::Bits32, Reg::RAX, Reg::RCX))
+        COMPILE_INT32_BINARY_OP(BitwiseOr, m_assembler.or_(Width::Bits32, Reg::RAX, Reg::RCX))
+        COMPILE_INT32_BINARY_OP(BitwiseXor, m_assembler.xor_(Width::Bits32, Reg::RAX, Reg::RCX))
+#undef COMPILE_INT32_BINARY_OP
+
+#define COMPILE_INT32_COMPARISON_OP(OpTitleCase, condition)                     \
+    case Type::OpTitleCase: {                                                   \
+        auto& op = static_cast<Bytecode::Op::OpTitleCase const&>(instruction); \
+        load_int32_operand_or_exit(Reg::RAX, op.lhs(), offset);                 \
+        load_int32_operand_or_exit(Reg::RCX, op.rhs(), offset);                 \
+        m_assembler.cmp(Width::Bits32, Reg::RAX, Reg::RCX);                     \
+        store_boolean_result_if(condition, op.dst());                           \
+        return true;                                                            \
+    }                                                                           \
+    case Type::Jump##OpTitleCase: {                                             \
+        auto& op = static_cast<Bytecode::Op::Jump##OpTitleCase const&>(instruction); \
+        load_int32_operand_or_exit(Reg::RAX, op.lhs(), offset);                 \
+        load_int32_operand_or_exit(Reg::RCX, op.rhs(), offset);                 \
+        m_assembler.cmp(Width::Bits32, Reg::RAX, Reg::RCX);                     \
+        m_pending_jumps.append({ m_assembler.jump_if(condition), op.true_target().address() }); \
+        emit_jump_to_bytecode_offset(op.false_target().address());              \
+        return true;                                                            \
+    }
+
+        COMPILE_INT32_COMPARISON_OP(LessThan, Condition::LessThan)
+        COMPILE_INT32_COMPARISON_OP(LessThanEquals, Condition::LessThanOrEqual)
+        COMPILE_INT32_COMPARISON_OP(GreaterThan, Condition::GreaterThan)
+        COMPILE_INT32_COMPARISON_OP(GreaterThanEquals, Condition::GreaterThanOrEqual)
+        // NOTE: For two int32 values, loose and strict (in)equality are the same thing.
+        COMPILE_INT32_COMPARISON_OP(LooselyEquals, Condition::Equal)
+        COMPILE_INT32_COMPARISON_OP(LooselyInequals, Condition::NotEqual)
+        COMPILE_INT32_COMPARISON_OP(StrictlyEquals, Condition::Equal)
+        COMPILE_INT32_COMPARISON_OP(StrictlyInequals, Condition::NotEqual)
+#undef COMPILE_INT32_COMPARISON_OP
+
+    case Type::Increment: {
+        auto& op = static_cast<Bytecode::Op::Increment const&>(instruction);
+        load_int32_operand_or_exit(Reg::RAX, op.dst(), offset);
+        m_assembler.add(Width::Bits32, Reg::RAX, 1);
+        emit_exit_if(Condition::Overflow, offset);
+        store_int32_result(op.dst(), Reg::RAX);
+        return true;
+    }
+    case Type::Decrement: {
+        auto& op = static_cast<Bytecode::Op::Decrement const&>(instruction);
+        load_int32_operand_or_exit(Reg::RAX, op.dst(), offset);
+        m_assembler.sub(Width::Bits32, Reg::RAX, 1);
+        emit_exit_if(Condition::Overflow, offset);
+        store_int32_result(op.dst(), Reg::RAX);
+        return true;
+    }
+
+    case Type::Jump: {
+        auto& op = static_cast<Bytecode::Op::Jump const&>(instruction);
+        emit_jump_to_bytecode_offset(op.target().address());
+        return true;
+    }
+    case Type::JumpIf: {
+        auto& op = static_cast<Bytecode::Op::JumpIf const&>(instruction);
+        test_truthiness_or_exit(op.condition(), offset);
+        m_pending_jumps.append({ m_assembler.jump_if(Condition::NotEqual), op.true_target().address() });
+        emit_jump_to_bytecode_offset(op.false_target().address());
+        return true;
+    }
+    case Type::JumpTrue: {
+        auto& op = static_cast<Bytecode::Op::JumpTrue const&>(instruction);
+        test_truthiness_or_exit(op.condition(), offset);
+        m_pending_jumps.append({ m_assembler.jump_if(Condition::NotEqual), op.target().address() });
+        return true;
+    }
+    case Type::JumpFalse: {
+        auto& op = static_cast<Bytecode::Op::JumpFalse const&>(instruction);
+        test_truthiness_or_exit(op.condition(), offset);
+        m_pending_jumps.append({ m_assembler.jump_if(Condition::Equal), op.target().address() });
+        return true;
+    }
+
+    case Type::GetById:
+        call_helper(bit_cast<FlatPtr>(&native_get_by_id), &instruction, offset);
+        return true;
+    case Type::GetGlobal:
+        call_helper(bit_cast<FlatPtr>(&native_get_global), &instruction, offset);
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+OwnPtr<NativeExecutable> Compiler::compile(Bytecode::Executable& executable, VM& vm)
+{
+#if ARCH(X86_64) && !defined(AK_OS_WINDOWS)
+    Compiler compiler { executable, vm };
+    compiler.emit_prologue_and_epilogue();
+
+    auto const& block_start_offsets = executable.basic_block_start_offsets;
+    size_t next_block_index = 0;
+
+    // While false, we're skipping the tail of a block that can only run in the interpreter.
+    bool is_emitting = false;
+
+    Bytecode::InstructionStreamIterator it { executable.bytecode, &executable };
+    for (; !it.at_end(); ++it) {
+        auto offset = it.offset();
+        bool is_block_start = next_block_index < block_start_offsets.size() && block_start_offsets[next_block_index] == offset;
+        if (is_block_start) {
+            ++next_block_index;
+            is_emitting = true;
+            compiler.m_block_native_offsets.set(offset, compiler.m_assembler.current_offset());
+        }
+
+        if (!is_emitting)
+            continue;
+
+        auto native_offset = compiler.m_assembler.current_offset();
+        auto& instruction = *it;
+        if (!compiler.compile_instruction(instruction, offset)) {
+            compiler.emit_exit(offset);
+            is_emitting = false;
+            continue;
+        }
+
+        // NOTE: Only blocks that do at least some work natively are worth entering from the interpreter.
+        if (is_block_start)
+            compiler.m_entry_points.set(offset, native_offset);
+
+        switch (instruction.type()) {
+        case Bytecode::Instruction::Type::Jump:
+        case Bytecode::Instruction::Type::JumpIf:
+#define CASE_JUMP_COMPARISON_OP(op_TitleCase, ...) case Bytecode::Instruction::Type::Jump##op_TitleCase:
+            JS_ENUMERATE_COMPARISON_OPS(CASE_JUMP_COMPARISON_OP)
+#undef CASE_JUMP_COMPARISON_OP
+            is_emitting = false;
+            break;
+        default:
+            break;
+        }
+    }
+
+    // Running off the end of the bytecode is not possible, but be defensive about it.
+    if (is_emitting)
+        compiler.emit_exit(executable.bytecode.size());
+
+    for (auto& jump : compiler.m_pending_jumps) {
+        auto target = compiler.m_block_native_offsets.get(jump.bytecode_offset);
+        if (!target.has_value()) {
+            compiler.m_assembler.link_to_here(jump.jump);
+            compiler.emit_exit(jump.bytecode_offset);
+        } else if (*target <= jump.jump.offset_of_rel32) {
+            // NOTE: Backward jumps are loop back-edges, so check in with the sampling profiler before taking them.
+            compiler.m_assembler.link_to_here(jump.jump);
+            compiler.emit_sampling_safe_point(jump.bytecode_offset);
+            compiler.m_assembler.link(compiler.m_assembler.jump(), *target);
+        } else {
+            compiler.m_assembler.link(jump.jump, *target);
+        }
+    }
+
+    // NOTE: This comes after linking the jumps, since the sampling safe points on back-edges add exits of their own.
+    for (auto& exit : compiler.m_pending_exits) {
+        compiler.m_assembler.link_to_here(exit.jump);
+        compiler.emit_exit(exit.bytecode_offset);
+    }
+
+    if (compiler.m_entry_points.is_empty())
+        return nullptr;
+
+    auto native_executable = NativeExecutable::create(compiler.m_output.span(), move(compiler.m_entry_points));
+    dbgln_if(JS_BYTECODE_DEBUG, "JIT: Compiled \"{}\" ({} bytes of bytecode) to {} bytes of native code", executable.name, executable.bytecode.size(), compiler.m_output.size());
+    return native_executable;
+#else
+    (void)executable;
+    return nullptr;
+#endif
+}
+
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/OwnPtr.h>
+#include <AK/Vector.h>
+#include <LibJS/Bytecode/Operand.h>
+#include <LibJIT/Assembler.h>
+#include <LibJS/Forward.h>
+#include <LibJS/JIT/NativeExecutable.h>
+
+namespace JS::JIT {
+
+using ::JIT::Assembler;
+
+// Single-pass baseline compiler from bytecode to x86-64 machine code.
+//
+// Every instruction the compiler understands is lowered to its fast path only
+// (int32 arithmetic and comparisons, boolean/int32 branches, and property/global
+// loads that hit the executable's existing inline caches). Whenever a fast path
+// does not apply, the native code exits *before* the instruction has had any
+// side effects, returning its bytecode offset so the interpreter can execute it
+// in full. Unsupported instructions always exit to the interpreter.
+//
+// Loop back-edges also exit when the sampling profiler has requested a sample,
+// since samples are only ever taken by the interpreter.
+class Compiler {
+public:
+    static OwnPtr<NativeExecutable> compile(Bytecode::Executable&, VM&);
+
+private:
+    Compiler(Bytecode::Executable& executable, VM& vm)
+        : m_executable(executable)
+        , m_vm(vm)
+        , m_assembler(m_output)
+    {
+    }
+
+    bool compile_instruction(Bytecode::Instruction const&, size_t offset);
+
+    void emit_prologue_and_epilogue();
+    void emit_exit(size_t bytecode_offset);
+    void emit_jump_to_bytecode_offset(size_t bytecode_offset);
+    void emit_exit_if(Assembler::Condition, size_t bytecode_offset);
+    void emit_sampling_safe_point(size_t bytecode_offset);
+
+    void load_operand(Assembler::Reg, Bytecode::Operand);
+    void store_operand(Bytecode::Operand, Assembler::Reg);
+    void load_int32_operand_or_exit(Assembler::Reg, Bytecode::Operand, size_t bytecode_offset);
+    void store_int32_result(Bytecode::Operand, Assembler::Reg);
+    void store_boolean_result_if(Assembler::Condition, Bytecode::Operand);
+    void test_truthiness_or_exit(Bytecode::Operand, size_t bytecode_offset);
+    void call_helper(FlatPtr helper, void const* instruction, size_t bytecode_offset);
+
+    struct PendingExit {
+        Assembler::Jump jump;
+        size_t bytecode_offset { 0 };
+    };
+
+    Bytecode::Executable& m_executable;
+    VM& m_vm;
+    Vector<u8> m_output;
+    Assembler m_assembler;
+
+    size_t m_epilogue_offset { 0 };
+    HashMap<size_t, size_t> m_block_native_offsets;
+    HashMap<size_t, size_t> m_entry_points;
+    Vector<PendingExit> m_pending_exits;
+    Vector<PendingExit> m_pending_jumps;
+};
+
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Format.h>
+#include <LibJS/JIT/NativeExecutable.h>
+#include <sys/mman.h>
+
+namespace JS::JIT {
+
+using EntryTrampoline = size_t (*)(Value* registers, Bytecode::Interpreter* interpreter, void const* native_entry);
+
+OwnPtr<NativeExecutable> NativeExecutable::create(ReadonlyBytes code, HashMap<size_t, size_t> entry_points)
+{
+    if (code.is_empty())
+        return nullptr;
+
+    auto* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (memory == MAP_FAILED) {
+        dbgln("JIT: Failed to allocate {} bytes for native code", code.size());
+        return nullptr;
+    }
+
+    memcpy(memory, code.data(), code.size());
+
+    // NOTE: We never keep native code writable and executable at the same time.
+    if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) < 0) {
+        perror("mprotect");
+        munmap(memory, code.size());
+        return nullptr;
+    }
+
+    return adopt_own(*new NativeExecutable(memory, code.size(), move(entry_points)));
+}
+
+NativeExecutable::NativeExecutable(void* code, size_t size, HashMap<size_t, size_t> entry_points)
+    : m_code(code)
+    , m_size(size)
+    , m_entry_points(move(entry_points))
+{
+}
+
+NativeExecutable::~NativeExecutable()
+{
+    if (munmap(m_code, m_size) < 0) {
+        perror("munmap");
+        VERIFY_NOT_REACHED();
+    }
+}
+
+size_t NativeExecutable::run(Value* registers, Bytecode::Interpreter& interpreter, size_t native_offset) const
+{
+    VERIFY(native_offset < m_size);
+    // NOTE: The trampoline that saves callee-saved registers and jumps to the requested entry is always at offset 0.
+    auto trampoline = reinterpret_cast<EntryTrampoline>(m_code);
+    return trampoline(registers, &interpreter, static_cast<u8 const*>(m_code) + native_offset);
+}
+
+}
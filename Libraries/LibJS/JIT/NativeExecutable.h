@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/OwnPtr.h>
+#include <AK/Span.h>
+#include <LibJS/Forward.h>
+
+namespace JS::JIT {
+
+// Machine code produced by the baseline compiler for one Bytecode::Executable.
+// Native code can only be entered at the start of a basic block, and always hands
+// control back to the interpreter by returning the bytecode offset to resume at.
+class NativeExecutable {
+    AK_MAKE_NONCOPYABLE(NativeExecutable);
+    AK_MAKE_NONMOVABLE(NativeExecutable);
+
+public:
+    static OwnPtr<NativeExecutable> create(ReadonlyBytes code, HashMap<size_t, size_t> entry_points);
+    ~NativeExecutable();
+
+    [[nodiscard]] Optional<size_t> native_offset_for_entry_point(size_t bytecode_offset) const { return m_entry_points.get(bytecode_offset); }
+
+    // Runs native code starting at `native_offset` and returns the bytecode offset the interpreter should continue at.
+    [[nodiscard]] size_t run(Value* registers, Bytecode::Interpreter&, size_t native_offset) const;
+
+    [[nodiscard]] size_t code_size() const { return m_size; }
+
+private:
+    NativeExecutable(void* code, size_t size, HashMap<size_t, size_t> entry_points);
+
+    void* m_code { nullptr };
+    size_t m_size { 0 };
+    HashMap<size_t, size_t> m_entry_points;
+};
+
+}
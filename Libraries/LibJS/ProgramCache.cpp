@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/ProgramCache.h>
+
+namespace JS {
+
+RefPtr<Program> ProgramCache::find(StringView filename, StringView source_text, Program::Type type, size_t line_number_offset)
+{
+    if (source_text.length() < minimum_source_length)
+        return {};
+
+    Key key { filename, type, line_number_offset, source_text.hash() };
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return {};
+
+    // NOTE: The hash only narrows things down, the source text has to match exactly.
+    if (it->value.source_text != source_text)
+        return {};
+
+    // Move the entry to the back, so the least recently used entry is evicted first.
+    auto entry = m_entries.take(key).release_value();
+    auto program = entry.program;
+    m_entries.set(move(key), move(entry));
+    return program;
+}
+
+void ProgramCache::add(StringView filename, StringView source_text, Program::Type type, size_t line_number_offset, NonnullRefPtr<Program> program)
+{
+    if (source_text.length() < minimum_source_length || source_text.length() > maximum_total_source_length)
+        return;
+
+    Key key { filename, type, line_number_offset, source_text.hash() };
+    if (auto existing_entry = m_entries.take(key); existing_entry.has_value())
+        m_total_source_length -= existing_entry->source_text.length();
+
+    while (!m_entries.is_empty() && m_total_source_length + source_text.length() > maximum_total_source_length)
+        m_total_source_length -= m_entries.take_first().source_text.length();
+
+    m_total_source_length += source_text.length();
+    m_entries.set(move(key), { source_text, move(program) });
+}
+
+void ProgramCache::clear()
+{
+    m_entries.clear();
+    m_total_source_length = 0;
+}
+
+}
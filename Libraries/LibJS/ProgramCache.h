@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/ByteString.h>
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <LibJS/AST.h>
+#include <LibJS/Export.h>
+
+namespace JS {
+
+// Keeps the ASTs of recently parsed large scripts and modules around, keyed by filename (i.e. URL) and source
+// text, so that loading the same source again (e.g. on the next navigation to the same site) can skip lexing
+// and parsing. Only the AST is shared between realms: a FunctionNode hands out its SharedFunctionInstanceData (and
+// with it, the generated bytecode and its caches) only to functions created in the realm that generated it.
+class JS_API ProgramCache {
+    AK_MAKE_NONCOPYABLE(ProgramCache);
+    AK_MAKE_NONMOVABLE(ProgramCache);
+
+public:
+    // Sources smaller than this are cheap enough to parse that caching them isn't worth the memory.
+    static constexpr size_t minimum_source_length = 16 * KiB;
+    static constexpr size_t maximum_total_source_length = 16 * MiB;
+
+    struct Key {
+        ByteString filename;
+        Program::Type type { Program::Type::Script };
+        size_t line_number_offset { 1 };
+        u32 source_hash { 0 };
+
+        bool operator==(Key const&) const = default;
+    };
+
+    ProgramCache() = default;
+
+    RefPtr<Program> find(StringView filename, StringView source_text, Program::Type, size_t line_number_offset);
+    void add(StringView filename, StringView source_text, Program::Type, size_t line_number_offset, NonnullRefPtr<Program>);
+
+    void clear();
+
+private:
+    struct Entry {
+        ByteString source_text;
+        NonnullRefPtr<Program> program;
+    };
+
+    OrderedHashMap<Key, Entry> m_entries;
+    size_t m_total_source_length { 0 };
+};
+
+}
+
+template<>
+struct AK::Traits<JS::ProgramCache::Key> : public AK::DefaultTraits<JS::ProgramCache::Key> {
+    static unsigned hash(JS::ProgramCache::Key const& key)
+    {
+        return pair_int_hash(pair_int_hash(key.filename.hash(), key.source_hash), pair_int_hash(to_underlying(key.type), key.line_number_offset));
+    }
+};
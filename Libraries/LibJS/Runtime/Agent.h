@@ -39,6 +39,6 @@ private:
     CanBlock m_can_block { false };
 };
 
-bool agent_can_suspend(VM const&);
+JS_API bool agent_can_suspend(VM const&);
 
 }
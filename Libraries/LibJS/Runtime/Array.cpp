@@ -169,7 +169,7 @@ ThrowCompletionOr<bool> Array::set_length(PropertyDescriptor const& property_des
 }
 
 // 23.1.3.30.1 SortIndexedProperties ( obj, len, SortCompare, holes ), https://tc39.es/ecma262/#sec-sortindexedproperties
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes)
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object const& object, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, DefaultArraySortCompare default_sort_compare)
 {
     // 1. Let items be a new empty List.
     auto items = GC::RootVector<Value> { vm.heap() };
@@ -210,11 +210,11 @@ ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM& vm, Object
 
     // 4. Sort items using an implementation-defined sequence of calls to SortCompare. If any such call returns an abrupt completion, stop before performing any further calls to SortCompare or steps in this algorithm and return that Completion Record.
 
-    // Perform sorting by merge sort. This isn't as efficient compared to quick sort, but
-    // quicksort can't be used in all cases because the spec requires Array.prototype.sort()
-    // to be stable. FIXME: when initially scanning through the array, maintain a flag
-    // for if an unstable sort would be indistinguishable from a stable sort (such as just
-    // just strings or numbers), and in that case use quick sort instead for better performance.
+    // OPTIMIZATION: Sort primitives by their string values natively, instead of converting them for every comparison.
+    if (default_sort_compare == DefaultArraySortCompare::Yes && array_sort_primitives_by_default_comparator(vm, items))
+        return items;
+
+    // Perform sorting by merge sort, since the spec requires Array.prototype.sort() to be stable.
     TRY(array_merge_sort(vm, sort_compare, items));
 
     // 5. Return items.
@@ -403,6 +403,8 @@ ThrowCompletionOr<bool> Array::internal_define_own_property(PropertyKey const& p
                     return false;
             }
 
+            // NOTE: Storing into the storage directly bypasses IndexedProperties::put(), so we have to do the write barrier ourselves.
+            write_barrier();
             storage->put(property_key.as_number(), property_descriptor.value.value());
         } else {
             succeeded = MUST(Object::internal_define_own_property(property_key, property_descriptor, precomputed_get_own_property));
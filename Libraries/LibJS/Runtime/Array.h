@@ -23,6 +23,7 @@ namespace JS {
 class JS_API Array : public Object {
     JS_OBJECT(Array, Object);
     GC_DECLARE_ALLOCATOR(Array);
+    GC_DECLARE_WRITE_BARRIERS(Array);
 
 public:
     static ThrowCompletionOr<GC::Ref<Array>> create(Realm&, u64 length, Object* prototype = nullptr);
@@ -85,7 +86,13 @@ enum class Holes {
     ReadThroughHoles,
 };
 
-ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes);
+// Whether SortCompare is CompareArrayElements without a comparefn, which allows sorting without calling it.
+enum class DefaultArraySortCompare {
+    No,
+    Yes,
+};
+
+ThrowCompletionOr<GC::RootVector<Value>> sort_indexed_properties(VM&, Object const&, size_t length, Function<ThrowCompletionOr<double>(Value, Value)> const& sort_compare, Holes holes, DefaultArraySortCompare = DefaultArraySortCompare::No);
 ThrowCompletionOr<double> compare_array_elements(VM&, Value x, Value y, FunctionObject* comparefn);
 
 }
@@ -96,6 +96,9 @@ public:
 
     void detach_buffer() { m_data_block.byte_buffer = Empty {}; }
 
+    // Whether [[ArrayBufferData]] is borrowed from the embedder, e.g. a WebAssembly memory, rather than owned by this buffer.
+    bool has_unowned_data() const { return m_data_block.byte_buffer.has<DataBlock::UnownedFixedLengthByteBuffer>(); }
+
     // 25.1.3.4 IsDetachedBuffer ( arrayBuffer ), https://tc39.es/ecma262/#sec-isdetachedbuffer
     bool is_detached() const
     {
@@ -31,6 +31,27 @@ GC_DEFINE_ALLOCATOR(ArrayPrototype);
 
 static HashTable<GC::Ref<Object>> s_array_join_seen_objects;
 
+// OPTIMIZATION: Returns `object` as an Array whose elements can be accessed directly in its simple storage, which is
+// the case if it:
+// - is not a proxy target, which means get/set/has will not trap.
+// - has intact prototype chain, which means we don't have to worry about getters/setters potentially defined for holes.
+// - has simple storage type, which means all elements are data properties with default attributes.
+static Array* array_with_directly_accessible_elements(Object& object)
+{
+    auto* array = as_if<Array>(object);
+    if (!array || array->is_proxy_target() || !array->default_prototype_chain_intact())
+        return nullptr;
+    auto const* storage = array->indexed_properties().storage();
+    if (!storage || !storage->is_simple_storage())
+        return nullptr;
+    return array;
+}
+
+static SimpleIndexedPropertyStorage const& simple_storage_of(Array const& array)
+{
+    return static_cast<SimpleIndexedPropertyStorage const&>(*array.indexed_properties().storage());
+}
+
 ArrayPrototype::ArrayPrototype(Realm& realm)
     : Array(realm, realm.intrinsics().object_prototype())
 {
@@ -381,6 +402,17 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::fill)
     else
         to = min(relative_end, length);
 
+    // OPTIMIZATION: Elements of an extensible Array with directly accessible elements are writable data properties (or
+    //               can be created), so we can store the value without going through [[Set]]. This only holds below
+    //               the array's current length though: start and end were converted after we read the length, which
+    //               may have shrunk the array (and made its length non-writable) in the meantime.
+    if (auto* array = array_with_directly_accessible_elements(this_object);
+        array && to <= array->indexed_properties().array_like_size() && TRY(array->is_extensible())) {
+        for (u64 i = from; i < to; i++)
+            array->indexed_properties().put(i, vm.argument(0));
+        return this_object;
+    }
+
     for (u64 i = from; i < to; i++)
         TRY(this_object->set(i, vm.argument(0), Object::ShouldThrowExceptions::Yes));
 
@@ -744,6 +776,41 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::includes)
             from_index = from_argument;
     }
     auto value_to_find = vm.argument(0);
+
+    // OPTIMIZATION: Search the elements directly if we can, since SameValueZero has no side effects.
+    if (auto* array = array_with_directly_accessible_elements(this_object)) {
+        auto const& storage = simple_storage_of(*array);
+        auto const& elements = storage.elements();
+        auto end = min(length, storage.array_like_size());
+
+        if (storage.element_kind() != SimpleIndexedPropertyStorage::ElementKind::Generic && value_to_find.is_number()) {
+            // Every element is a number (or a hole, which can't match a number).
+            auto number_to_find = value_to_find.as_double();
+            bool is_nan = isnan(number_to_find);
+            for (u64 i = from_index; i < end; ++i) {
+                auto element = elements[i];
+                if (element.is_special_empty_value())
+                    continue;
+                auto number = element.as_double();
+                if (number == number_to_find || (is_nan && isnan(number)))
+                    return Value(true);
+            }
+            return Value(false);
+        }
+
+        for (u64 i = from_index; i < end; ++i) {
+            auto element = elements[i];
+            // NOTE: Holes read as undefined, since there's nothing on the prototype chain.
+            if (element.is_special_empty_value())
+                element = js_undefined();
+            if (same_value_zero(element, value_to_find))
+                return Value(true);
+        }
+
+        // NOTE: The array may have shrunk while we were converting fromIndex, in which case the rest read as undefined.
+        return Value(end < length && value_to_find.is_undefined());
+    }
+
     for (u64 i = from_index; i < length; ++i) {
         auto element = TRY(this_object->get(i));
         if (same_value_zero(element, value_to_find))
@@ -797,6 +864,45 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::index_of)
         k = max(length + n, 0);
     }
 
+    // OPTIMIZATION: Search the elements directly if we can, since IsStrictlyEqual has no side effects and holes are
+    //               simply not present.
+    if (auto* array = array_with_directly_accessible_elements(object)) {
+        auto const& storage = simple_storage_of(*array);
+        auto const& elements = storage.elements();
+        auto end = min(length, storage.array_like_size());
+
+        auto element_kind = storage.element_kind();
+        if (element_kind == SimpleIndexedPropertyStorage::ElementKind::Int32 && search_element.is_int32()) {
+            auto value_to_find = search_element.as_i32();
+            for (; k < end; ++k) {
+                auto element = elements[k];
+                if (element.is_int32() && element.as_i32() == value_to_find)
+                    return Value(k);
+            }
+            return Value(-1);
+        }
+
+        if (element_kind != SimpleIndexedPropertyStorage::ElementKind::Generic) {
+            // Every element is a number (or a hole), so nothing but a number can be found.
+            if (!search_element.is_number())
+                return Value(-1);
+            auto number_to_find = search_element.as_double();
+            for (; k < end; ++k) {
+                auto element = elements[k];
+                if (!element.is_special_empty_value() && element.as_double() == number_to_find)
+                    return Value(k);
+            }
+            return Value(-1);
+        }
+
+        for (; k < end; ++k) {
+            auto element = elements[k];
+            if (!element.is_special_empty_value() && is_strictly_equal(search_element, element))
+                return Value(k);
+        }
+        return Value(-1);
+    }
+
     // 10. Repeat, while k < len,
     for (; k < length; ++k) {
         auto property_key = PropertyKey { k };
@@ -1354,60 +1460,121 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::some)
     return Value(false);
 }
 
-ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
+// Sorts `items` stably, using `scratch` as temporary storage of the same size. `is_greater_than` returns whether its first
+// argument has to be placed after its second one.
+template<typename T, typename IsGreaterThan>
+static ThrowCompletionOr<void> stable_merge_sort(Span<T> items, Span<T> scratch, IsGreaterThan is_greater_than)
 {
-    // FIXME: it would probably be better to switch to insertion sort for small arrays for
-    // better performance
-    if (arr_to_sort.size() <= 1)
-        return {};
-
-    GC::RootVector<Value> left(vm.heap());
-    GC::RootVector<Value> right(vm.heap());
-
-    left.ensure_capacity(arr_to_sort.size() / 2);
-    right.ensure_capacity(arr_to_sort.size() / 2 + (arr_to_sort.size() & 1));
-
-    for (size_t i = 0; i < arr_to_sort.size(); ++i) {
-        if (i < arr_to_sort.size() / 2) {
-            left.append(arr_to_sort[i]);
-        } else {
-            right.append(arr_to_sort[i]);
+    VERIFY(scratch.size() == items.size());
+
+    // NOTE: Short runs are sorted with insertion sort first, since merging them takes more comparisons.
+    static constexpr size_t insertion_sort_run_size = 8;
+
+    for (size_t run_start = 0; run_start < items.size(); run_start += insertion_sort_run_size) {
+        auto run_end = min(run_start + insertion_sort_run_size, items.size());
+        for (size_t i = run_start + 1; i < run_end; ++i) {
+            for (size_t j = i; j > run_start; --j) {
+                if (!TRY(is_greater_than(items[j - 1], items[j])))
+                    break;
+                swap(items[j - 1], items[j]);
+            }
         }
     }
 
-    TRY(array_merge_sort(vm, compare_func, left));
-    TRY(array_merge_sort(vm, compare_func, right));
+    auto source = items;
+    auto destination = scratch;
 
-    arr_to_sort.clear();
+    for (size_t width = insertion_sort_run_size; width < items.size(); width *= 2) {
+        for (size_t left = 0; left < items.size(); left += 2 * width) {
+            auto middle = min(left + width, items.size());
+            auto right_end = min(left + 2 * width, items.size());
 
-    size_t left_index = 0, right_index = 0;
+            // If the runs are already in order, there's nothing to merge.
+            if (middle == right_end || !TRY(is_greater_than(source[middle - 1], source[middle]))) {
+                source.slice(left, right_end - left).copy_to(destination.slice(left));
+                continue;
+            }
 
-    while (left_index < left.size() && right_index < right.size()) {
-        auto x = left[left_index];
-        auto y = right[right_index];
+            size_t left_index = left;
+            size_t right_index = middle;
+            size_t destination_index = left;
 
-        double comparison_result = TRY(compare_func(x, y));
+            while (left_index < middle && right_index < right_end) {
+                if (TRY(is_greater_than(source[left_index], source[right_index])))
+                    destination[destination_index++] = source[right_index++];
+                else
+                    destination[destination_index++] = source[left_index++];
+            }
 
-        if (comparison_result <= 0) {
-            arr_to_sort.append(x);
-            left_index++;
-        } else {
-            arr_to_sort.append(y);
-            right_index++;
+            while (left_index < middle)
+                destination[destination_index++] = source[left_index++];
+
+            while (right_index < right_end)
+                destination[destination_index++] = source[right_index++];
         }
+
+        swap(source, destination);
     }
 
-    while (left_index < left.size()) {
-        arr_to_sort.append(left[left_index]);
-        left_index++;
+    if (source.data() != items.data())
+        source.copy_to(items);
+
+    return {};
+}
+
+ThrowCompletionOr<void> array_merge_sort(VM& vm, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort)
+{
+    GC::RootVector<Value> scratch(vm.heap());
+    scratch.resize(arr_to_sort.size());
+
+    return stable_merge_sort(arr_to_sort.span(), scratch.span(), [&](Value x, Value y) -> ThrowCompletionOr<bool> {
+        return TRY(compare_func(x, y)) > 0;
+    });
+}
+
+// OPTIMIZATION: If `items` only contains primitives that can be converted to strings without side effects, sorting them by
+//               CompareArrayElements without a comparefn can be done natively on strings that are computed once per item.
+//               Returns false if that's not the case, in which case `items` is left untouched.
+bool array_sort_primitives_by_default_comparator(VM& vm, GC::RootVector<Value>& items)
+{
+    for (auto item : items) {
+        if (item.is_object() || item.is_symbol())
+            return false;
     }
 
-    while (right_index < right.size()) {
-        arr_to_sort.append(right[right_index]);
-        right_index++;
+    GC::RootVector<Value> defined_items(vm.heap());
+    GC::RootVector<Value> keys(vm.heap());
+    defined_items.ensure_capacity(items.size());
+    keys.ensure_capacity(items.size());
+
+    // NOTE: Undefined is placed after everything else.
+    for (auto item : items) {
+        if (item.is_undefined())
+            continue;
+        defined_items.unchecked_append(item);
+        keys.unchecked_append(item.is_string() ? item : PrimitiveString::create(vm, MUST(item.to_string(vm))));
     }
 
-    return {};
+    Vector<u32> order;
+    order.ensure_capacity(defined_items.size());
+    for (u32 i = 0; i < defined_items.size(); ++i)
+        order.unchecked_append(i);
+
+    Vector<u32> scratch;
+    scratch.resize(order.size());
+
+    MUST(stable_merge_sort(order.span(), scratch.span(), [&](u32 x, u32 y) -> ThrowCompletionOr<bool> {
+        return keys[y].as_string().utf16_string_view().is_code_unit_less_than(keys[x].as_string().utf16_string_view());
+    }));
+
+    auto undefined_count = items.size() - defined_items.size();
+    items.clear_with_capacity();
+    for (auto index : order)
+        items.unchecked_append(defined_items[index]);
+    for (size_t i = 0; i < undefined_count; ++i)
+        items.unchecked_append(js_undefined());
+
+    return true;
 }
 
 // 23.1.3.30 Array.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-array.prototype.sort
@@ -1431,7 +1598,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::sort)
     };
 
     // 5. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, skip-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::SkipHoles, comparefn.is_undefined() ? DefaultArraySortCompare::Yes : DefaultArraySortCompare::No));
 
     // 6. Let itemCount be the number of elements in sortedList.
     auto item_count = sorted_list.size();
@@ -1739,7 +1906,7 @@ JS_DEFINE_NATIVE_FUNCTION(ArrayPrototype::to_sorted)
     };
 
     // 6. Let sortedList be ? SortIndexedProperties(obj, len, SortCompare, read-through-holes).
-    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles));
+    auto sorted_list = TRY(sort_indexed_properties(vm, object, length, sort_compare, Holes::ReadThroughHoles, comparefn.is_undefined() ? DefaultArraySortCompare::Yes : DefaultArraySortCompare::No));
 
     // 7. Let j be 0.
     // 8. Repeat, while j < len,
@@ -65,5 +65,6 @@ private:
 };
 
 ThrowCompletionOr<void> array_merge_sort(VM&, Function<ThrowCompletionOr<double>(Value, Value)> const& compare_func, GC::RootVector<Value>& arr_to_sort);
+bool array_sort_primitives_by_default_comparator(VM&, GC::RootVector<Value>& items);
 
 }
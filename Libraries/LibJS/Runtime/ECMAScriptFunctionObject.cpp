@@ -119,7 +119,7 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create_from_function
         break;
     }
 
-    auto shared_data = function_node.shared_data();
+    auto shared_data = function_node.shared_data(realm);
 
     if (!shared_data) {
         shared_data = realm->heap().allocate<SharedFunctionInstanceData>(
@@ -134,7 +134,7 @@ GC::Ref<ECMAScriptFunctionObject> ECMAScriptFunctionObject::create_from_function
             function_node.is_arrow_function(),
             function_node.parsing_insights(),
             function_node.local_variables_names());
-        function_node.set_shared_data(shared_data);
+        function_node.set_shared_data(realm, shared_data);
     }
 
     return realm->create<ECMAScriptFunctionObject>(
@@ -151,7 +151,7 @@ SharedFunctionInstanceData::SharedFunctionInstanceData(
     i32 function_length,
     NonnullRefPtr<FunctionParameters const> formal_parameters,
     NonnullRefPtr<Statement const> ecmascript_code,
-    ByteString source_text,
+    SourceText source_text,
     bool strict,
     bool is_arrow_function,
     FunctionParsingInsights const& parsing_insights,
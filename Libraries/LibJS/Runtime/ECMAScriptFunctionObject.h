@@ -48,7 +48,7 @@ public:
         i32 function_length,
         NonnullRefPtr<FunctionParameters const>,
         NonnullRefPtr<Statement const> ecmascript_code,
-        ByteString source_text,
+        SourceText source_text,
         bool strict,
         bool is_arrow_function,
         FunctionParsingInsights const&,
@@ -60,7 +60,7 @@ public:
     RefPtr<Statement const> m_ecmascript_code;            // [[ECMAScriptCode]]
 
     Utf16FlyString m_name;
-    ByteString m_source_text; // [[SourceText]]
+    SourceText m_source_text; // [[SourceText]]
 
     Vector<LocalVariable> m_local_variables_names;
 
@@ -161,8 +161,8 @@ public:
     Object* home_object() const { return m_home_object; }
     void set_home_object(Object* home_object) { m_home_object = home_object; }
 
-    [[nodiscard]] ByteString const& source_text() const { return shared_data().m_source_text; }
-    void set_source_text(ByteString source_text) { const_cast<SharedFunctionInstanceData&>(shared_data()).m_source_text = move(source_text); }
+    [[nodiscard]] ByteString const& source_text() const { return shared_data().m_source_text.to_byte_string(); }
+    void set_source_text(SourceText source_text) { const_cast<SharedFunctionInstanceData&>(shared_data()).m_source_text = move(source_text); }
 
     Vector<ClassFieldDefinition> const& fields() const { return ensure_class_data().fields; }
     void add_field(ClassFieldDefinition field) { ensure_class_data().fields.append(move(field)); }
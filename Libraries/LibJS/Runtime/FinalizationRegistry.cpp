@@ -51,7 +51,7 @@ void FinalizationRegistry::remove_dead_cells(Badge<GC::Heap>)
 {
     auto any_cells_were_removed = false;
     for (auto& record : m_records) {
-        if (!record.target || record.target->state() == Cell::State::Live)
+        if (!record.target || record.target->is_marked())
             continue;
         record.target = nullptr;
         any_cells_were_removed = true;
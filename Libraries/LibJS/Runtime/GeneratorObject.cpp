@@ -13,6 +13,7 @@
 #include <LibJS/Runtime/GeneratorResult.h>
 #include <LibJS/Runtime/GlobalObject.h>
 #include <LibJS/Runtime/Iterator.h>
+#include <LibJS/Runtime/NativeFunction.h>
 
 namespace JS {
 
@@ -54,6 +55,28 @@ void GeneratorObject::visit_edges(Cell::Visitor& visitor)
     m_execution_context->visit_edges(visitor);
 }
 
+BuiltinIterator* GeneratorObject::as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const& iterator_record)
+{
+    if (iterator_record.next_method.is_object()) {
+        auto const& next_function = iterator_record.next_method.as_object();
+        if (next_function.is_native_function()) {
+            auto const& native_function = static_cast<NativeFunction const&>(next_function);
+            if (native_function.is_generator_prototype_next_builtin())
+                return this;
+        }
+    }
+    return nullptr;
+}
+
+// OPTIMIZATION: This is %GeneratorPrototype%.next() without creating an iterator result object for the caller to unpack.
+ThrowCompletionOr<void> GeneratorObject::next(VM& vm, bool& done, Value& value)
+{
+    auto iteration_result = TRY(resume(vm, js_undefined(), {}));
+    done = iteration_result.done;
+    value = iteration_result.value;
+    return {};
+}
+
 // 27.5.3.2 GeneratorValidate ( generator, generatorBrand ), https://tc39.es/ecma262/#sec-generatorvalidate
 ThrowCompletionOr<GeneratorObject::GeneratorState> GeneratorObject::validate(VM& vm, Optional<StringView> const& generator_brand)
 {
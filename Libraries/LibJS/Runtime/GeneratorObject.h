@@ -8,11 +8,13 @@
 
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/Iterator.h>
 #include <LibJS/Runtime/Object.h>
 
 namespace JS {
 
-class GeneratorObject : public Object {
+class GeneratorObject : public Object
+    , public BuiltinIterator {
     JS_OBJECT(GeneratorObject, Object);
     GC_DECLARE_ALLOCATOR(GeneratorObject);
 
@@ -45,6 +47,10 @@ public:
     GeneratorState generator_state() const { return m_generator_state; }
     void set_generator_state(GeneratorState generator_state) { m_generator_state = generator_state; }
 
+    virtual BuiltinIterator* as_builtin_iterator_if_next_is_not_redefined(IteratorRecord const&) override;
+    virtual ThrowCompletionOr<void> next(VM&, bool& done, Value& value) override;
+    virtual bool has_return_method() const override { return true; }
+
 protected:
     GeneratorObject(Realm&, Object& prototype, NonnullOwnPtr<ExecutionContext>, Optional<StringView> generator_brand = {});
 
@@ -21,7 +21,7 @@ void GeneratorPrototype::initialize(Realm& realm)
     auto& vm = this->vm();
     Base::initialize(realm);
     u8 attr = Attribute::Writable | Attribute::Configurable;
-    define_native_function(realm, vm.names.next, next, 1, attr);
+    define_native_function(realm, vm.names.next, next, 1, attr, Bytecode::Builtin::GeneratorPrototypeNext);
     define_native_function(realm, vm.names.return_, return_, 1, attr);
     define_native_function(realm, vm.names.throw_, throw_, 1, attr);
 
@@ -30,14 +30,21 @@ void GeneratorPrototype::initialize(Realm& realm)
 }
 
 // 27.5.1.2 Generator.prototype.next ( value ), https://tc39.es/ecma262/#sec-generator.prototype.next
-JS_DEFINE_NATIVE_FUNCTION(GeneratorPrototype::next)
+ThrowCompletionOr<Value> GeneratorPrototype::next_impl(VM& vm, Value this_value, Value value)
 {
     // 1. Return ? GeneratorResume(this value, value, empty).
-    auto generator_object = TRY(typed_this_object(vm));
-    auto iteration_result = TRY(generator_object->resume(vm, vm.argument(0), {}));
+    auto this_object = TRY(this_value.to_object(vm));
+    if (!is<GeneratorObject>(*this_object))
+        return vm.throw_completion<TypeError>(ErrorType::NotAnObjectOfType, display_name());
+    auto iteration_result = TRY(static_cast<GeneratorObject&>(*this_object).resume(vm, value, {}));
     return create_iterator_result_object(vm, iteration_result.value, iteration_result.done);
 }
 
+JS_DEFINE_NATIVE_FUNCTION(GeneratorPrototype::next)
+{
+    return next_impl(vm, vm.this_value(), vm.argument(0));
+}
+
 // 27.5.1.3 Generator.prototype.return ( value ), https://tc39.es/ecma262/#sec-generator.prototype.return
 JS_DEFINE_NATIVE_FUNCTION(GeneratorPrototype::return_)
 {
@@ -20,6 +20,8 @@ public:
     virtual void initialize(Realm&) override;
     virtual ~GeneratorPrototype() override = default;
 
+    static ThrowCompletionOr<Value> next_impl(VM&, Value this_value, Value value);
+
 private:
     explicit GeneratorPrototype(Realm&);
 
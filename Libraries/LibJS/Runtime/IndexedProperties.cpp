@@ -17,6 +17,8 @@ SimpleIndexedPropertyStorage::SimpleIndexedPropertyStorage(Vector<Value>&& initi
     : IndexedPropertyStorage(IsSimpleStorage::Yes, initial_values.size())
     , m_packed_elements(move(initial_values))
 {
+    for (auto value : m_packed_elements)
+        widen_element_kind_if_needed(value);
 }
 
 bool SimpleIndexedPropertyStorage::has_index(u32 index) const
@@ -59,6 +61,7 @@ void SimpleIndexedPropertyStorage::put(u32 index, Value value, PropertyAttribute
     if (value.is_special_empty_value()) {
         ++m_number_of_empty_elements;
     }
+    widen_element_kind_if_needed(value);
 }
 
 void SimpleIndexedPropertyStorage::remove(u32 index)
@@ -96,6 +99,8 @@ bool SimpleIndexedPropertyStorage::set_array_like_size(size_t new_size)
     auto old_size = m_array_size;
     m_array_size = new_size;
     m_packed_elements.resize_with_default_value_and_keep_capacity(new_size, js_special_empty_value());
+    if (new_size == 0)
+        m_element_kind = ElementKind::Int32;
 
     if (old_size <= m_array_size) {
         m_number_of_empty_elements += m_array_size - old_size;
@@ -265,8 +270,18 @@ Optional<ValueAndAttributes> IndexedProperties::get(u32 index) const
     return m_storage->get(index);
 }
 
+void IndexedProperties::set_elements(Vector<Value> values)
+{
+    m_owner.write_barrier();
+    if (values.is_empty())
+        m_storage = nullptr;
+    else
+        m_storage = make<SimpleIndexedPropertyStorage>(move(values));
+}
+
 void IndexedProperties::put(u32 index, Value value, PropertyAttributes attributes)
 {
+    m_owner.write_barrier();
     ensure_storage();
     if (m_storage->is_simple_storage() && (attributes != default_attributes || index > (array_like_size() + SPARSE_ARRAY_HOLE_THRESHOLD))) {
         switch_to_generic_storage();
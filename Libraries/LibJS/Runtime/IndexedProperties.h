@@ -7,6 +7,7 @@
 #pragma once
 
 #include <AK/NonnullOwnPtr.h>
+#include <LibGC/Cell.h>
 #include <LibJS/Export.h>
 #include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/Value.h>
@@ -62,6 +63,15 @@ private:
 
 class SimpleIndexedPropertyStorage final : public IndexedPropertyStorage {
 public:
+    // The most specific kind that describes every element this storage has held. It only ever widens (until the
+    // storage is emptied), so it can be trusted without looking at the elements. Together with has_empty_elements(),
+    // this tells packed and holey arrays of int32s, numbers and arbitrary values apart.
+    enum class ElementKind : u8 {
+        Int32,
+        Number,
+        Generic,
+    };
+
     SimpleIndexedPropertyStorage()
         : IndexedPropertyStorage(IsSimpleStorage::Yes)
     {
@@ -95,13 +105,23 @@ public:
 
     bool has_empty_elements() const { return m_number_of_empty_elements.value() > 0; }
 
+    ElementKind element_kind() const { return m_element_kind; }
+
 private:
     friend GenericIndexedPropertyStorage;
 
     void grow_storage_if_needed();
 
+    void widen_element_kind_if_needed(Value value)
+    {
+        if (m_element_kind == ElementKind::Generic || value.is_int32() || value.is_special_empty_value())
+            return;
+        m_element_kind = value.is_number() ? max(m_element_kind, ElementKind::Number) : ElementKind::Generic;
+    }
+
     Checked<size_t> m_number_of_empty_elements { 0 };
     Vector<Value> m_packed_elements;
+    ElementKind m_element_kind { ElementKind::Int32 };
 };
 
 class GenericIndexedPropertyStorage final : public IndexedPropertyStorage {
@@ -152,15 +172,17 @@ private:
 };
 
 class JS_API IndexedProperties {
-public:
-    IndexedProperties() = default;
+    AK_MAKE_NONCOPYABLE(IndexedProperties);
+    AK_MAKE_NONMOVABLE(IndexedProperties);
 
-    explicit IndexedProperties(Vector<Value> values)
+public:
+    explicit IndexedProperties(GC::Cell& owner)
+        : m_owner(owner)
     {
-        if (!values.is_empty())
-            m_storage = make<SimpleIndexedPropertyStorage>(move(values));
     }
 
+    void set_elements(Vector<Value> values);
+
     bool has_index(u32 index) const { return m_storage ? m_storage->has_index(index) : false; }
     Optional<ValueAndAttributes> get(u32 index) const;
     void put(u32 index, Value value, PropertyAttributes attributes = default_attributes);
@@ -175,6 +197,7 @@ public:
     size_t array_like_size() const { return m_storage ? m_storage->array_like_size() : 0; }
     bool set_array_like_size(size_t);
 
+    // NOTE: Storing into the storage directly bypasses the owner's write barrier, callers have to do that themselves.
     IndexedPropertyStorage* storage() { return m_storage; }
     IndexedPropertyStorage const* storage() const { return m_storage; }
 
@@ -200,6 +223,7 @@ private:
     void switch_to_generic_storage();
     void ensure_storage();
 
+    GC::Cell& m_owner;
     OwnPtr<IndexedPropertyStorage> m_storage;
 };
 
@@ -291,8 +291,8 @@ static Completion iterator_close_impl(VM& vm, IteratorRecord const& iterator_rec
     // 2. Let iterator be iteratorRecord.[[Iterator]].
     auto iterator = iterator_record.iterator;
 
-    // OPTIMIZATION: "return" method is not defined on any of iterators we treat as built-in.
-    if (iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_record))
+    // OPTIMIZATION: "return" method is not defined on most of the iterators we treat as built-in.
+    if (auto* builtin_iterator = iterator->as_builtin_iterator_if_next_is_not_redefined(iterator_record); builtin_iterator && !builtin_iterator->has_return_method())
         return completion;
 
     // 3. Let innerResult be Completion(GetMethod(iterator, "return")).
@@ -75,6 +75,9 @@ class BuiltinIterator {
 public:
     virtual ~BuiltinIterator() = default;
     virtual ThrowCompletionOr<void> next(VM&, bool& done, Value& value) = 0;
+
+    // IteratorClose skips looking up and calling "return" on builtin iterators that don't have such a method.
+    virtual bool has_return_method() const { return false; }
 };
 
 struct IterationResult {
@@ -48,6 +48,7 @@ public:
     bool is_map_prototype_next_builtin() const { return m_builtin.has_value() && *m_builtin == Bytecode::Builtin::MapIteratorPrototypeNext; }
     bool is_set_prototype_next_builtin() const { return m_builtin.has_value() && *m_builtin == Bytecode::Builtin::SetIteratorPrototypeNext; }
     bool is_string_prototype_next_builtin() const { return m_builtin.has_value() && *m_builtin == Bytecode::Builtin::StringIteratorPrototypeNext; }
+    bool is_generator_prototype_next_builtin() const { return m_builtin.has_value() && *m_builtin == Bytecode::Builtin::GeneratorPrototypeNext; }
 
     Optional<Bytecode::Builtin> builtin() const { return m_builtin; }
 
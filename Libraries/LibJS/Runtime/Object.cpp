@@ -103,6 +103,7 @@ void Object::initialize(Realm&)
 
 void Object::unsafe_set_shape(Shape& shape)
 {
+    write_barrier();
     m_shape = shape;
     m_storage.resize(shape.property_count());
 }
@@ -559,6 +560,7 @@ ThrowCompletionOr<void> Object::private_field_add(PrivateName const& name, Value
     if (auto* entry = private_element_find(name); entry)
         return vm.throw_completion<TypeError>(ErrorType::PrivateFieldAlreadyDeclared, name.description);
 
+    write_barrier();
     if (!m_private_elements)
         m_private_elements = make<Vector<PrivateElement>>();
 
@@ -587,6 +589,7 @@ ThrowCompletionOr<void> Object::private_method_or_accessor_add(PrivateElement el
     if (auto* entry = private_element_find(element.key); entry)
         return vm.throw_completion<TypeError>(ErrorType::PrivateFieldAlreadyDeclared, element.key.description);
 
+    write_barrier();
     if (!m_private_elements)
         m_private_elements = make<Vector<PrivateElement>>();
 
@@ -646,6 +649,7 @@ ThrowCompletionOr<void> Object::private_set(PrivateName const& name, Value value
     // 3. If entry.[[Kind]] is field, then
     if (entry->kind == PrivateElement::Kind::Field) {
         // a. Set entry.[[Value]] to value.
+        write_barrier();
         entry->value = value;
         return {};
     }
@@ -1227,8 +1231,11 @@ Optional<ValueAndAttributes> Object::storage_get(PropertyKey const& property_key
             return {};
 
         if (m_has_intrinsic_accessors) {
-            if (auto accessor = find_intrinsic_accessor(this, property_key); accessor.has_value())
-                const_cast<Object&>(*this).m_storage[metadata->offset] = (*accessor)(shape().realm());
+            if (auto accessor = find_intrinsic_accessor(this, property_key); accessor.has_value()) {
+                auto& mutable_this = const_cast<Object&>(*this);
+                mutable_this.write_barrier();
+                mutable_this.m_storage[metadata->offset] = (*accessor)(shape().realm());
+            }
         }
 
         value = m_storage[metadata->offset];
@@ -1250,6 +1257,8 @@ Optional<u32> Object::storage_set(PropertyKey const& property_key, ValueAndAttri
 {
     auto [value, attributes, _] = value_and_attributes;
 
+    write_barrier();
+
     if (property_key.is_number()) {
         auto index = property_key.as_number();
         m_indexed_properties.put(index, value, attributes);
@@ -1291,6 +1300,8 @@ void Object::storage_delete(PropertyKey const& property_key)
 {
     VERIFY(storage_has(property_key));
 
+    write_barrier();
+
     if (property_key.is_number())
         return m_indexed_properties.remove(property_key.as_number());
 
@@ -1302,6 +1313,12 @@ void Object::storage_delete(PropertyKey const& property_key)
     auto metadata = shape().lookup(property_key);
     VERIFY(metadata.has_value());
 
+    // Objects that keep losing properties (e.g. ones used as hash maps) would otherwise grow an ever longer chain
+    // of delete transitions, so switch them over to a dictionary shape.
+    static constexpr size_t max_delete_transitions_before_converting_to_dictionary = 8;
+    if (!m_shape->is_dictionary() && m_shape->delete_transition_count() >= max_delete_transitions_before_converting_to_dictionary)
+        m_shape = m_shape->create_uncacheable_dictionary_transition();
+
     if (m_shape->is_cacheable_dictionary()) {
         m_shape = m_shape->create_uncacheable_dictionary_transition();
     }
@@ -1318,6 +1335,7 @@ void Object::set_prototype(Object* new_prototype)
 {
     if (prototype() == new_prototype)
         return;
+    write_barrier();
     m_shape = shape().create_prototype_transition(new_prototype);
 }
 
@@ -67,6 +67,7 @@ struct CacheableSetPropertyMetadata {
 class JS_API Object : public Cell {
     GC_CELL(Object, Cell);
     GC_DECLARE_ALLOCATOR(Object);
+    GC_DECLARE_WRITE_BARRIERS(Object);
 
 public:
     static GC::Ref<Object> create_prototype(Realm&, Object* prototype);
@@ -249,11 +250,15 @@ public:
     virtual void visit_edges(Cell::Visitor&) override;
 
     Value get_direct(size_t index) const { return m_storage[index]; }
-    void put_direct(size_t index, Value value) { m_storage[index] = value; }
+    void put_direct(size_t index, Value value)
+    {
+        write_barrier();
+        m_storage[index] = value;
+    }
 
     IndexedProperties const& indexed_properties() const { return m_indexed_properties; }
     IndexedProperties& indexed_properties() { return m_indexed_properties; }
-    void set_indexed_property_elements(Vector<Value>&& values) { m_indexed_properties = IndexedProperties(move(values)); }
+    void set_indexed_property_elements(Vector<Value>&& values) { m_indexed_properties.set_elements(move(values)); }
 
     Shape& shape() { return *m_shape; }
     Shape const& shape() const { return *m_shape; }
@@ -295,7 +300,11 @@ protected:
     bool m_is_typed_array { false };
 
 private:
-    void set_shape(Shape& shape) { m_shape = &shape; }
+    void set_shape(Shape& shape)
+    {
+        write_barrier();
+        m_shape = &shape;
+    }
 
     Object* prototype() { return shape().prototype(); }
 
@@ -306,7 +315,7 @@ private:
 
     GC::Ptr<Shape> m_shape;
     Vector<Value> m_storage;
-    IndexedProperties m_indexed_properties;
+    IndexedProperties m_indexed_properties { *this };
     OwnPtr<Vector<PrivateElement>> m_private_elements; // [[PrivateElements]]
 };
 
@@ -110,6 +110,20 @@ GC::Ref<PrimitiveString> PrimitiveString::create(VM& vm, PrimitiveString& lhs, P
     if (rhs_empty)
         return lhs;
 
+    // OPTIMIZATION: A rope costs an allocation of its own and has to be flattened later, so short strings are concatenated
+    //               right away. This is done in UTF-16, which preserves lone surrogates in either piece as they are.
+    static constexpr size_t minimum_rope_length = 13;
+    if (!lhs.m_is_rope && !rhs.m_is_rope && lhs.approximate_length() + rhs.approximate_length() < minimum_rope_length) {
+        StringBuilder builder(StringBuilder::Mode::UTF16, lhs.approximate_length() + rhs.approximate_length());
+        for (auto const* piece : { &lhs, &rhs }) {
+            if (piece->has_utf16_string())
+                builder.append(piece->utf16_string_view());
+            else
+                builder.append(piece->utf8_string_view());
+        }
+        return create(vm, builder.to_utf16_string());
+    }
+
     return vm.heap().allocate<RopeString>(lhs, rhs);
 }
 
@@ -183,6 +197,14 @@ Utf16View PrimitiveString::utf16_string_view() const
     return *m_utf16_string;
 }
 
+size_t PrimitiveString::approximate_length() const
+{
+    VERIFY(!m_is_rope);
+    if (has_utf16_string())
+        return m_utf16_string->length_in_code_units();
+    return m_utf8_string->bytes_as_string_view().length();
+}
+
 size_t PrimitiveString::length_in_utf16_code_units() const
 {
     return utf16_string_view().length_in_code_units();
@@ -238,6 +260,7 @@ void RopeString::resolve(EncodingPreference preference) const
     Vector<PrimitiveString const*, 2> pieces;
     size_t approximate_length = 0;
     size_t length_in_utf16_code_units = 0;
+    bool all_pieces_have_utf8_strings = true;
 
     // NOTE: We traverse the rope tree without using recursion, since we'd run out of
     //       stack space quickly when handling a long sequence of unresolved concatenations.
@@ -255,12 +278,20 @@ void RopeString::resolve(EncodingPreference preference) const
 
         if (current->has_utf8_string())
             approximate_length += current->utf8_string_view().length();
-        if (preference == EncodingPreference::UTF16)
-            length_in_utf16_code_units += current->length_in_utf16_code_units();
+        else
+            all_pieces_have_utf8_strings = false;
         pieces.append(current);
     }
 
+    // OPTIMIZATION: If some pieces are only available as UTF-16, flatten to UTF-16 regardless of the preference. This
+    //               converts the result once if it's needed as UTF-8, instead of converting and keeping each such piece.
+    if (!all_pieces_have_utf8_strings)
+        preference = EncodingPreference::UTF16;
+
     if (preference == EncodingPreference::UTF16) {
+        for (auto const* current : pieces)
+            length_in_utf16_code_units += current->length_in_utf16_code_units();
+
         // The caller wants a UTF-16 string, so we can simply concatenate all the pieces
         // into a UTF-16 code unit buffer and create a Utf16String from it.
         StringBuilder builder(StringBuilder::Mode::UTF16, length_in_utf16_code_units);
@@ -276,6 +307,9 @@ void RopeString::resolve(EncodingPreference preference) const
         m_is_rope = false;
         m_lhs = nullptr;
         m_rhs = nullptr;
+
+        auto bytes_per_code_unit = m_utf16_string->has_ascii_storage() ? sizeof(char) : sizeof(char16_t);
+        vm().did_flatten_rope({}, m_utf16_string->length_in_code_units() * bytes_per_code_unit);
         return;
     }
 
@@ -345,6 +379,8 @@ void RopeString::resolve(EncodingPreference preference) const
     m_is_rope = false;
     m_lhs = nullptr;
     m_rhs = nullptr;
+
+    vm().did_flatten_rope({}, m_utf8_string->bytes_as_string_view().length());
 }
 
 RopeString::RopeString(GC::Ref<PrimitiveString> lhs, GC::Ref<PrimitiveString> rhs)
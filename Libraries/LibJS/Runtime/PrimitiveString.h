@@ -23,6 +23,7 @@ namespace JS {
 class JS_API PrimitiveString : public Cell {
     GC_CELL(PrimitiveString, Cell);
     GC_DECLARE_ALLOCATOR(PrimitiveString);
+    GC_DECLARE_WRITE_BARRIERS(PrimitiveString);
 
 public:
     [[nodiscard]] static GC::Ref<PrimitiveString> create(VM&, Utf16String const&);
@@ -82,11 +83,15 @@ private:
     explicit PrimitiveString(String);
 
     void resolve_rope_if_needed(EncodingPreference) const;
+
+    // The length in UTF-16 code units or UTF-8 bytes of a string that isn't a rope, whichever is cheaper to find out.
+    size_t approximate_length() const;
 };
 
 class RopeString final : public PrimitiveString {
     GC_CELL(RopeString, PrimitiveString);
     GC_DECLARE_ALLOCATOR(RopeString);
+    GC_DECLARE_WRITE_BARRIERS(RopeString);
 
 public:
     virtual ~RopeString() override;
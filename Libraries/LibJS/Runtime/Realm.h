@@ -78,6 +78,14 @@ public:
         return *m_builtins[to_underlying(builtin)];
     }
 
+    // Number of live shapes that belong to this realm, to keep an eye on how much memory goes to them.
+    struct ShapeCounts {
+        size_t shapes { 0 };
+        size_t dictionary_shapes { 0 };
+    };
+    ShapeCounts const& shape_counts() const { return m_shape_counts; }
+    ShapeCounts& shape_counts(Badge<Shape>) { return m_shape_counts; }
+
 private:
     Realm() = default;
 
@@ -88,6 +96,7 @@ private:
     GC::Ptr<GlobalEnvironment> m_global_environment; // [[GlobalEnv]]
     OwnPtr<HostDefined> m_host_defined;              // [[HostDefined]]
     AK::Array<GC::Ptr<NativeFunction>, to_underlying(Bytecode::Builtin::__Count)> m_builtins;
+    ShapeCounts m_shape_counts;
 };
 
 }
@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/StringBuilder.h>
+#include <LibCore/File.h>
+#include <LibCore/System.h>
+#include <LibJS/AST.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/PrimitiveString.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibThreading/Thread.h>
+
+namespace JS {
+
+NonnullOwnPtr<SamplingProfiler> SamplingProfiler::create(VM& vm, u32 interval_in_milliseconds)
+{
+    return adopt_own(*new SamplingProfiler(vm, interval_in_milliseconds));
+}
+
+SamplingProfiler::SamplingProfiler(VM& vm, u32 interval_in_milliseconds)
+    : m_vm(vm)
+    , m_interval_in_milliseconds(max(interval_in_milliseconds, 1u))
+    , m_start_time(MonotonicTime::now())
+    , m_end_time(m_start_time)
+    , m_sample_requested(vm.sample_requested())
+{
+    m_nodes.append({ .frame = { .function_name = "(root)"_string }, .parent = {} });
+}
+
+SamplingProfiler::~SamplingProfiler()
+{
+    stop();
+}
+
+void SamplingProfiler::start()
+{
+    if (m_thread)
+        return;
+
+    m_should_stop.store(false, AK::MemoryOrder::memory_order_relaxed);
+    m_start_time = MonotonicTime::now();
+
+    // NOTE: The sampler thread only ever sets a flag; the stack itself is walked on the VM's own thread,
+    //       since the execution context stack is not safe to inspect from anywhere else.
+    m_thread = Threading::Thread::construct([this] {
+        while (!m_should_stop.load(AK::MemoryOrder::memory_order_relaxed)) {
+            (void)Core::System::sleep_ms(m_interval_in_milliseconds);
+            m_sample_requested.store(true, AK::MemoryOrder::memory_order_relaxed);
+        }
+        return static_cast<intptr_t>(0);
+    },
+        "JS sampler"sv);
+    m_thread->start();
+}
+
+void SamplingProfiler::stop()
+{
+    if (!m_thread)
+        return;
+
+    m_should_stop.store(true, AK::MemoryOrder::memory_order_relaxed);
+    (void)m_thread->join();
+    m_thread = nullptr;
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+    m_end_time = MonotonicTime::now();
+}
+
+SamplingProfiler::Frame SamplingProfiler::frame_for(ExecutionContext const& context)
+{
+    Frame frame;
+
+    if (context.function_name)
+        frame.function_name = context.function_name->utf8_string();
+
+    if (auto const* function = as_if<ECMAScriptFunctionObject>(context.function.ptr())) {
+        // NOTE: We identify functions by where they are declared rather than by the currently executing line,
+        //       so that all samples taken inside the same function end up in the same node.
+        auto source_range = function->ecmascript_code().source_range();
+        frame.url = String::from_utf8_with_replacement_character(source_range.filename());
+        frame.line = source_range.start.line;
+        frame.column = source_range.start.column;
+        if (frame.function_name.is_empty())
+            frame.function_name = "(anonymous)"_string;
+    } else if (!context.function) {
+        frame.function_name = "(program)"_string;
+        if (context.executable)
+            frame.url = context.executable->source_code->filename();
+    } else if (frame.function_name.is_empty()) {
+        frame.function_name = "(native)"_string;
+    }
+
+    return frame;
+}
+
+size_t SamplingProfiler::child_node(size_t parent, Frame frame)
+{
+    for (auto child : m_nodes[parent].children) {
+        if (m_nodes[child].frame == frame)
+            return child;
+    }
+
+    auto child = m_nodes.size();
+    m_nodes.append({ .frame = move(frame), .parent = parent });
+    m_nodes[parent].children.append(child);
+    return child;
+}
+
+void SamplingProfiler::take_sample()
+{
+    m_sample_requested.store(false, AK::MemoryOrder::memory_order_relaxed);
+
+    size_t node = 0;
+    for (auto const* context : m_vm.execution_context_stack())
+        node = child_node(node, frame_for(*context));
+
+    ++m_nodes[node].self_samples;
+    m_samples.append({ .node = node, .time = MonotonicTime::now() });
+}
+
+static void append_frame_label(StringBuilder& builder, StringView function_name, StringView url, size_t line, size_t column)
+{
+    // NOTE: Semicolons separate frames in the collapsed stack format.
+    builder.append(function_name.replace(";"sv, ":"sv, ReplaceMode::All));
+    if (!url.is_empty())
+        builder.appendff(" ({}:{}:{})", url, line, column);
+}
+
+String SamplingProfiler::to_collapsed_stacks() const
+{
+    StringBuilder builder;
+    Vector<size_t> path;
+
+    for (size_t node = 1; node < m_nodes.size(); ++node) {
+        if (m_nodes[node].self_samples == 0)
+            continue;
+
+        path.clear_with_capacity();
+        for (Optional<size_t> it = node; it.has_value() && *it != 0; it = m_nodes[*it].parent)
+            path.append(*it);
+
+        for (size_t i = path.size(); i > 0; --i) {
+            auto const& frame = m_nodes[path[i - 1]].frame;
+            append_frame_label(builder, frame.function_name, frame.url, frame.line, frame.column);
+            if (i != 1)
+                builder.append(';');
+        }
+        builder.appendff(" {}\n", m_nodes[node].self_samples);
+    }
+
+    return builder.to_string_without_validation();
+}
+
+String SamplingProfiler::to_chrome_cpu_profile() const
+{
+    // NOTE: Chrome wants node IDs to be positive, so every node is shifted up by one.
+    JsonArray nodes;
+    for (size_t node = 0; node < m_nodes.size(); ++node) {
+        auto const& frame = m_nodes[node].frame;
+
+        JsonObject call_frame;
+        call_frame.set("functionName"sv, frame.function_name);
+        call_frame.set("scriptId"sv, "0"sv);
+        call_frame.set("url"sv, frame.url);
+        // NOTE: Chrome uses 0-based line and column numbers.
+        call_frame.set("lineNumber"sv, frame.url.is_empty() ? -1 : static_cast<i64>(frame.line) - 1);
+        call_frame.set("columnNumber"sv, frame.url.is_empty() ? -1 : static_cast<i64>(frame.column) - 1);
+
+        JsonArray children;
+        for (auto child : m_nodes[node].children)
+            children.must_append(child + 1);
+
+        JsonObject json_node;
+        json_node.set("id"sv, node + 1);
+        json_node.set("callFrame"sv, move(call_frame));
+        json_node.set("hitCount"sv, m_nodes[node].self_samples);
+        json_node.set("children"sv, move(children));
+        nodes.must_append(move(json_node));
+    }
+
+    JsonArray samples;
+    JsonArray time_deltas;
+    auto previous_time = m_start_time;
+    for (auto const& sample : m_samples) {
+        samples.must_append(sample.node + 1);
+        time_deltas.must_append((sample.time - previous_time).to_microseconds());
+        previous_time = sample.time;
+    }
+
+    JsonObject profile;
+    profile.set("nodes"sv, move(nodes));
+    profile.set("startTime"sv, m_start_time.nanoseconds() / 1000);
+    profile.set("endTime"sv, (m_thread ? MonotonicTime::now() : m_end_time).nanoseconds() / 1000);
+    profile.set("samples"sv, move(samples));
+    profile.set("timeDeltas"sv, move(time_deltas));
+    return profile.serialized();
+}
+
+ErrorOr<void> SamplingProfiler::write_to_file(StringView path) const
+{
+    auto contents = path.ends_with(".cpuprofile"sv) || path.ends_with(".json"sv)
+        ? to_chrome_cpu_profile()
+        : to_collapsed_stacks();
+
+    auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+    TRY(file->write_until_depleted(contents.bytes()));
+    return {};
+}
+
+}
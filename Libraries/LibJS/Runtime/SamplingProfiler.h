@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Atomic.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/RefPtr.h>
+#include <AK/String.h>
+#include <AK/Time.h>
+#include <AK/Vector.h>
+#include <LibJS/Export.h>
+#include <LibJS/Forward.h>
+#include <LibThreading/Forward.h>
+
+namespace JS {
+
+// A statistical profiler for JavaScript code. A helper thread periodically requests a sample, and the interpreter
+// records the execution context stack the next time it passes a safe point (function entry or a taken jump).
+// Native code from the baseline tier exits to the interpreter at loop back-edges while a sample is pending.
+// Samples are aggregated into a call tree, which can be exported as collapsed stacks (for flame graph tools) or
+// as a Chrome DevTools .cpuprofile.
+class JS_API SamplingProfiler {
+    AK_MAKE_NONCOPYABLE(SamplingProfiler);
+    AK_MAKE_NONMOVABLE(SamplingProfiler);
+
+public:
+    static NonnullOwnPtr<SamplingProfiler> create(VM&, u32 interval_in_milliseconds);
+    ~SamplingProfiler();
+
+    void start();
+    void stop();
+
+    [[nodiscard]] ALWAYS_INLINE bool sample_requested() const { return m_sample_requested.load(AK::MemoryOrder::memory_order_relaxed); }
+    void take_sample();
+
+    size_t sample_count() const { return m_samples.size(); }
+
+    // One line per distinct stack, outermost frame first, e.g. "(program);foo (a.js:1:1);bar (a.js:5:1) 42"
+    String to_collapsed_stacks() const;
+
+    // https://chromedevtools.github.io/devtools-protocol/tot/Profiler/#type-Profile
+    String to_chrome_cpu_profile() const;
+
+    // Picks the format from the file extension: ".cpuprofile" and ".json" get a Chrome profile, anything else collapsed stacks.
+    ErrorOr<void> write_to_file(StringView path) const;
+
+private:
+    SamplingProfiler(VM&, u32 interval_in_milliseconds);
+
+    struct Frame {
+        String function_name;
+        String url;
+        size_t line { 0 };
+        size_t column { 0 };
+
+        bool operator==(Frame const&) const = default;
+    };
+
+    struct Node {
+        Frame frame;
+        Optional<size_t> parent;
+        Vector<size_t> children;
+        size_t self_samples { 0 };
+    };
+
+    struct Sample {
+        size_t node { 0 };
+        MonotonicTime time;
+    };
+
+    static Frame frame_for(ExecutionContext const&);
+    size_t child_node(size_t parent, Frame);
+
+    VM& m_vm;
+    u32 m_interval_in_milliseconds { 0 };
+
+    // Node 0 is the (root) node, which never has samples of its own.
+    Vector<Node> m_nodes;
+    Vector<Sample> m_samples;
+    MonotonicTime m_start_time;
+    MonotonicTime m_end_time;
+
+    RefPtr<Threading::Thread> m_thread;
+    // NOTE: This lives in the VM, so that native code can check it without knowing whether a profiler is running.
+    Atomic<bool>& m_sample_requested;
+    Atomic<bool> m_should_stop { false };
+};
+
+}
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Checked.h>
 #include <LibGC/DeferGC.h>
 #include <LibJS/Runtime/Shape.h>
 #include <LibJS/Runtime/VM.h>
@@ -16,6 +17,17 @@ GC_DEFINE_ALLOCATOR(PrototypeChainValidity);
 
 static HashTable<GC::Ptr<Shape>> s_all_prototype_shapes;
 
+// Stale transitions are otherwise only pruned when someone asks for the same key again, which never happens
+// for shapes of objects used as hash maps. Since the keys of stale transitions are kept alive as well, drop
+// them whenever a transition table is about to grow.
+template<typename Key>
+static void prune_stale_transitions_if_about_to_grow(HashMap<Key, GC::Weak<Shape>>& transitions)
+{
+    if ((transitions.size() + 1) * 5 < transitions.capacity() * 4)
+        return;
+    transitions.remove_all_matching([](auto const&, auto const& shape) { return !shape; });
+}
+
 Shape::~Shape()
 {
     if (m_is_prototype_shape)
@@ -27,6 +39,7 @@ GC::Ref<Shape> Shape::create_cacheable_dictionary_transition()
     auto new_shape = heap().allocate<Shape>(m_realm);
     new_shape->m_dictionary = true;
     new_shape->m_cacheable = true;
+    ++m_realm->shape_counts({}).dictionary_shapes;
     new_shape->m_prototype = m_prototype;
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     ensure_property_table();
@@ -41,6 +54,7 @@ GC::Ref<Shape> Shape::create_uncacheable_dictionary_transition()
     auto new_shape = heap().allocate<Shape>(m_realm);
     new_shape->m_dictionary = true;
     new_shape->m_cacheable = false;
+    ++m_realm->shape_counts({}).dictionary_shapes;
     new_shape->m_prototype = m_prototype;
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     ensure_property_table();
@@ -111,6 +125,7 @@ GC::Ref<Shape> Shape::create_put_transition(PropertyKey const& property_key, Pro
     if (!m_is_prototype_shape) {
         if (!m_forward_transitions)
             m_forward_transitions = make<HashMap<TransitionKey, GC::Weak<Shape>>>();
+        prune_stale_transitions_if_about_to_grow(*m_forward_transitions);
         m_forward_transitions->set(key, new_shape);
     }
     return new_shape;
@@ -126,6 +141,7 @@ GC::Ref<Shape> Shape::create_configure_transition(PropertyKey const& property_ke
     if (!m_is_prototype_shape) {
         if (!m_forward_transitions)
             m_forward_transitions = make<HashMap<TransitionKey, GC::Weak<Shape>>>();
+        prune_stale_transitions_if_about_to_grow(*m_forward_transitions);
         m_forward_transitions->set(key, new_shape.ptr());
     }
     return new_shape;
@@ -142,6 +158,7 @@ GC::Ref<Shape> Shape::create_prototype_transition(Object* new_prototype)
     if (!m_is_prototype_shape) {
         if (!m_prototype_transitions)
             m_prototype_transitions = make<HashMap<GC::Ptr<Object>, GC::Weak<Shape>>>();
+        prune_stale_transitions_if_about_to_grow(*m_prototype_transitions);
         m_prototype_transitions->set(new_prototype, new_shape.ptr());
     }
     return new_shape;
@@ -150,6 +167,7 @@ GC::Ref<Shape> Shape::create_prototype_transition(Object* new_prototype)
 Shape::Shape(Realm& realm)
     : m_realm(realm)
 {
+    ++m_realm->shape_counts({}).shapes;
 }
 
 Shape::Shape(Shape& previous_shape, PropertyKey const& property_key, PropertyAttributes attributes, TransitionType transition_type)
@@ -160,7 +178,9 @@ Shape::Shape(Shape& previous_shape, PropertyKey const& property_key, PropertyAtt
     , m_property_count(transition_type == TransitionType::Put ? previous_shape.m_property_count + 1 : previous_shape.m_property_count)
     , m_attributes(attributes)
     , m_transition_type(transition_type)
+    , m_delete_transition_count(previous_shape.m_delete_transition_count)
 {
+    ++m_realm->shape_counts({}).shapes;
 }
 
 Shape::Shape(Shape& previous_shape, PropertyKey const& property_key, TransitionType transition_type)
@@ -170,8 +190,10 @@ Shape::Shape(Shape& previous_shape, PropertyKey const& property_key, TransitionT
     , m_prototype(previous_shape.m_prototype)
     , m_property_count(previous_shape.m_property_count - 1)
     , m_transition_type(transition_type)
+    , m_delete_transition_count(Checked<u8>::saturating_add(previous_shape.m_delete_transition_count, 1))
 {
     VERIFY(transition_type == TransitionType::Delete);
+    ++m_realm->shape_counts({}).shapes;
 }
 
 Shape::Shape(Shape& previous_shape, Object* new_prototype)
@@ -180,7 +202,20 @@ Shape::Shape(Shape& previous_shape, Object* new_prototype)
     , m_prototype(new_prototype)
     , m_property_count(previous_shape.m_property_count)
     , m_transition_type(TransitionType::Prototype)
+    , m_delete_transition_count(previous_shape.m_delete_transition_count)
 {
+    ++m_realm->shape_counts({}).shapes;
+}
+
+void Shape::finalize()
+{
+    Base::finalize();
+
+    // NOTE: Every dead cell is finalized before any of them are destroyed, so the realm is still around here.
+    auto& counts = m_realm->shape_counts({});
+    --counts.shapes;
+    if (m_dictionary)
+        --counts.dictionary_shapes;
 }
 
 void Shape::visit_edges(Cell::Visitor& visitor)
@@ -280,6 +315,7 @@ GC::Ref<Shape> Shape::create_delete_transition(PropertyKey const& property_key)
     invalidate_prototype_if_needed_for_new_prototype(new_shape);
     if (!m_delete_transitions)
         m_delete_transitions = make<HashMap<PropertyKey, GC::Weak<Shape>>>();
+    prune_stale_transitions_if_about_to_grow(*m_delete_transitions);
     m_delete_transitions->set(property_key, new_shape.ptr());
     return new_shape;
 }
@@ -86,6 +86,9 @@ public:
 
     [[nodiscard]] u32 dictionary_generation() const { return m_dictionary_generation; }
 
+    // Number of delete transitions on the way from the root shape to this one (saturating).
+    [[nodiscard]] u8 delete_transition_count() const { return m_delete_transition_count; }
+
     [[nodiscard]] bool is_prototype_shape() const { return m_is_prototype_shape; }
     void set_prototype_shape();
 
@@ -118,6 +121,7 @@ private:
     void invalidate_all_prototype_chains_leading_to_this();
 
     virtual void visit_edges(Visitor&) override;
+    virtual void finalize() override;
 
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_forward_transition(TransitionKey const&);
     [[nodiscard]] GC::Ptr<Shape> get_or_prune_cached_prototype_transition(Object* prototype);
@@ -143,6 +147,7 @@ private:
 
     PropertyAttributes m_attributes { 0 };
     TransitionType m_transition_type { TransitionType::Invalid };
+    u8 m_delete_transition_count { 0 };
 
     bool m_dictionary : 1 { false };
     bool m_cacheable : 1 { true };
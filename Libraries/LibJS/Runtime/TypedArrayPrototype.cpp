@@ -6,6 +6,9 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/QuickSort.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/TypeCasts.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
@@ -19,6 +22,40 @@ namespace JS {
 
 GC_DEFINE_ALLOCATOR(TypedArrayPrototype);
 
+// NOTE: GCC ignores dependent vector_size attributes, so the 16-byte vector type of each element type is spelled out.
+template<typename T>
+using VectorOf16BytesOf = Conditional<IsSame<T, u8>, AK::SIMD::u8x16,
+    Conditional<IsSame<T, i8>, AK::SIMD::i8x16,
+        Conditional<IsSame<T, u16>, AK::SIMD::u16x8,
+            Conditional<IsSame<T, i16>, AK::SIMD::i16x8,
+                Conditional<IsSame<T, u32>, AK::SIMD::u32x4,
+                    Conditional<IsSame<T, i32>, AK::SIMD::i32x4,
+                        Conditional<IsSame<T, u64>, AK::SIMD::u64x2,
+                            Conditional<IsSame<T, float>, AK::SIMD::f32x4,
+                                Conditional<IsSame<T, double>, AK::SIMD::f64x2, void>>>>>>>>>;
+
+// Returns the bytes that make up the elements in [begin, end) of a TypedArray that is not detached, or an empty Optional
+// if they're not all within its buffer.
+static Optional<Bytes> typed_array_element_bytes(TypedArrayBase const& typed_array, u32 begin, u32 end)
+{
+    Checked<size_t> computed_begin = begin;
+    computed_begin *= typed_array.element_size();
+    computed_begin += typed_array.byte_offset();
+
+    Checked<size_t> computed_end = end;
+    computed_end *= typed_array.element_size();
+    computed_end += typed_array.byte_offset();
+
+    if (computed_begin.has_overflow() || computed_end.has_overflow()) [[unlikely]]
+        return {};
+
+    auto& array_buffer = *typed_array.viewed_array_buffer();
+    if (computed_begin.value() > computed_end.value() || computed_end.value() > array_buffer.byte_length()) [[unlikely]]
+        return {};
+
+    return array_buffer.buffer().bytes().slice(computed_begin.value(), computed_end.value() - computed_begin.value());
+}
+
 TypedArrayPrototype::TypedArrayPrototype(Realm& realm)
     : Object(ConstructWithPrototypeTag::Tag, realm.intrinsics().object_prototype())
 {
@@ -475,32 +512,21 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::every)
     return true;
 }
 
-// NOTE: This function assumes that the index is valid within the TypedArray,
-//       and that the TypedArray is not detached.
-template<typename T>
-inline void fast_typed_array_fill(TypedArrayBase& typed_array, u32 begin, u32 end, T value)
+// Fills `bytes` with copies of the raw bytes of a single element.
+static void fill_with_element(Bytes bytes, ReadonlyBytes element)
 {
-    Checked<size_t> computed_begin = begin;
-    computed_begin *= sizeof(T);
-    computed_begin += typed_array.byte_offset();
-
-    Checked<size_t> computed_end = end;
-    computed_end *= sizeof(T);
-    computed_end += typed_array.byte_offset();
-
-    if (computed_begin.has_overflow() || computed_end.has_overflow()) [[unlikely]] {
-        return;
-    }
-
-    if (computed_begin.value() >= typed_array.viewed_array_buffer()->byte_length()
-        || computed_end.value() > typed_array.viewed_array_buffer()->byte_length()) [[unlikely]] {
-        return;
-    }
-
-    auto& array_buffer = *typed_array.viewed_array_buffer();
-    auto* slot = reinterpret_cast<T*>(array_buffer.buffer().offset_pointer(computed_begin.value()));
-    for (auto i = begin; i < end; ++i)
-        *(slot++) = value;
+    VERIFY(bytes.size() % element.size() == 0);
+
+    // NOTE: Every element size divides 16, so a vector of repeated elements can be stored anywhere an element starts.
+    AK::SIMD::u8x16 elements;
+    for (size_t i = 0; i < sizeof(elements); ++i)
+        elements[i] = element[i % element.size()];
+
+    size_t offset = 0;
+    for (; offset + sizeof(elements) <= bytes.size(); offset += sizeof(elements))
+        AK::SIMD::store_unaligned(bytes.offset_pointer(offset), elements);
+    for (; offset < bytes.size(); offset += element.size())
+        element.copy_to(bytes.slice(offset));
 }
 
 // 23.2.3.9 %TypedArray%.prototype.fill ( value [ , start [ , end ] ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.fill
@@ -571,32 +597,21 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::fill)
     // 17. Set final to min(final, len).
     final = min(final, length);
 
-    if (value.is_int32()) {
-        switch (typed_array->kind()) {
-        case TypedArrayBase::Kind::Uint8Array:
-            fast_typed_array_fill<u8>(*typed_array, k, final, static_cast<u8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint16Array:
-            fast_typed_array_fill<u16>(*typed_array, k, final, static_cast<u16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Uint32Array:
-            fast_typed_array_fill<u32>(*typed_array, k, final, static_cast<u32>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int8Array:
-            fast_typed_array_fill<i8>(*typed_array, k, final, static_cast<i8>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int16Array:
-            fast_typed_array_fill<i16>(*typed_array, k, final, static_cast<i16>(value.as_i32()));
-            return typed_array;
-        case TypedArrayBase::Kind::Int32Array:
-            fast_typed_array_fill<i32>(*typed_array, k, final, value.as_i32());
-            return typed_array;
-        case TypedArrayBase::Kind::Uint8ClampedArray:
-            fast_typed_array_fill<u8>(*typed_array, k, final, clamp(value.as_i32(), 0, 255));
+    // OPTIMIZATION: Convert the value to raw bytes once, and copy those into the buffer directly.
+    if (k < final) {
+        if (auto bytes = typed_array_element_bytes(*typed_array, k, final); bytes.has_value()) {
+            u8 element_storage[sizeof(u64)];
+            Bytes element { element_storage, typed_array->element_size() };
+            switch (typed_array->kind()) {
+#define __JS_ENUMERATE(ClassName, snake_name, PrototypeName, ConstructorName, Type) \
+    case TypedArrayBase::Kind::ClassName:                                           \
+        numeric_to_raw_bytes<Type>(vm, value, true, element);                       \
+        break;
+                JS_ENUMERATE_TYPED_ARRAYS
+#undef __JS_ENUMERATE
+            }
+            fill_with_element(*bytes, element);
             return typed_array;
-        default:
-            // FIXME: Support more TypedArray kinds.
-            break;
         }
     }
 
@@ -871,6 +886,120 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::for_each)
     return js_undefined();
 }
 
+// Returns the index of the first element that is equal to `needle`, if any.
+template<typename T>
+static Optional<size_t> find_first_equal_element(ReadonlySpan<T> elements, T needle)
+{
+    using VectorType = VectorOf16BytesOf<T>;
+    constexpr size_t lanes = sizeof(VectorType) / sizeof(T);
+
+    VectorType needles;
+    for (size_t i = 0; i < lanes; ++i)
+        needles[i] = needle;
+
+    size_t i = 0;
+    for (; i + lanes <= elements.size(); i += lanes) {
+        auto matches = bit_cast<AK::SIMD::u64x2>(AK::SIMD::load_unaligned<VectorType>(&elements[i]) == needles);
+        if ((matches[0] | matches[1]) != 0)
+            break;
+    }
+
+    // NOTE: This scans the rest of the vector that contained a match, as well as the elements after the last full vector.
+    for (; i < elements.size(); ++i) {
+        if (elements[i] == needle)
+            return i;
+    }
+    return {};
+}
+
+// Converts a search value to an element of type T, if any element of that type could be equal to it.
+template<typename T>
+static Optional<T> search_value_as_element(double value)
+{
+    if constexpr (IsFloatingPoint<T>) {
+        if (!isinf(value) && fabs(value) > static_cast<double>(NumericLimits<T>::max()))
+            return {};
+        auto element = static_cast<T>(value);
+        if (static_cast<double>(element) != value)
+            return {};
+        return element;
+    } else {
+        if (trunc(value) != value || value < static_cast<double>(NumericLimits<T>::min()) || value > static_cast<double>(NumericLimits<T>::max()))
+            return {};
+        return static_cast<T>(value);
+    }
+}
+
+enum class NaNMatchesNaN {
+    No,
+    Yes,
+};
+
+// OPTIMIZATION: Searches the elements in [begin, end) of a Number TypedArray directly in its buffer. Returns the index of the
+//               first match or -1, or an empty Optional if the caller has to fall back to the generic algorithm.
+static Optional<i64> fast_typed_array_index_of(TypedArrayBase const& typed_array, u32 begin, u32 end, Value search_element, NaNMatchesNaN nan_matches_nan)
+{
+    if (typed_array.content_type() != TypedArrayBase::ContentType::Number)
+        return {};
+
+    // NOTE: Every element of a Number TypedArray is a Number, so nothing else can be equal to one.
+    if (!search_element.is_number())
+        return -1;
+
+    auto bytes = typed_array_element_bytes(typed_array, begin, end);
+    if (!bytes.has_value())
+        return {};
+
+    auto search_value = search_element.as_double();
+
+    auto search = [&]<typename T>() -> i64 {
+        ReadonlySpan<T> elements { reinterpret_cast<T const*>(bytes->data()), bytes->size() / sizeof(T) };
+
+        Optional<size_t> index;
+        if (isnan(search_value)) {
+            if constexpr (IsFloatingPoint<T>) {
+                if (nan_matches_nan == NaNMatchesNaN::Yes) {
+                    for (size_t i = 0; i < elements.size(); ++i) {
+                        if (isnan(elements[i])) {
+                            index = i;
+                            break;
+                        }
+                    }
+                }
+            }
+        } else if (auto needle = search_value_as_element<T>(search_value); needle.has_value()) {
+            index = find_first_equal_element(elements, *needle);
+        }
+
+        if (!index.has_value())
+            return -1;
+        return begin + *index;
+    };
+
+    switch (typed_array.kind()) {
+    case TypedArrayBase::Kind::Uint8Array:
+    case TypedArrayBase::Kind::Uint8ClampedArray:
+        return search.operator()<u8>();
+    case TypedArrayBase::Kind::Uint16Array:
+        return search.operator()<u16>();
+    case TypedArrayBase::Kind::Uint32Array:
+        return search.operator()<u32>();
+    case TypedArrayBase::Kind::Int8Array:
+        return search.operator()<i8>();
+    case TypedArrayBase::Kind::Int16Array:
+        return search.operator()<i16>();
+    case TypedArrayBase::Kind::Int32Array:
+        return search.operator()<i32>();
+    case TypedArrayBase::Kind::Float32Array:
+        return search.operator()<float>();
+    case TypedArrayBase::Kind::Float64Array:
+        return search.operator()<double>();
+    default:
+        // FIXME: Support Float16Array.
+        return {};
+    }
+}
+
 // 23.2.3.16 %TypedArray%.prototype.includes ( searchElement [ , fromIndex ] ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.includes
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
 {
@@ -923,6 +1052,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::includes)
         k = relative_k;
     }
 
+    // OPTIMIZATION: If ToIntegerOrInfinity didn't shrink the TypedArray, search its buffer directly.
+    typed_array_record = make_typed_array_with_buffer_witness_record(*typed_array, ArrayBuffer::Order::SeqCst);
+    if (k < length && !is_typed_array_out_of_bounds(typed_array_record) && typed_array_length(typed_array_record) >= length) {
+        if (auto index = fast_typed_array_index_of(*typed_array, k, length, search_element, NaNMatchesNaN::Yes); index.has_value())
+            return Value { *index != -1 };
+    }
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let elementK be ! Get(O, ! ToString(𝔽(k))).
@@ -992,6 +1128,13 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::index_of)
         k = relative_k;
     }
 
+    // OPTIMIZATION: If ToIntegerOrInfinity didn't shrink the TypedArray, search its buffer directly.
+    typed_array_record = make_typed_array_with_buffer_witness_record(*typed_array, ArrayBuffer::Order::SeqCst);
+    if (k < length && !is_typed_array_out_of_bounds(typed_array_record) && typed_array_length(typed_array_record) >= length) {
+        if (auto index = fast_typed_array_index_of(*typed_array, k, length, search_element, NaNMatchesNaN::No); index.has_value())
+            return Value { static_cast<double>(*index) };
+    }
+
     // 11. Repeat, while k < len,
     while (k < length) {
         // a. Let kPresent be ! HasProperty(O, ! ToString(𝔽(k))).
@@ -1344,6 +1487,34 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reduce_right)
     return accumulator;
 }
 
+// Reverses the order of the elements of type T in `bytes`.
+template<typename T>
+static void reverse_elements(Bytes bytes)
+{
+    using VectorType = VectorOf16BytesOf<T>;
+    constexpr size_t lanes = sizeof(VectorType) / sizeof(T);
+
+    auto* elements = reinterpret_cast<T*>(bytes.data());
+    size_t lower = 0;
+    size_t upper = bytes.size() / sizeof(T);
+
+    // Swap whole vectors from both ends, reversing their lanes, for as long as they don't overlap.
+    while (upper - lower >= 2 * lanes) {
+        upper -= lanes;
+        auto lower_elements = AK::SIMD::load_unaligned<VectorType>(&elements[lower]);
+        auto upper_elements = AK::SIMD::load_unaligned<VectorType>(&elements[upper]);
+        AK::SIMD::store_unaligned(&elements[lower], AK::SIMD::item_reverse(upper_elements));
+        AK::SIMD::store_unaligned(&elements[upper], AK::SIMD::item_reverse(lower_elements));
+        lower += lanes;
+    }
+
+    while (upper - lower >= 2) {
+        --upper;
+        swap(elements[lower], elements[upper]);
+        ++lower;
+    }
+}
+
 // 23.2.3.25 %TypedArray%.prototype.reverse ( ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.reverse
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reverse)
 {
@@ -1356,6 +1527,27 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::reverse)
     // 3. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Reverse the raw elements in the buffer directly, since their values don't matter.
+    if (auto bytes = typed_array_element_bytes(*typed_array, 0, length); bytes.has_value()) {
+        switch (typed_array->element_size()) {
+        case 1:
+            reverse_elements<u8>(*bytes);
+            break;
+        case 2:
+            reverse_elements<u16>(*bytes);
+            break;
+        case 4:
+            reverse_elements<u32>(*bytes);
+            break;
+        case 8:
+            reverse_elements<u64>(*bytes);
+            break;
+        default:
+            VERIFY_NOT_REACHED();
+        }
+        return typed_array;
+    }
+
     // 4. Let middle be floor(len / 2).
     auto middle = length / 2;
 
@@ -1820,6 +2012,117 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::some)
     return false;
 }
 
+// Sorts integers with a least significant digit first radix sort, one byte per pass.
+template<typename T>
+static void radix_sort(Span<T> elements)
+{
+    using UnsignedType = MakeUnsigned<T>;
+
+    // NOTE: Flipping the sign bit makes signed integers sort like unsigned ones.
+    static constexpr UnsignedType sign_bit = IsSigned<T> ? static_cast<UnsignedType>(UnsignedType { 1 } << (sizeof(T) * 8 - 1)) : 0;
+    auto key_of = [](T element) { return static_cast<UnsignedType>(bit_cast<UnsignedType>(element) ^ sign_bit); };
+
+    Vector<T> scratch;
+    scratch.resize(elements.size());
+
+    auto source = elements;
+    auto destination = scratch.span();
+
+    for (size_t shift = 0; shift < sizeof(T) * 8; shift += 8) {
+        size_t offsets[256] {};
+        for (auto element : source)
+            ++offsets[(key_of(element) >> shift) & 0xff];
+
+        // If every element has the same digit, this pass wouldn't move anything.
+        if (offsets[(key_of(source[0]) >> shift) & 0xff] == source.size())
+            continue;
+
+        size_t offset = 0;
+        for (auto& count : offsets) {
+            auto digit_count = count;
+            count = offset;
+            offset += digit_count;
+        }
+
+        for (auto element : source)
+            destination[offsets[(key_of(element) >> shift) & 0xff]++] = element;
+
+        swap(source, destination);
+    }
+
+    if (source.data() != elements.data())
+        source.copy_to(elements);
+}
+
+// Sorts floating point numbers the way CompareTypedArrayElements without a comparefn does.
+template<typename T>
+static void sort_floating_point_numbers(Span<T> elements)
+{
+    // NOTE: NaN is placed after everything else. Its bit patterns aren't observable after sorting, so they're not preserved.
+    size_t number_count = 0;
+    for (auto element : elements) {
+        if (!isnan(static_cast<double>(element)))
+            elements[number_count++] = element;
+    }
+    for (size_t i = number_count; i < elements.size(); ++i)
+        elements[i] = static_cast<T>(NAN);
+
+    auto numbers = elements.trim(number_count);
+    quick_sort(numbers, [](T x, T y) {
+        if (x == 0 && y == 0)
+            return signbit(static_cast<double>(x)) && !signbit(static_cast<double>(y));
+        return x < y;
+    });
+}
+
+// OPTIMIZATION: Without a comparefn, the elements of a TypedArray can be sorted natively, as no user code can observe it.
+static void sort_typed_array_elements_by_default_comparator(TypedArrayBase const& typed_array, Bytes bytes)
+{
+    auto sort = [&]<typename T>() {
+        Span<T> elements { reinterpret_cast<T*>(bytes.data()), bytes.size() / sizeof(T) };
+        if (elements.size() <= 1)
+            return;
+
+        if constexpr (IsFloatingPoint<T>) {
+            sort_floating_point_numbers(elements);
+        } else {
+            // NOTE: Radix sorting costs a few passes over the elements regardless of their count, so short arrays are quick sorted.
+            static constexpr size_t radix_sort_threshold = 128;
+            if (elements.size() < radix_sort_threshold)
+                quick_sort(elements, [](T x, T y) { return x < y; });
+            else
+                radix_sort(elements);
+        }
+    };
+
+    switch (typed_array.kind()) {
+    case TypedArrayBase::Kind::Uint8Array:
+    case TypedArrayBase::Kind::Uint8ClampedArray:
+        return sort.operator()<u8>();
+    case TypedArrayBase::Kind::Uint16Array:
+        return sort.operator()<u16>();
+    case TypedArrayBase::Kind::Uint32Array:
+        return sort.operator()<u32>();
+    case TypedArrayBase::Kind::BigUint64Array:
+        return sort.operator()<u64>();
+    case TypedArrayBase::Kind::Int8Array:
+        return sort.operator()<i8>();
+    case TypedArrayBase::Kind::Int16Array:
+        return sort.operator()<i16>();
+    case TypedArrayBase::Kind::Int32Array:
+        return sort.operator()<i32>();
+    case TypedArrayBase::Kind::BigInt64Array:
+        return sort.operator()<i64>();
+    case TypedArrayBase::Kind::Float16Array:
+        return sort.operator()<f16>();
+    case TypedArrayBase::Kind::Float32Array:
+        return sort.operator()<float>();
+    case TypedArrayBase::Kind::Float64Array:
+        return sort.operator()<double>();
+    }
+    VERIFY_NOT_REACHED();
+}
+
 // 23.2.3.29 %TypedArray%.prototype.sort ( comparefn ), https://tc39.es/ecma262/#sec-%typedarray%.prototype.sort
 JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
 {
@@ -1838,6 +2141,14 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::sort)
     // 4. Let len be TypedArrayLength(taRecord).
     auto length = typed_array_length(typed_array_record);
 
+    // OPTIMIZATION: Without a comparefn, sort the elements in the buffer natively.
+    if (compare_function.is_undefined()) {
+        if (auto bytes = typed_array_element_bytes(*typed_array, 0, length); bytes.has_value()) {
+            sort_typed_array_elements_by_default_comparator(*typed_array, *bytes);
+            return typed_array;
+        }
+    }
+
     // 5. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.30.
     // 6. Let SortCompare be a new Abstract Closure with parameters (x, y) that captures comparefn and performs the following steps when called:
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
@@ -2076,6 +2387,17 @@ JS_DEFINE_NATIVE_FUNCTION(TypedArrayPrototype::to_sorted)
     arguments.empend(length);
     auto* array = TRY(typed_array_create_same_type(vm, *typed_array, move(arguments)));
 
+    // OPTIMIZATION: Without a comparefn, copy the elements to A and sort them there natively.
+    if (compare_function.is_undefined()) {
+        auto source_bytes = typed_array_element_bytes(*typed_array, 0, length);
+        auto target_bytes = typed_array_element_bytes(*array, 0, length);
+        if (source_bytes.has_value() && target_bytes.has_value()) {
+            source_bytes->copy_to(*target_bytes);
+            sort_typed_array_elements_by_default_comparator(*array, *target_bytes);
+            return array;
+        }
+    }
+
     // 6. NOTE: The following closure performs a numeric comparison rather than the string comparison used in 23.1.3.34.
     Function<ThrowCompletionOr<double>(Value, Value)> sort_compare = [&](auto x, auto y) -> ThrowCompletionOr<double> {
         // a. Return ? CompareTypedArrayElements(x, y, comparefn).
@@ -16,6 +16,7 @@
 #include <LibFileSystem/FileSystem.h>
 #include <LibJS/AST.h>
 #include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/AbstractOperations.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
@@ -29,6 +30,7 @@
 #include <LibJS/Runtime/NativeFunction.h>
 #include <LibJS/Runtime/PromiseCapability.h>
 #include <LibJS/Runtime/Reference.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/Symbol.h>
 #include <LibJS/Runtime/Temporal/Instant.h>
 #include <LibJS/Runtime/VM.h>
@@ -70,6 +72,7 @@ VM::VM(ErrorMessages error_messages)
     , m_error_messages(move(error_messages))
 {
     m_bytecode_interpreter = make<Bytecode::Interpreter>(*this);
+    m_program_cache = make<ProgramCache>();
 
     m_empty_string = m_heap.allocate<PrimitiveString>(String {});
 
@@ -216,6 +219,21 @@ VM::VM(ErrorMessages error_messages)
 
 VM::~VM() = default;
 
+SamplingProfiler& VM::start_sampling_profiler(u32 interval_in_milliseconds)
+{
+    if (!m_sampling_profiler)
+        m_sampling_profiler = SamplingProfiler::create(*this, interval_in_milliseconds);
+    m_sampling_profiler->start();
+    return *m_sampling_profiler;
+}
+
+OwnPtr<SamplingProfiler> VM::stop_sampling_profiler()
+{
+    if (m_sampling_profiler)
+        m_sampling_profiler->stop();
+    return move(m_sampling_profiler);
+}
+
 Utf16String const& VM::error_message(ErrorMessage type) const
 {
     VERIFY(type < ErrorMessage::__Count);
@@ -768,6 +786,37 @@ static RefPtr<CachedSourceRange> get_source_range(ExecutionContext const* contex
     return context->cached_source_range;
 }
 
+void VM::start_allocation_sampling(size_t sampling_interval_in_bytes)
+{
+    heap().start_allocation_sampling(sampling_interval_in_bytes, [this] {
+        return current_allocation_site();
+    });
+}
+
+String VM::current_allocation_site() const
+{
+    // NOTE: Cells allocated by native functions are attributed to the script that called them.
+    for (ssize_t i = m_execution_context_stack.size() - 1; i >= 0; i--) {
+        auto const* context = m_execution_context_stack[i];
+        auto cached_source_range = get_source_range(context);
+        if (!cached_source_range)
+            continue;
+
+        if (auto* unrealized = cached_source_range->source_range.get_pointer<UnrealizedSourceRange>()) {
+            if (!unrealized->source_code)
+                continue;
+            cached_source_range->source_range = unrealized->realize();
+        }
+        auto const& source_range = cached_source_range->source_range.get<SourceRange>();
+
+        auto function_name = context->function_name ? context->function_name->utf8_string() : String {};
+        if (function_name.is_empty())
+            function_name = context->function ? "(anonymous)"_string : "(program)"_string;
+        return MUST(String::formatted("{} ({}:{}:{})", function_name, source_range.filename(), source_range.start.line, source_range.start.column));
+    }
+    return {};
+}
+
 Vector<StackTraceElement> VM::stack_trace() const
 {
     Vector<StackTraceElement> stack_trace;
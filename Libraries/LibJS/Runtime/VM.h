@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <AK/Atomic.h>
 #include <AK/FlyString.h>
 #include <AK/Function.h>
 #include <AK/HashMap.h>
@@ -63,6 +64,8 @@ public:
 
     Bytecode::Interpreter& bytecode_interpreter() { return *m_bytecode_interpreter; }
 
+    ProgramCache& program_cache() { return *m_program_cache; }
+
     void dump_backtrace() const;
 
     void gather_roots(HashMap<GC::Cell*, GC::HeapRoot>&);
@@ -87,6 +90,27 @@ public:
 
     auto& numeric_string_cache() { return m_numeric_string_cache; }
 
+    struct RopeFlatteningCounts {
+        size_t ropes { 0 };
+        size_t bytes { 0 };
+    };
+    RopeFlatteningCounts const& rope_flattening_counts() const { return m_rope_flattening_counts; }
+    void did_flatten_rope(Badge<RopeString>, size_t bytes)
+    {
+        ++m_rope_flattening_counts.ropes;
+        m_rope_flattening_counts.bytes += bytes;
+    }
+
+    SamplingProfiler* sampling_profiler() { return m_sampling_profiler.ptr(); }
+    // Raised by the sampling profiler's thread. The interpreter and native code check it at their safe points.
+    Atomic<bool>& sample_requested() { return m_sample_requested; }
+    SamplingProfiler& start_sampling_profiler(u32 interval_in_milliseconds);
+    OwnPtr<SamplingProfiler> stop_sampling_profiler();
+
+    // Samples GC allocations, attributing each sample to the innermost script location on the execution context stack.
+    void start_allocation_sampling(size_t sampling_interval_in_bytes);
+    String current_allocation_site() const;
+
     PrimitiveString& empty_string() { return *m_empty_string; }
 
     PrimitiveString& single_ascii_character_string(u8 character)
@@ -329,6 +353,11 @@ private:
     static constexpr size_t numeric_string_cache_size = 1000;
     AK::Array<GC::Ptr<PrimitiveString>, numeric_string_cache_size> m_numeric_string_cache;
 
+    RopeFlatteningCounts m_rope_flattening_counts;
+
+    OwnPtr<SamplingProfiler> m_sampling_profiler;
+    Atomic<bool> m_sample_requested { false };
+
     GC::Heap m_heap;
 
     Vector<ExecutionContext*> m_execution_context_stack;
@@ -368,6 +397,9 @@ private:
 
     OwnPtr<Bytecode::Interpreter> m_bytecode_interpreter;
 
+    // NOTE: This is declared after m_heap, so that the cached ASTs (and the roots they hold) go away first.
+    OwnPtr<ProgramCache> m_program_cache;
+
     bool m_dynamic_imports_allowed { false };
 };
 
@@ -7,6 +7,7 @@
 #include <LibJS/AST.h>
 #include <LibJS/Lexer.h>
 #include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Script.h>
 
@@ -18,17 +19,24 @@ GC_DEFINE_ALLOCATOR(Script);
 Result<GC::Ref<Script>, Vector<ParserError>> Script::parse(StringView source_text, Realm& realm, StringView filename, HostDefined* host_defined, size_t line_number_offset)
 {
     // 1. Let script be ParseText(sourceText, Script).
-    auto parser = Parser(Lexer(source_text, filename, line_number_offset));
-    auto script = parser.parse_program();
+    auto& program_cache = realm.vm().program_cache();
+    auto script = program_cache.find(filename, source_text, Program::Type::Script, line_number_offset);
+    if (!script) {
+        auto parser = Parser(Lexer(source_text, filename, line_number_offset));
+        auto parsed_script = parser.parse_program();
 
-    // 2. If script is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+        // 2. If script is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
+
+        program_cache.add(filename, source_text, Program::Type::Script, line_number_offset, parsed_script);
+        script = move(parsed_script);
+    }
 
     bool strict_mode = script->is_strict_mode();
 
     // 3. Return Script Record { [[Realm]]: realm, [[ECMAScriptCode]]: script, [[HostDefined]]: hostDefined }.
-    return realm.heap().allocate<Script>(realm, filename, move(script), host_defined, strict_mode);
+    return realm.heap().allocate<Script>(realm, filename, script.release_nonnull(), host_defined, strict_mode);
 }
 
 Script::Script(Realm& realm, StringView filename, NonnullRefPtr<Program> parse_node, HostDefined* host_defined, bool strict_mode)
@@ -138,4 +138,13 @@ SourceRange SourceCode::range_from_offsets(u32 start_offset, u32 end_offset) con
     return SourceRange { *this, *start, *end };
 }
 
+ByteString const& SourceText::to_byte_string() const
+{
+    if (m_source_code) {
+        m_text = MUST(m_source_code->code().substring_view(m_start_offset, m_end_offset - m_start_offset).to_byte_string());
+        m_source_code = nullptr;
+    }
+    return m_text;
+}
+
 }
@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <AK/ByteString.h>
 #include <AK/String.h>
 #include <AK/Utf16String.h>
 #include <AK/Vector.h>
@@ -37,4 +38,30 @@ private:
     Vector<Position> mutable m_cached_positions;
 };
 
+// The [[SourceText]] of a function or class. When it refers to a range of a SourceCode, the text is
+// only transcoded to a ByteString the first time it's asked for (e.g. by Function.prototype.toString),
+// since most functions never are, and eagerly copying it is quadratic in the nesting depth.
+class JS_API SourceText {
+public:
+    SourceText() = default;
+    SourceText(ByteString text)
+        : m_text(move(text))
+    {
+    }
+    SourceText(NonnullRefPtr<SourceCode const> source_code, size_t start_offset, size_t end_offset)
+        : m_source_code(move(source_code))
+        , m_start_offset(start_offset)
+        , m_end_offset(end_offset)
+    {
+    }
+
+    ByteString const& to_byte_string() const;
+
+private:
+    mutable RefPtr<SourceCode const> m_source_code;
+    size_t m_start_offset { 0 };
+    size_t m_end_offset { 0 };
+    mutable ByteString m_text;
+};
+
 }
@@ -9,6 +9,7 @@
 #include <AK/QuickSort.h>
 #include <LibJS/Bytecode/Interpreter.h>
 #include <LibJS/Parser.h>
+#include <LibJS/ProgramCache.h>
 #include <LibJS/Runtime/AsyncFunctionDriverWrapper.h>
 #include <LibJS/Runtime/ECMAScriptFunctionObject.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
@@ -132,12 +133,20 @@ void SourceTextModule::visit_edges(Cell::Visitor& visitor)
 Result<GC::Ref<SourceTextModule>, Vector<ParserError>> SourceTextModule::parse(StringView source_text, Realm& realm, StringView filename, Script::HostDefined* host_defined)
 {
     // 1. Let body be ParseText(sourceText, Module).
-    auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
-    auto body = parser.parse_program();
-
-    // 2. If body is a List of errors, return body.
-    if (parser.has_errors())
-        return parser.errors();
+    auto& program_cache = realm.vm().program_cache();
+    auto cached_body = program_cache.find(filename, source_text, Program::Type::Module, 1);
+    if (!cached_body) {
+        auto parser = Parser(Lexer(source_text, filename), Program::Type::Module);
+        auto parsed_body = parser.parse_program();
+
+        // 2. If body is a List of errors, return body.
+        if (parser.has_errors())
+            return parser.errors();
+
+        program_cache.add(filename, source_text, Program::Type::Module, 1, parsed_body);
+        cached_body = move(parsed_body);
+    }
+    NonnullRefPtr<Program> body = cached_body.release_nonnull();
 
     // 3. Let requestedModules be the ModuleRequests of body.
     auto requested_modules = module_requests(*body);
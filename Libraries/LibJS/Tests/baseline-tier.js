@@ -0,0 +1,136 @@
+// These tests exercise paths where code compiled by the baseline tier has to hand control back to the interpreter.
+// They pass without the baseline tier, and run through native code under `test-js --baseline-tier`.
+
+test("int32 overflow in a hot loop bails out to double arithmetic", () => {
+    function sum(count) {
+        let total = 2147483600;
+        for (let i = 0; i < count; ++i) total = total + i;
+        return total;
+    }
+
+    expect(sum(10)).toBe(2147483645);
+    expect(sum(100)).toBe(2147483600 + 4950);
+});
+
+test("operands changing type mid-loop bail out", () => {
+    function accumulate(values) {
+        let total = 0;
+        for (let i = 0; i < values.length; ++i) total = total + values[i];
+        return total;
+    }
+
+    expect(accumulate([1, 2, 3, 4])).toBe(10);
+    expect(accumulate([1, 2, 0.5, 4])).toBe(7.5);
+    expect(accumulate([1, 2, "x", 4])).toBe("3x4");
+});
+
+test("increment past the int32 range bails out", () => {
+    let i = 2147483640;
+    for (let j = 0; j < 20; ++j) i++;
+    expect(i).toBe(2147483660);
+
+    let k = -2147483640;
+    for (let j = 0; j < 20; ++j) k--;
+    expect(k).toBe(-2147483660);
+});
+
+test("cached property loads bail out when the shape changes", () => {
+    function read(objects) {
+        let total = 0;
+        for (let i = 0; i < objects.length; ++i) total = total + objects[i].x;
+        return total;
+    }
+
+    let objects = [];
+    for (let i = 0; i < 100; ++i) objects.push({ x: 1 });
+    expect(read(objects)).toBe(100);
+
+    objects[50] = {
+        get x() {
+            return 1000;
+        },
+    };
+    objects[60] = { y: 1, x: 5 };
+    expect(read(objects)).toBe(98 + 1000 + 5);
+});
+
+test("cached global loads bail out when the global changes", () => {
+    globalThis.baselineTierGlobal = 1;
+    function read() {
+        let total = 0;
+        for (let i = 0; i < 100; ++i) {
+            total = total + baselineTierGlobal;
+            if (i === 49) globalThis.baselineTierGlobal = 2;
+        }
+        return total;
+    }
+
+    expect(read()).toBe(50 + 100);
+    delete globalThis.baselineTierGlobal;
+});
+
+test("exception thrown in a hot loop is caught in the same function", () => {
+    function run() {
+        let caught = 0;
+        for (let i = 0; i < 100; ++i) {
+            try {
+                if (i % 10 === 0) null.x;
+            } catch {
+                caught = caught + 1;
+            }
+        }
+        return caught;
+    }
+
+    expect(run()).toBe(10);
+});
+
+test("exception unwinds out of a hot function into its caller", () => {
+    function inner(limit) {
+        let total = 0;
+        for (let i = 0; i < 1000; ++i) {
+            total = total + i;
+            if (i === limit) throw new Error(`stopped at ${total}`);
+        }
+        return total;
+    }
+
+    function outer() {
+        let messages = [];
+        for (let i = 0; i < 5; ++i) {
+            try {
+                inner(i * 100);
+            } catch (e) {
+                messages.push(e.message);
+            }
+        }
+        return messages;
+    }
+
+    expect(outer()).toEqual(["stopped at 0", "stopped at 5050", "stopped at 20100", "stopped at 45150", "stopped at 80200"]);
+    expect(inner(5000)).toBe(499500);
+});
+
+test("finally blocks run when an exception leaves a hot loop", () => {
+    let finallyCount = 0;
+    function run() {
+        try {
+            for (let i = 0; i < 100; ++i) {
+                if (i === 90) throw i;
+            }
+        } finally {
+            finallyCount = finallyCount + 1;
+        }
+    }
+
+    let thrown = [];
+    for (let i = 0; i < 3; ++i) {
+        try {
+            run();
+        } catch (e) {
+            thrown.push(e);
+        }
+    }
+    expect(thrown).toEqual([90, 90, 90]);
+    expect(finallyCount).toBe(3);
+});
@@ -19,6 +19,41 @@ test("basic functionality", () => {
     expect(Array(3).fill(4)).toEqual([4, 4, 4]);
 });
 
+test("non-extensible arrays with holes", () => {
+    const array = [1, , 3];
+    Object.preventExtensions(array);
+    expect(() => array.fill(0)).toThrow(TypeError);
+    expect(array[0]).toBe(0);
+    expect(1 in array).toBeFalse();
+    expect(array[2]).toBe(3);
+});
+
+test("array shrunk and made non-writable-length while converting the arguments", () => {
+    const array = [1, 2, 3, 4];
+    const start = {
+        valueOf() {
+            array.length = 1;
+            Object.defineProperty(array, "length", { writable: false });
+            return 0;
+        },
+    };
+    expect(() => array.fill(0, start)).toThrow(TypeError);
+    expect(array).toHaveLength(1);
+    expect(array[0]).toBe(0);
+    expect(1 in array).toBeFalse();
+});
+
+test("array shrunk while converting the arguments", () => {
+    const array = [1, 2, 3, 4];
+    const end = {
+        valueOf() {
+            array.length = 2;
+            return 4;
+        },
+    };
+    expect(array.fill(0, 0, end)).toEqual([0, 0, 0, 0]);
+});
+
 test("is unscopable", () => {
     expect(Array.prototype[Symbol.unscopables].fill).toBeTrue();
     const array = [];
@@ -17,6 +17,38 @@ test("basic functionality", () => {
     expect(array.includes("friends", 100)).toBeFalse();
 });
 
+test("arrays of numbers", () => {
+    const int32s = [1, 2, 3, 0];
+    expect(int32s.includes(3)).toBeTrue();
+    expect(int32s.includes(3.5)).toBeFalse();
+    expect(int32s.includes(-0)).toBeTrue();
+    expect(int32s.includes("3")).toBeFalse();
+
+    const numbers = [1.5, NaN, 3];
+    expect(numbers.includes(NaN)).toBeTrue();
+    expect(numbers.includes(1.5)).toBeTrue();
+    expect(numbers.includes(2)).toBeFalse();
+});
+
+test("holes read as undefined", () => {
+    expect([1, , 3].includes(undefined)).toBeTrue();
+    expect([1, , 3].includes(undefined, 2)).toBeFalse();
+    expect([1, , 3].includes(2)).toBeFalse();
+});
+
+test("array shrinking while converting fromIndex", () => {
+    const array = [1, 2, 3];
+    const fromIndex = {
+        valueOf() {
+            array.length = 1;
+            return 0;
+        },
+    };
+    expect(array.includes(undefined, fromIndex)).toBeTrue();
+    array.push(2, 3);
+    expect(array.includes(3, fromIndex)).toBeFalse();
+});
+
 test("is unscopable", () => {
     expect(Array.prototype[Symbol.unscopables].includes).toBeTrue();
     const array = [];
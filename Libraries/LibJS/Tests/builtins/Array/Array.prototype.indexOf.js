@@ -23,3 +23,22 @@ test("basic functionality", () => {
     expect([].indexOf()).toBe(-1);
     expect([undefined].indexOf()).toBe(0);
 });
+
+test("arrays of numbers", () => {
+    const int32s = [1, 2, 3, 0];
+    expect(int32s.indexOf(3)).toBe(2);
+    expect(int32s.indexOf(3.5)).toBe(-1);
+    expect(int32s.indexOf(-0)).toBe(3);
+    expect(int32s.indexOf("3")).toBe(-1);
+
+    const numbers = [1.5, NaN, 3];
+    expect(numbers.indexOf(NaN)).toBe(-1);
+    expect(numbers.indexOf(1.5)).toBe(0);
+    expect(numbers.indexOf(3)).toBe(2);
+});
+
+test("holes are skipped", () => {
+    expect([1, , 3].indexOf(undefined)).toBe(-1);
+    expect([1, , 3, undefined].indexOf(undefined)).toBe(3);
+    expect([1, , 3].indexOf(3)).toBe(2);
+});
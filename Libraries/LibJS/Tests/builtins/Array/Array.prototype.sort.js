@@ -202,3 +202,54 @@ describe("Array.prototype.sort", () => {
         Array.prototype.sort.call(obj);
     });
 });
+
+describe("long arrays", () => {
+    test("default comparator on primitives", () => {
+        const arr = [];
+        for (let i = 0; i < 500; ++i) arr.push((i * 7919) % 500);
+        arr.push(undefined, "abc", true, null, 10n, -0, NaN);
+        arr.sort();
+
+        for (let i = 1; i < arr.length; ++i) {
+            if (arr[i] === undefined) continue;
+            expect(String(arr[i - 1]) <= String(arr[i])).toBeTrue();
+        }
+        expect(arr[arr.length - 1]).toBeUndefined();
+        expect(arr.indexOf(10n)).toBe(arr.indexOf(10) + 1);
+    });
+
+    test("default comparator is stable", () => {
+        const arr = [];
+        for (let i = 0; i < 100; ++i) arr.push(i % 3 === 0 ? String(i % 10) : i % 10);
+        const expected = [];
+        for (let key = 0; key < 10; ++key) expected.push(...arr.filter(value => String(value) === String(key)));
+
+        arr.sort();
+        expect(arr).toEqual(expected);
+    });
+
+    test("custom comparator", () => {
+        const arr = [];
+        for (let i = 0; i < 1000; ++i) arr.push({ key: (i * 7919) % 100, index: i });
+        arr.sort((a, b) => a.key - b.key);
+
+        for (let i = 1; i < arr.length; ++i) {
+            expect(arr[i - 1].key <= arr[i].key).toBeTrue();
+            if (arr[i - 1].key === arr[i].key) expect(arr[i - 1].index < arr[i].index).toBeTrue();
+        }
+    });
+
+    test("custom comparator throwing midway", () => {
+        const arr = [];
+        for (let i = 0; i < 100; ++i) arr.push(100 - i);
+
+        let calls = 0;
+        expect(() =>
+            arr.sort((a, b) => {
+                if (++calls === 50) throw new Error("stop");
+                return a - b;
+            })
+        ).toThrow(Error);
+        expect(calls).toBe(50);
+    });
+});
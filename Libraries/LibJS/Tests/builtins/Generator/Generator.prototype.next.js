@@ -0,0 +1,36 @@
+describe("correct behavior", () => {
+    function* generatorFunction() {
+        const a = yield 1;
+        const b = yield a + 1;
+        return b + 1;
+    }
+
+    test("length is 1", () => {
+        expect(generatorFunction.prototype.next).toHaveLength(1);
+    });
+
+    test("passing a value to next", () => {
+        const gen = generatorFunction();
+        expect(gen.next()).toEqual({ value: 1, done: false });
+        expect(gen.next(1)).toEqual({ value: 2, done: false });
+        expect(gen.next(41)).toEqual({ value: 42, done: true });
+        expect(gen.next(1)).toEqual({ value: undefined, done: true });
+    });
+
+    test("called through a binding named like the builtin", () => {
+        // Calls of the form `GeneratorPrototype.next(x)` are compiled to a CallBuiltin instruction.
+        const GeneratorPrototype = generatorFunction();
+        expect(GeneratorPrototype.next(1)).toEqual({ value: 1, done: false });
+        expect(GeneratorPrototype.next(1)).toEqual({ value: 2, done: false });
+        expect(GeneratorPrototype.next(41)).toEqual({ value: 42, done: true });
+    });
+});
+
+describe("errors", () => {
+    test("this value must be a generator", () => {
+        const GeneratorPrototype = Object.getPrototypeOf(function* () {}).prototype;
+        expect(() => {
+            GeneratorPrototype.next(1);
+        }).toThrowWithMessage(TypeError, "Not an object of type Generator");
+    });
+});
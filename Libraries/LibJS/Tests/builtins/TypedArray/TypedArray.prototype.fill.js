@@ -76,3 +76,37 @@ test("basic functionality", () => {
         expect(typedArray[2]).toBe(0n);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(50);
+        expect(typedArray.fill(3, 1, 47)).toBe(typedArray);
+
+        expect(typedArray[0]).toBe(0);
+        for (let i = 1; i < 47; ++i) expect(typedArray[i]).toBe(3);
+        expect(typedArray[47]).toBe(0);
+        expect(typedArray[49]).toBe(0);
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(20);
+        expect(typedArray.fill(-2n, 3)).toBe(typedArray);
+
+        expect(typedArray[2]).toBe(0n);
+        for (let i = 3; i < 20; ++i) expect(typedArray[i]).toBe(T === BigInt64Array ? -2n : 2n ** 64n - 2n);
+    });
+});
+
+test("value conversion", () => {
+    const float32Array = new Float32Array(20).fill(0.1);
+    float32Array.forEach(value => expect(value).toBe(Math.fround(0.1)));
+
+    const float64Array = new Float64Array(20).fill(-0);
+    float64Array.forEach(value => expect(Object.is(value, -0)).toBeTrue());
+
+    const clampedArray = new Uint8ClampedArray(20).fill(300);
+    clampedArray.forEach(value => expect(value).toBe(255));
+
+    const int16Array = new Int16Array(20).fill(65535.5);
+    int16Array.forEach(value => expect(value).toBe(-1));
+});
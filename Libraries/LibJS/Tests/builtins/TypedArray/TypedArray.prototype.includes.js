@@ -63,3 +63,42 @@ test("basic functionality", () => {
         expect(typedArray.includes(2n, -2)).toBe(true);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+        typedArray[37] = 7;
+        typedArray[99] = 9;
+
+        expect(typedArray.includes(7)).toBe(true);
+        expect(typedArray.includes(7, 38)).toBe(false);
+        expect(typedArray.includes(9)).toBe(true);
+        expect(typedArray.includes(9, -1)).toBe(true);
+        expect(typedArray.includes(8)).toBe(false);
+        expect(typedArray.includes(7.5)).toBe(false);
+        expect(typedArray.includes(-0)).toBe(true);
+        expect(typedArray.includes("7")).toBe(false);
+    });
+});
+
+test("values that can't be represented by the element type", () => {
+    expect(new Uint8Array([255]).includes(-1)).toBe(false);
+    expect(new Int8Array([-1]).includes(255)).toBe(false);
+    expect(new Uint8ClampedArray([255]).includes(300)).toBe(false);
+    expect(new Float32Array([0.1]).includes(0.1)).toBe(false);
+    expect(new Float32Array([0.5]).includes(0.5)).toBe(true);
+    expect(new Float32Array([Infinity]).includes(1e300)).toBe(false);
+    expect(new Float32Array([Infinity]).includes(Infinity)).toBe(true);
+});
+
+test("NaN", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T(50);
+        expect(typedArray.includes(NaN)).toBe(false);
+        typedArray[42] = NaN;
+        expect(typedArray.includes(NaN)).toBe(true);
+        expect(typedArray.includes(NaN, 43)).toBe(false);
+    });
+
+    expect(new Int32Array(50).includes(NaN)).toBe(false);
+});
@@ -63,3 +63,36 @@ test("basic functionality", () => {
         expect(typedArray.indexOf(2n, -2)).toBe(1);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(100);
+        typedArray[37] = 7;
+        typedArray[99] = 7;
+
+        expect(typedArray.indexOf(7)).toBe(37);
+        expect(typedArray.indexOf(7, 38)).toBe(99);
+        expect(typedArray.indexOf(7, -1)).toBe(99);
+        expect(typedArray.indexOf(8)).toBe(-1);
+        expect(typedArray.indexOf(7.5)).toBe(-1);
+        expect(typedArray.indexOf(-0)).toBe(0);
+        expect(typedArray.indexOf(0, 37)).toBe(38);
+        expect(typedArray.indexOf("7")).toBe(-1);
+    });
+});
+
+test("NaN is never found", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T(50);
+        typedArray[42] = NaN;
+        expect(typedArray.indexOf(NaN)).toBe(-1);
+    });
+});
+
+test("values that can't be represented by the element type", () => {
+    expect(new Uint16Array([65535]).indexOf(-1)).toBe(-1);
+    expect(new Int16Array([-1]).indexOf(65535)).toBe(-1);
+    expect(new Uint32Array([1]).indexOf(2 ** 32 + 1)).toBe(-1);
+    expect(new Float32Array([0.1]).indexOf(0.1)).toBe(-1);
+    expect(new Float32Array([0.25]).indexOf(0.25)).toBe(0);
+});
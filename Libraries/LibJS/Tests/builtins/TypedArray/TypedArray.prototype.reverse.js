@@ -86,3 +86,29 @@ describe("basic functionality", () => {
         });
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        [37, 38].forEach(length => {
+            const array = new T(length);
+            for (let i = 0; i < length; ++i) array[i] = i;
+
+            expect(array.reverse()).toBe(array);
+            for (let i = 0; i < length; ++i) expect(array[i]).toBe(length - 1 - i);
+        });
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const array = new T(5);
+        for (let i = 0; i < 5; ++i) array[i] = BigInt(i);
+
+        expect(array.reverse()).toBe(array);
+        for (let i = 0; i < 5; ++i) expect(array[i]).toBe(BigInt(4 - i));
+    });
+});
+
+test("subarray", () => {
+    const array = new Uint8Array([0, 1, 2, 3, 4, 5]);
+    array.subarray(1, 5).reverse();
+    expect(array).toEqual(new Uint8Array([0, 4, 3, 2, 1, 5]));
+});
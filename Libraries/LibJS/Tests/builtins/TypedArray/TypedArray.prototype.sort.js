@@ -90,3 +90,39 @@ test("detached buffer", () => {
         expect(typedArray[2]).toBeUndefined();
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        [10, 1000].forEach(length => {
+            const typedArray = new T(length);
+            for (let i = 0; i < length; ++i) typedArray[i] = ((i * 7919) % 251) - 100;
+
+            expect(typedArray.sort()).toBe(typedArray);
+            for (let i = 1; i < length; ++i) expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+        });
+    });
+
+    BIGINT_TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < 1000; ++i) typedArray[i] = BigInt((i * 7919) % 1009) * 2n ** 40n - 2n ** 50n;
+
+        expect(typedArray.sort()).toBe(typedArray);
+        for (let i = 1; i < 1000; ++i) expect(typedArray[i - 1] <= typedArray[i]).toBeTrue();
+    });
+});
+
+test("NaN and negative zero", () => {
+    [Float16Array, Float32Array, Float64Array].forEach(T => {
+        const typedArray = new T([NaN, 0, -Infinity, -0, NaN, 1, -0, Infinity]);
+        typedArray.sort();
+
+        expect(typedArray[0]).toBe(-Infinity);
+        expect(typedArray[1]).toBe(-0);
+        expect(typedArray[2]).toBe(-0);
+        expect(typedArray[3]).toBe(0);
+        expect(typedArray[4]).toBe(1);
+        expect(typedArray[5]).toBe(Infinity);
+        expect(typedArray[6]).toBeNaN();
+        expect(typedArray[7]).toBeNaN();
+    });
+});
@@ -123,3 +123,16 @@ test("detached buffer", () => {
         expect(sortedTypedArray[2]).toBe(3);
     });
 });
+
+test("long arrays", () => {
+    TYPED_ARRAYS.forEach(T => {
+        const typedArray = new T(1000);
+        for (let i = 0; i < 1000; ++i) typedArray[i] = ((i * 7919) % 251) - 100;
+        const copy = new T(typedArray);
+
+        const sortedTypedArray = typedArray.toSorted();
+        expect(sortedTypedArray).not.toBe(typedArray);
+        expect(typedArray).toEqual(copy);
+        for (let i = 1; i < 1000; ++i) expect(sortedTypedArray[i - 1] <= sortedTypedArray[i]).toBeTrue();
+    });
+});
@@ -0,0 +1,83 @@
+// Objects that survived a collection are not traced by young generation collections, so anything stored into them
+// afterwards has to be found through the remembered set (or by rescanning them, for cells without write barriers).
+
+class WithPrivateField {
+    #value;
+    set(value) {
+        this.#value = value;
+    }
+    get() {
+        return this.#value;
+    }
+}
+
+function makeOldObjects() {
+    const old = {
+        object: {},
+        dictionary: {},
+        array: [],
+        sparseArray: [],
+        map: new Map(),
+        withPrivateField: new WithPrivateField(),
+        withPrototype: {},
+    };
+    for (let i = 0; i < 100; ++i) old.dictionary["key" + i] = i;
+    for (let i = 0; i < 10; ++i) delete old.dictionary["key" + i];
+    old.sparseArray[100_000] = 0;
+    return old;
+}
+
+function storeYoungObjects(old, round) {
+    old.object["young" + round] = { round };
+    old.dictionary["young" + round] = { round };
+    old.array.push({ round });
+    old.sparseArray[round] = { round };
+    old.map.set(round, { round });
+    old.withPrivateField.set({ round });
+    Object.setPrototypeOf(old.withPrototype, { round });
+}
+
+function makeGarbage() {
+    let garbage = [];
+    for (let i = 0; i < 10_000; ++i) garbage.push({ i, string: "garbage" + i });
+    return garbage.length;
+}
+
+test("cells stored into old cells survive young generation collections", () => {
+    const old = makeOldObjects();
+    gc();
+
+    for (let round = 0; round < 5; ++round) {
+        storeYoungObjects(old, round);
+        makeGarbage();
+        collectYoungGeneration();
+        makeGarbage();
+        collectYoungGeneration();
+
+        for (let i = 0; i <= round; ++i) {
+            expect(old.object["young" + i].round).toBe(i);
+            expect(old.dictionary["young" + i].round).toBe(i);
+            expect(old.array[i].round).toBe(i);
+            expect(old.sparseArray[i].round).toBe(i);
+            expect(old.map.get(i).round).toBe(i);
+        }
+        expect(old.withPrivateField.get().round).toBe(round);
+        expect(Object.getPrototypeOf(old.withPrototype).round).toBe(round);
+    }
+});
+
+test("cells stored into old cells survive a full collection in between", () => {
+    const old = makeOldObjects();
+    collectYoungGeneration();
+    storeYoungObjects(old, 0);
+    gc();
+    storeYoungObjects(old, 1);
+    makeGarbage();
+    collectYoungGeneration();
+
+    expect(old.object.young0.round).toBe(0);
+    expect(old.object.young1.round).toBe(1);
+    expect(old.array.map(value => value.round)).toEqual([0, 1]);
+    expect(old.map.get(1).round).toBe(1);
+    expect(old.withPrivateField.get().round).toBe(1);
+});
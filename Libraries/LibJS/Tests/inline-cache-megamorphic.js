@@ -0,0 +1,58 @@
+// The cache statistics are only counted in builds with JS_PROPERTY_LOOKUP_CACHE_DEBUG.
+const testWithStatistics = getPropertyLookupCacheStatistics() !== undefined ? test : test.skip;
+
+function makeObjectsWithDistinctShapes(count, propertyName) {
+    const objects = [];
+    for (let i = 0; i < count; ++i) {
+        const object = {};
+        object["unique" + i] = i;
+        object[propertyName] = i;
+        objects.push(object);
+    }
+    return objects;
+}
+
+testWithStatistics("sites that see many shapes are served by the megamorphic cache", () => {
+    function read(object) {
+        return object.x;
+    }
+
+    const objects = makeObjectsWithDistinctShapes(16, "x");
+    const before = getPropertyLookupCacheStatistics();
+
+    let total = 0;
+    for (let round = 0; round < 10; ++round) {
+        for (let i = 0; i < objects.length; ++i) total += read(objects[i]);
+    }
+
+    const after = getPropertyLookupCacheStatistics();
+    expect(total).toBe(10 * 120);
+    expect(after.megamorphicTransitions).toBeGreaterThan(before.megamorphicTransitions);
+    // After the first round, the 12 shapes that don't fit into the site's own entries should (almost) always hit.
+    expect(after.megamorphicHits - before.megamorphicHits).toBeGreaterThanOrEqual((9 * 12) / 2);
+});
+
+testWithStatistics("sites that were briefly megamorphic go back to their own entries", () => {
+    function read(object) {
+        return object.y;
+    }
+
+    for (const object of makeObjectsWithDistinctShapes(8, "y")) read(object);
+
+    const monomorphic = { y: 1 };
+    const before = getPropertyLookupCacheStatistics();
+
+    let total = 0;
+    for (let i = 0; i < 2000; ++i) total += read(monomorphic);
+
+    const afterReset = getPropertyLookupCacheStatistics();
+    expect(total).toBe(2000);
+    expect(afterReset.megamorphicResets).toBeGreaterThan(before.megamorphicResets);
+
+    // Once the site has forgotten the old shapes, lookups no longer go through the megamorphic cache.
+    for (let i = 0; i < 500; ++i) total += read(monomorphic);
+
+    const end = getPropertyLookupCacheStatistics();
+    expect(total).toBe(2500);
+    expect(end.megamorphicHits).toBe(afterReset.megamorphicHits);
+});
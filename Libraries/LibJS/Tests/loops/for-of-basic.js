@@ -153,3 +153,61 @@ describe("special left hand sides", () => {
         expect(vals).toEqual([1, 2]);
     });
 });
+
+describe("generators", () => {
+    test("iterating a generator", () => {
+        function* generator() {
+            yield 1;
+            yield 2;
+            return 3;
+        }
+
+        const values = [];
+        for (const value of generator()) values.push(value);
+        expect(values).toEqual([1, 2]);
+        expect([...generator()]).toEqual([1, 2]);
+
+        const [a, b, c] = generator();
+        expect(a).toBe(1);
+        expect(b).toBe(2);
+        expect(c).toBeUndefined();
+    });
+
+    test("breaking out of a generator runs its finally blocks", () => {
+        let finallyRan = false;
+        function* generator() {
+            try {
+                yield 1;
+                yield 2;
+            } finally {
+                finallyRan = true;
+            }
+        }
+
+        for (const value of generator()) break;
+        expect(finallyRan).toBeTrue();
+    });
+
+    test("a redefined next method is called", () => {
+        function* generator() {
+            yield 1;
+        }
+
+        const iterator = generator();
+        iterator.next = () => ({ value: 42, done: iterator.done++ > 0 });
+        iterator.done = 0;
+
+        const values = [];
+        for (const value of iterator) values.push(value);
+        expect(values).toEqual([42]);
+    });
+
+    test("a generator that is already running", () => {
+        function* generator() {
+            for (const value of iterator) yield value;
+        }
+
+        const iterator = generator();
+        expect(() => iterator.next()).toThrowWithMessage(TypeError, "Generator is already executing");
+    });
+});
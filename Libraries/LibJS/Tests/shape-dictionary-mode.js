@@ -0,0 +1,30 @@
+test("objects with lots of properties switch to a dictionary shape", () => {
+    const dictionaryShapesBefore = getShapeCounts().dictionaryShapes;
+
+    const o = {};
+    for (let i = 0; i < 1000; ++i) o["key" + i] = i;
+
+    expect(getShapeCounts().dictionaryShapes).toBeGreaterThan(dictionaryShapesBefore);
+    expect(o.key0).toBe(0);
+    expect(o.key999).toBe(999);
+});
+
+test("objects that keep losing properties switch to a dictionary shape", () => {
+    const dictionaryShapesBefore = getShapeCounts().dictionaryShapes;
+
+    const o = {};
+    for (let i = 0; i < 32; ++i) o["key" + i] = i;
+    for (let i = 0; i < 16; ++i) delete o["key" + i];
+
+    expect(getShapeCounts().dictionaryShapes).toBeGreaterThan(dictionaryShapesBefore);
+    expect(Object.keys(o)).toHaveLength(16);
+    expect(o.key15).toBeUndefined();
+    expect(o.key16).toBe(16);
+    expect(o.key31).toBe(31);
+});
+
+test("shape counts cover the shapes of new objects", () => {
+    const counts = getShapeCounts();
+    expect(counts.shapes).toBeGreaterThan(0);
+    expect(counts.shapes).toBeGreaterThanOrEqual(counts.dictionaryShapes);
+});
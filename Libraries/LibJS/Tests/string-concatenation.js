@@ -28,3 +28,35 @@ test("adding strings with dangling surrogates", () => {
     expect("\ud834a" + "\udf06").toBe("\ud834a\udf06");
     expect("\ud834" + "a\udf06").toBe("\ud834a\udf06");
 });
+
+test("long concatenations are flattened on demand", () => {
+    const countsBefore = getRopeFlatteningCounts();
+
+    let string = "";
+    for (let i = 0; i < 1000; ++i) string += "abcdefghij";
+
+    expect(string).toHaveLength(10000);
+    expect(string.charCodeAt(9999)).toBe("j".charCodeAt(0));
+
+    const countsAfter = getRopeFlatteningCounts();
+    expect(countsAfter.ropes).toBeGreaterThan(countsBefore.ropes);
+    expect(countsAfter.bytes - countsBefore.bytes).toBeGreaterThanOrEqual(10000);
+});
+
+test("mixing UTF-8 and UTF-16 pieces", () => {
+    const utf16Piece = String.fromCharCode(0xd83d, 0x41);
+    let string = "long enough to become a rope ";
+    string += utf16Piece;
+    string += "\ude00 and some more text";
+
+    expect(string.charCodeAt(29)).toBe(0xd83d);
+    expect(string.charCodeAt(30)).toBe(0x41);
+    expect(string.charCodeAt(31)).toBe(0xde00);
+    expect(string.endsWith("and some more text")).toBeTrue();
+});
+
+test("adding long strings with dangling surrogates", () => {
+    const highSurrogates = "long enough for a rope \ud834";
+    const lowSurrogates = "\udf06 and long enough too";
+    expect((highSurrogates + lowSurrogates).indexOf("𝌆")).toBe(23);
+});
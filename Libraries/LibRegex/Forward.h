@@ -20,6 +20,7 @@ class ECMA262Parser;
 
 class ByteCode;
 class OpCode;
+class ThreadedByteCode;
 class OpCode_Exit;
 class OpCode_Jump;
 class OpCode_ForkJump;
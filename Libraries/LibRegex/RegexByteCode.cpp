@@ -1246,4 +1246,59 @@ ALWAYS_INLINE ExecutionResult OpCode_JumpNonEmpty::execute(MatchInput const& inp
     return ExecutionResult::Continue;
 }
 
+NonnullOwnPtr<ThreadedByteCode> ThreadedByteCode::create(ByteCode const& bytecode)
+{
+    auto threaded_bytecode = adopt_own(*new ThreadedByteCode);
+    auto code = bytecode.flat_data();
+    threaded_bytecode->m_code.append(code.data(), code.size());
+    return threaded_bytecode;
+}
+
+Optional<ThreadedByteCode::StepResult> ThreadedByteCode::run(ByteCode const& bytecode, MatchInput const& input, MatchState& state, size_t& operations, size_t operations_limit) const
+{
+    // This is a GCC extension, but it's also supported by Clang.
+    static void* const dispatch_table[] = {
+#define __ENUMERATE_OPCODE(OpCode) &&handle_##OpCode,
+        ENUMERATE_OPCODES
+#undef __ENUMERATE_OPCODE
+    };
+
+    auto const* code = m_code.data();
+    auto code_size = m_code.size();
+
+    // NOTE: Positions past the end of the bytecode decode to Exit, just like ByteCode::get_opcode().
+#define DISPATCH()                                                                                                \
+    do {                                                                                                          \
+        auto opcode_id = state.instruction_position < code_size ? code[state.instruction_position]               \
+                                                                : static_cast<ByteCodeValueType>(OpCodeId::Exit); \
+        VERIFY(opcode_id <= static_cast<ByteCodeValueType>(OpCodeId::Last));                                      \
+        goto* dispatch_table[opcode_id];                                                                          \
+    } while (0)
+
+    DISPATCH();
+
+    // NOTE: The qualified calls bypass virtual dispatch, letting the (ALWAYS_INLINE) size() and execute() be inlined.
+#define __ENUMERATE_OPCODE(OpCode)                                                                          \
+    handle_##OpCode:                                                                                        \
+    {                                                                                                       \
+        if (++operations >= operations_limit)                                                               \
+            return {};                                                                                      \
+        auto& opcode = static_cast<OpCode_##OpCode&>(bytecode.get_opcode_by_id(OpCodeId::OpCode));          \
+        opcode.set_state(state);                                                                            \
+        auto opcode_size = opcode.OpCode_##OpCode::size();                                                  \
+        auto result = opcode.OpCode_##OpCode::execute(input, state);                                        \
+        state.instruction_position += opcode_size;                                                          \
+        if (result != ExecutionResult::Continue || input.fail_counter > 0)                                  \
+            return StepResult { result, opcode_size };                                                      \
+        DISPATCH();                                                                                         \
+    }
+
+    ENUMERATE_OPCODES
+
+#undef __ENUMERATE_OPCODE
+#undef DISPATCH
+
+    VERIFY_NOT_REACHED();
+}
+
 }
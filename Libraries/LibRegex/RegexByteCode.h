@@ -618,6 +618,8 @@ public:
     static void reset_checkpoint_serial_id() { s_next_checkpoint_serial_id = 0; }
 
 private:
+    friend class ThreadedByteCode;
+
     void insert_string(StringView view)
     {
         empend((ByteCodeValueType)view.length());
@@ -943,6 +945,31 @@ public:
     }
 };
 
+// A threaded form of a ByteCode, used by the matcher for patterns that are executed often.
+// It keeps its own contiguous copy of the (flattened) bytecode, and dispatches on the opcode at each position
+// straight to code for that concrete opcode with computed gotos, so neither the DisjointChunks lookup nor
+// virtual dispatch is needed to get from one instruction to the next.
+class REGEX_API ThreadedByteCode {
+public:
+    struct StepResult {
+        ExecutionResult result;
+        size_t opcode_size { 0 };
+    };
+
+    static NonnullOwnPtr<ThreadedByteCode> create(ByteCode const&);
+
+    // Runs instructions from state.instruction_position for as long as each one simply continues, and returns the
+    // first other result (with the instruction position already advanced past the instruction that produced it).
+    // Also returns (with Continue) once input.fail_counter is set, which the matcher has to deal with itself.
+    // Returns an empty Optional if operations_limit was reached.
+    Optional<StepResult> run(ByteCode const&, MatchInput const&, MatchState&, size_t& operations, size_t operations_limit) const;
+
+private:
+    ThreadedByteCode() = default;
+
+    Vector<ByteCodeValueType> m_code;
+};
+
 ALWAYS_INLINE OpCode& ByteCode::get_opcode(regex::MatchState& state) const
 {
     OpCodeId opcode_id;
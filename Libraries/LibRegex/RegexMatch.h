@@ -51,6 +51,20 @@ public:
         return m_view.get<Utf16View>();
     }
 
+    // Calls `callback` with the underlying code units, as a span of u8 (UTF-8 or ASCII storage) or of u16 (UTF-16 storage).
+    template<typename Callback>
+    decltype(auto) visit_code_units(Callback callback) const
+    {
+        return m_view.visit(
+            [&](StringView view) { return callback(view.bytes()); },
+            [&](Utf16View const& view) {
+                if (view.has_ascii_storage())
+                    return callback(view.bytes());
+                auto code_units = view.utf16_span();
+                return callback(ReadonlySpan<u16> { reinterpret_cast<u16 const*>(code_units.data()), code_units.size() });
+            });
+    }
+
     bool unicode() const { return m_unicode; }
     void set_unicode(bool unicode) { m_unicode = unicode; }
 
@@ -8,6 +8,8 @@
 #include <AK/BumpAllocator.h>
 #include <AK/ByteString.h>
 #include <AK/Debug.h>
+#include <AK/SIMD.h>
+#include <AK/SIMDExtras.h>
 #include <AK/StringBuilder.h>
 #include <LibRegex/RegexMatcher.h>
 #include <LibRegex/RegexParser.h>
@@ -22,6 +24,84 @@ namespace regex {
 static RegexDebug s_regex_dbg(stderr);
 #endif
 
+// Apart from captures (which don't affect whether a thread can match), a thread's future in the linear engine only
+// depends on its instruction, its repetition counters, and which of its loop iterations haven't consumed anything yet.
+struct LinearThreadKey {
+    size_t instruction_position { 0 };
+    COWVector<u64> repetition_marks;
+    Vector<size_t, 4> checkpoints_without_progress;
+
+    explicit LinearThreadKey(MatchState const& state)
+        : instruction_position(state.instruction_position)
+        , repetition_marks(state.repetition_marks)
+    {
+        for (size_t id = 0; id < state.checkpoints.size(); ++id) {
+            if (state.checkpoints[id] == state.string_position + 1)
+                checkpoints_without_progress.append(id);
+        }
+    }
+};
+
+struct LinearThreadKeyTraits : public DefaultTraits<LinearThreadKey> {
+    static unsigned hash(LinearThreadKey const& key)
+    {
+        auto hash = u64_hash(key.instruction_position);
+        for (auto mark : key.repetition_marks)
+            hash = pair_int_hash(hash, u64_hash(mark));
+        for (auto id : key.checkpoints_without_progress)
+            hash = pair_int_hash(hash, u64_hash(id));
+        return hash;
+    }
+
+    static bool equals(LinearThreadKey const& a, LinearThreadKey const& b)
+    {
+        return a.instruction_position == b.instruction_position
+            && a.repetition_marks.span() == b.repetition_marks.span()
+            && a.checkpoints_without_progress == b.checkpoints_without_progress;
+    }
+};
+
+// Finds the first position at or after `start` where `prefix` (which is ASCII) occurs, looking for
+// its first character a whole vector of code units at a time.
+template<typename CodeUnit>
+static Optional<size_t> find_literal_prefix(ReadonlySpan<CodeUnit> haystack, size_t start, StringView prefix)
+{
+    using VectorType = Conditional<sizeof(CodeUnit) == 1, AK::SIMD::u8x16, AK::SIMD::u16x8>;
+    static constexpr size_t code_units_per_vector = AK::SIMD::vector_length<VectorType>;
+
+    auto first_code_unit = static_cast<CodeUnit>(prefix[0]);
+    auto is_match_at = [&](size_t position) {
+        if (haystack[position] != first_code_unit || position + prefix.length() > haystack.size())
+            return false;
+        for (size_t i = 1; i < prefix.length(); ++i) {
+            if (haystack[position + i] != static_cast<CodeUnit>(prefix[i]))
+                return false;
+        }
+        return true;
+    };
+
+    VectorType needle;
+    for (size_t i = 0; i < code_units_per_vector; ++i)
+        needle[i] = first_code_unit;
+
+    auto position = start;
+    for (; position + code_units_per_vector <= haystack.size(); position += code_units_per_vector) {
+        auto code_units = AK::SIMD::load_unaligned<VectorType>(haystack.offset_pointer(position));
+        auto matching_lanes = bit_cast<AK::SIMD::u64x2>(code_units == needle);
+        if ((matching_lanes[0] | matching_lanes[1]) == 0)
+            continue;
+        for (size_t i = 0; i < code_units_per_vector; ++i) {
+            if (is_match_at(position + i))
+                return position + i;
+        }
+    }
+    for (; position < haystack.size(); ++position) {
+        if (is_match_at(position))
+            return position;
+    }
+    return {};
+}
+
 template<class Parser>
 regex::Parser::Result Regex<Parser>::parse_pattern(StringView pattern, typename ParserTraits<Parser>::OptionsType regex_options)
 {
@@ -103,6 +183,10 @@ Regex<Parser>::Regex(Regex&& regex)
     , parser_result(move(regex.parser_result))
     , matcher(move(regex.matcher))
     , start_offset(regex.start_offset)
+    , match_count_for_tiering(regex.match_count_for_tiering)
+    , threaded_bytecode(move(regex.threaded_bytecode))
+    , use_linear_engine(regex.use_linear_engine)
+    , linear_engine_gave_up(regex.linear_engine_gave_up)
 {
     if (matcher)
         matcher->reset_pattern({}, this);
@@ -117,6 +201,10 @@ Regex<Parser>& Regex<Parser>::operator=(Regex&& regex)
     if (matcher)
         matcher->reset_pattern({}, this);
     start_offset = regex.start_offset;
+    match_count_for_tiering = regex.match_count_for_tiering;
+    threaded_bytecode = move(regex.threaded_bytecode);
+    use_linear_engine = regex.use_linear_engine;
+    linear_engine_gave_up = regex.linear_engine_gave_up;
     return *this;
 }
 
@@ -164,6 +252,9 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
     if (!((AllFlags)m_regex_options.value() & AllFlags::Internal_Stateful))
         m_pattern->start_offset = 0;
 
+    if (!m_pattern->threaded_bytecode && ++m_pattern->match_count_for_tiering >= c_threaded_bytecode_match_threshold)
+        m_pattern->threaded_bytecode = ThreadedByteCode::create(m_pattern->parser_result.bytecode);
+
     size_t match_count { 0 };
 
     MatchInput input;
@@ -210,6 +301,53 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
 
     auto single_match_only = input.regex_options.has_flag_set(AllFlags::SingleMatch);
     auto only_start_of_line = m_pattern->parser_result.optimization_data.only_start_of_line && !input.regex_options.has_flag_set(AllFlags::Multiline);
+    auto tries_all_starting_positions = continue_search && !only_start_of_line;
+
+    // NOTE: The prefix is searched for by code unit, which only lines up with view_index in non-Unicode mode.
+    auto const& literal_prefix = m_pattern->parser_result.optimization_data.literal_prefix;
+    auto skip_to_literal_prefix = tries_all_starting_positions
+        && !literal_prefix.is_empty()
+        && !input.regex_options.has_flag_set(AllFlags::Insensitive);
+
+    // Runs the pattern from state.string_position, and returns the position the match starts at (if any).
+    // If `search` is set and the linear engine is in use, later starting positions are tried in the same pass.
+    auto run_linear = [&](size_t& operations, bool search) -> Optional<size_t> {
+        auto start_position = state.string_position;
+        auto state_before_linear_engine = state;
+        auto result = execute_linear(input, state, operations, search);
+        if (!result.is_error())
+            return result.release_value();
+
+        // NOTE: The bytecode didn't hold up to what the linear engine expects of it after all, so don't use it again.
+        dbgln_if(REGEX_DEBUG, "[match] The linear engine gave up: {}", result.error());
+        m_pattern->use_linear_engine = false;
+        m_pattern->linear_engine_gave_up = true;
+        state = move(state_before_linear_engine);
+        return execute(input, state, operations) ? start_position : Optional<size_t> {};
+    };
+
+    auto run = [&](size_t& operations, bool search) -> Optional<size_t> {
+        auto start_position = state.string_position;
+        if (m_pattern->use_linear_engine)
+            return run_linear(operations, search);
+        if (!m_pattern->parser_result.optimization_data.supports_linear_engine || m_pattern->linear_engine_gave_up)
+            return execute(input, state, operations) ? start_position : Optional<size_t> {};
+
+        // Backtracking is faster for most patterns, but takes exponential time on some (e.g. /(a+)+$/).
+        // Once it goes way over what the linear engine would need, switch the pattern over for good.
+        auto remaining_length = input.view.length() - start_position + 1;
+        auto operations_limit = operations + c_linear_engine_fallback_factor * m_pattern->parser_result.bytecode.size() * remaining_length;
+        auto state_before_backtracking = state;
+        if (execute(input, state, operations, operations_limit))
+            return start_position;
+        if (operations < operations_limit)
+            return {};
+
+        dbgln_if(REGEX_DEBUG, "[match] Backtracking took too long, switching to the linear engine");
+        m_pattern->use_linear_engine = true;
+        state = move(state_before_backtracking);
+        return run_linear(operations, search);
+    };
 
     auto compare_range = [insensitive = input.regex_options & AllFlags::Insensitive](auto needle, CharRange range) {
         auto upper_case_needle = needle;
@@ -262,7 +400,7 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            auto success = execute(input, state, temp_operations);
+            auto success = run(temp_operations, false).has_value();
             // This success is acceptable only if it doesn't read anything from the input (input length is 0).
             if (success && (state.string_position <= view_index)) {
                 operations = temp_operations;
@@ -280,6 +418,15 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
         }
 
         for (; view_index <= view_length; ++view_index) {
+            if (skip_to_literal_prefix && !view.unicode()) {
+                auto candidate = view.visit_code_units([&](auto code_units) {
+                    return find_literal_prefix(code_units, view_index, literal_prefix);
+                });
+                if (!candidate.has_value())
+                    break;
+                view_index = *candidate;
+            }
+
             if (view_index == view_length) {
                 if (input.regex_options.has_flag_set(AllFlags::Multiline))
                     break;
@@ -321,7 +468,8 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
             state.instruction_position = 0;
             state.repetition_marks.clear();
 
-            if (execute(input, state, operations)) {
+            if (auto match_start = run(operations, tries_all_starting_positions); match_start.has_value()) {
+                view_index = *match_start;
                 succeeded = true;
 
                 if (input.regex_options.has_flag_set(AllFlags::MatchNotEndOfLine) && state.string_position == input.view.length()) {
@@ -361,6 +509,10 @@ RegexResult Matcher<Parser>::match(Vector<RegexStringView> const& views, Optiona
                 break;
             }
 
+            // The linear engine has already tried all the remaining starting positions.
+            if (m_pattern->use_linear_engine && tries_all_starting_positions)
+                break;
+
         done_matching:
             if (!continue_search || only_start_of_line)
                 break;
@@ -497,7 +649,7 @@ struct SufficientlyUniformValueTraits : DefaultTraits<u64> {
 };
 
 template<class Parser>
-bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations) const
+bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t& operations, size_t operations_limit) const
 {
     BumpAllocatedLinkedList<MatchState> states_to_try_next;
     HashTable<u64, SufficientlyUniformValueTraits> seen_state_hashes;
@@ -506,28 +658,43 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
 #endif
 
     auto& bytecode = m_pattern->parser_result.bytecode;
+    // NOTE: The threaded form doesn't print what it's doing, so debug builds stay on the plain loop.
+    auto const* threaded_bytecode = REGEX_DEBUG ? nullptr : m_pattern->threaded_bytecode.ptr();
 
     for (;;) {
-        auto& opcode = bytecode.get_opcode(state);
-        ++operations;
+        ExecutionResult result;
+        size_t opcode_size;
+
+        if (threaded_bytecode && input.fail_counter == 0) {
+            // NOTE: Hot patterns run straight-line code in the threaded form, and only come back here to fork or backtrack.
+            auto step = threaded_bytecode->run(bytecode, input, state, operations, operations_limit);
+            if (!step.has_value())
+                return false;
+            result = step->result;
+            opcode_size = step->opcode_size;
+        } else {
+            auto& opcode = bytecode.get_opcode(state);
+            opcode_size = opcode.size();
+            if (++operations >= operations_limit)
+                return false;
 
 #if REGEX_DEBUG
-        s_regex_dbg.print_opcode("VM", opcode, state, recursion_level, false);
+            s_regex_dbg.print_opcode("VM", opcode, state, recursion_level, false);
 #endif
 
-        ExecutionResult result;
-        if (input.fail_counter > 0) {
-            --input.fail_counter;
-            result = ExecutionResult::Failed_ExecuteLowPrioForks;
-        } else {
-            result = opcode.execute(input, state);
-        }
+            if (input.fail_counter > 0) {
+                --input.fail_counter;
+                result = ExecutionResult::Failed_ExecuteLowPrioForks;
+            } else {
+                result = opcode.execute(input, state);
+            }
 
 #if REGEX_DEBUG
-        s_regex_dbg.print_result(opcode, bytecode, input, state, result);
+            s_regex_dbg.print_result(opcode, bytecode, input, state, result);
 #endif
 
-        state.instruction_position += opcode.size();
+            state.instruction_position += opcode_size;
+        }
 
         switch (result) {
         case ExecutionResult::Fork_PrioLow: {
@@ -546,7 +713,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
             }
             if (!found) {
                 states_to_try_next.append(state);
-                states_to_try_next.last().initiating_fork = state.instruction_position - opcode.size();
+                states_to_try_next.last().initiating_fork = state.instruction_position - opcode_size;
                 states_to_try_next.last().instruction_position = state.fork_at_position;
             }
             continue;
@@ -566,7 +733,7 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
             }
             if (!found) {
                 states_to_try_next.append(state);
-                states_to_try_next.last().initiating_fork = state.instruction_position - opcode.size();
+                states_to_try_next.last().initiating_fork = state.instruction_position - opcode_size;
             }
             state.instruction_position = state.fork_at_position;
 #if REGEX_DEBUG
@@ -617,6 +784,115 @@ bool Matcher<Parser>::execute(MatchInput const& input, MatchState& state, size_t
     VERIFY_NOT_REACHED();
 }
 
+// A Pike VM over the same bytecode: all threads advance through the input in lockstep, one character at a time,
+// in the order the backtracking engine would have tried them. Threads that reach an equivalent state at the same
+// position as a higher-priority thread are dropped, which bounds the work per character by the size of the pattern.
+template<class Parser>
+ErrorOr<Optional<size_t>> Matcher<Parser>::execute_linear(MatchInput const& input, MatchState& state, size_t& operations, bool search) const
+{
+    struct Thread {
+        MatchState state;
+        size_t start_position { 0 };
+    };
+
+    auto& bytecode = m_pattern->parser_result.bytecode;
+
+    auto const initial_state = state;
+    auto position = state.string_position;
+    auto position_in_code_units = state.string_position_in_code_units;
+
+    Vector<Thread> current_threads;
+    Vector<Thread> next_threads;
+    Vector<Thread> stack;
+    HashTable<LinearThreadKey, LinearThreadKeyTraits> seen_thread_keys;
+    Optional<Thread> matched_thread;
+
+    for (;;) {
+        // NOTE: A thread starting here has lower priority than any thread that started earlier.
+        if (!matched_thread.has_value() && (search || position == initial_state.string_position)) {
+            Thread thread { initial_state, position };
+            thread.state.string_position = position;
+            thread.state.string_position_in_code_units = position_in_code_units;
+            thread.state.instruction_position = 0;
+            current_threads.append(move(thread));
+        }
+
+        seen_thread_keys.clear_with_capacity();
+        bool found_match = false;
+        for (auto& current_thread : current_threads) {
+            stack.append(move(current_thread));
+            while (!stack.is_empty()) {
+                auto thread = stack.take_last();
+                if (seen_thread_keys.set(LinearThreadKey { thread.state }) != HashSetResult::InsertedNewEntry)
+                    continue;
+
+                auto& opcode = bytecode.get_opcode(thread.state);
+                auto opcode_size = opcode.size();
+                ++operations;
+
+                auto result = opcode.execute(input, thread.state);
+                input.fork_to_replace.clear();
+
+                switch (result) {
+                case ExecutionResult::Continue:
+                    thread.state.instruction_position += opcode_size;
+                    if (thread.state.string_position == position) {
+                        stack.append(move(thread));
+                    } else if (thread.state.string_position == position + 1) {
+                        next_threads.append(move(thread));
+                    } else {
+                        // NOTE: can_be_matched_linearly() should have ruled out compares that consume more (or less) than one character.
+                        return AK::Error::from_string_literal("Thread did not advance by exactly one character");
+                    }
+                    break;
+                case ExecutionResult::Fork_PrioHigh:
+                case ExecutionResult::Fork_PrioLow: {
+                    auto forked_thread = thread;
+                    forked_thread.state.instruction_position = thread.state.fork_at_position;
+                    thread.state.instruction_position += opcode_size;
+                    if (result == ExecutionResult::Fork_PrioHigh)
+                        swap(thread, forked_thread);
+                    stack.append(move(forked_thread));
+                    stack.append(move(thread));
+                    break;
+                }
+                case ExecutionResult::Succeeded:
+                    // Everything still on the stack or after this thread has lower priority.
+                    matched_thread = move(thread);
+                    found_match = true;
+                    stack.clear_with_capacity();
+                    break;
+                case ExecutionResult::Failed:
+                case ExecutionResult::Failed_ExecuteLowPrioForks:
+                    break;
+                }
+            }
+            if (found_match)
+                break;
+        }
+
+        current_threads.clear_with_capacity();
+        swap(current_threads, next_threads);
+
+        if (position >= input.view.length())
+            break;
+        if (current_threads.is_empty() && (matched_thread.has_value() || !search))
+            break;
+
+        if (input.view.unicode())
+            position_in_code_units += input.view.length_of_code_point(input.view.code_point_at(position_in_code_units));
+        else
+            ++position_in_code_units;
+        ++position;
+    }
+
+    if (!matched_thread.has_value())
+        return Optional<size_t> {};
+
+    state = move(matched_thread->state);
+    return matched_thread->start_position;
+}
+
 template class Matcher<PosixBasicParser>;
 template class Regex<PosixBasicParser>;
 
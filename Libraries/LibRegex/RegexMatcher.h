@@ -32,6 +32,13 @@ struct Block {
 
 static constexpr size_t const c_max_recursion = 5000;
 
+// Number of matches after which a pattern's bytecode gets pre-decoded into a ThreadedByteCode.
+static constexpr size_t const c_threaded_bytecode_match_threshold = 16;
+
+// How many times more operations than the linear engine would need at most the backtracking engine may spend on
+// a match attempt before the pattern is switched over to the linear engine.
+static constexpr size_t const c_linear_engine_fallback_factor = 16;
+
 struct REGEX_API RegexResult final {
     bool success { false };
     size_t count { 0 };
@@ -71,7 +78,9 @@ public:
     }
 
 private:
-    bool execute(MatchInput const& input, MatchState& state, size_t& operations) const;
+    bool execute(MatchInput const& input, MatchState& state, size_t& operations, size_t operations_limit = NumericLimits<size_t>::max()) const;
+    // Returns an error if the bytecode turns out not to be suitable for the linear engine after all.
+    ErrorOr<Optional<size_t>> execute_linear(MatchInput const& input, MatchState& state, size_t& operations, bool search) const;
 
     Regex<Parser> const* m_pattern;
     typename ParserTraits<Parser>::OptionsType const m_regex_options;
@@ -84,6 +93,10 @@ public:
     regex::Parser::Result parser_result;
     OwnPtr<Matcher<Parser>> matcher { nullptr };
     mutable size_t start_offset { 0 };
+    mutable size_t match_count_for_tiering { 0 };
+    mutable OwnPtr<ThreadedByteCode> threaded_bytecode;
+    mutable bool use_linear_engine { false };
+    mutable bool linear_engine_gave_up { false };
 
     static regex::Parser::Result parse_pattern(StringView pattern, typename ParserTraits<Parser>::OptionsType regex_options = {});
 
@@ -25,6 +25,107 @@ namespace regex {
 
 using Detail::Block;
 
+static bool can_be_matched_linearly(ByteCode const& bytecode)
+{
+    // The linear engine runs every thread in lockstep over the input, so each compare must consume exactly
+    // one character, and nothing may depend on anything but the current position (i.e. no backreferences,
+    // and no saving/restoring of positions as done by lookarounds).
+    auto state = MatchState::only_for_enumeration();
+    for (state.instruction_position = 0; state.instruction_position < bytecode.size();) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Save:
+        case OpCodeId::Restore:
+        case OpCodeId::GoBack:
+        case OpCodeId::FailForks:
+        case OpCodeId::PopSaved:
+            return false;
+        case OpCodeId::Compare: {
+            auto& compare = static_cast<OpCode_Compare const&>(opcode);
+            // NOTE: flat_compares() splits strings into characters, so look at the raw arguments instead.
+            auto offset = state.instruction_position + 3;
+            for (size_t i = 0; i < compare.arguments_count(); ++i) {
+                switch ((CharacterCompareType)bytecode[offset++]) {
+                case CharacterCompareType::String:
+                case CharacterCompareType::Reference:
+                case CharacterCompareType::NamedReference:
+                    return false;
+                case CharacterCompareType::Char:
+                case CharacterCompareType::CharClass:
+                case CharacterCompareType::CharRange:
+                case CharacterCompareType::GeneralCategory:
+                case CharacterCompareType::Property:
+                case CharacterCompareType::Script:
+                case CharacterCompareType::ScriptExtension:
+                    ++offset;
+                    break;
+                case CharacterCompareType::LookupTable: {
+                    auto count_sensitive = bytecode[offset++];
+                    auto count_insensitive = bytecode[offset++];
+                    offset += count_sensitive + count_insensitive;
+                    break;
+                }
+                default:
+                    break;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        state.instruction_position += opcode.size();
+    }
+    return true;
+}
+
+static ByteString extract_literal_prefix(ByteCode const& bytecode)
+{
+    // Follow the code from the entry point for as long as it runs straight through, collecting the characters
+    // it requires. Only ASCII is collected, so the prefix can be searched for in any kind of input.
+    StringBuilder prefix;
+    auto state = MatchState::only_for_enumeration();
+    for (state.instruction_position = 0; state.instruction_position < bytecode.size();) {
+        auto& opcode = bytecode.get_opcode(state);
+        switch (opcode.opcode_id()) {
+        case OpCodeId::Compare: {
+            if (static_cast<OpCode_Compare const&>(opcode).arguments_count() != 1)
+                return prefix.to_byte_string();
+
+            auto offset = state.instruction_position + 3;
+            auto compare_type = (CharacterCompareType)bytecode[offset++];
+            if (compare_type == CharacterCompareType::Char) {
+                auto ch = bytecode[offset];
+                if (ch > 0x7f)
+                    return prefix.to_byte_string();
+                prefix.append(static_cast<char>(ch));
+            } else if (compare_type == CharacterCompareType::String) {
+                auto length = bytecode[offset++];
+                for (size_t i = 0; i < length; ++i) {
+                    auto ch = bytecode[offset + i];
+                    if (ch > 0x7f)
+                        return prefix.to_byte_string();
+                    prefix.append(static_cast<char>(ch));
+                }
+            } else {
+                return prefix.to_byte_string();
+            }
+            break;
+        }
+        case OpCodeId::SaveLeftCaptureGroup:
+        case OpCodeId::SaveRightCaptureGroup:
+        case OpCodeId::SaveRightNamedCaptureGroup:
+        case OpCodeId::ClearCaptureGroup:
+        case OpCodeId::Checkpoint:
+            break;
+        default:
+            return prefix.to_byte_string();
+        }
+        state.instruction_position += opcode.size();
+    }
+    return prefix.to_byte_string();
+}
+
 template<typename Parser>
 void Regex<Parser>::run_optimization_passes()
 {
@@ -41,6 +142,9 @@ void Regex<Parser>::run_optimization_passes()
     fill_optimization_data(split_basic_blocks(parser_result.bytecode));
 
     parser_result.bytecode.flatten();
+
+    parser_result.optimization_data.supports_linear_engine = can_be_matched_linearly(parser_result.bytecode);
+    parser_result.optimization_data.literal_prefix = extract_literal_prefix(parser_result.bytecode);
 }
 
 struct StaticallyInterpretedCompares {
@@ -68,6 +68,11 @@ public:
             Vector<CharRange> starting_ranges;
             Vector<CharRange> starting_ranges_insensitive;
             bool only_start_of_line = false;
+            // If set, the pattern has no backreferences, lookarounds or multi-character compares, and can be
+            // matched by Matcher::execute_linear() in time linear in the length of the input.
+            bool supports_linear_engine = false;
+            // If non-empty, every match starts with these (ASCII) characters, compared case-sensitively.
+            ByteString literal_prefix;
         } optimization_data {};
     };
 
@@ -102,6 +102,7 @@ int main(int argc, char** argv)
     StringView specified_test_root;
     ByteString common_path;
     Vector<ByteString> test_globs;
+    Vector<ByteString> disabled_bytecode_passes;
 
     Core::ArgsParser args_parser;
     args_parser.add_option(print_times, "Show duration of each test", "show-time", 't');
@@ -125,6 +126,9 @@ int main(int argc, char** argv)
     args_parser.add_option(per_file, "Show detailed per-file results as JSON (implies -j)", "per-file");
     args_parser.add_option(g_collect_on_every_allocation, "Collect garbage after every allocation", "collect-often", 'g');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_baseline_tier_enabled, "Compile hot bytecode to native code", "baseline-tier");
+    args_parser.add_option(JS::Bytecode::g_baseline_tier_hotness_threshold, "Number of calls and loop iterations before bytecode is compiled", "baseline-tier-threshold", {}, "count");
+    args_parser.add_option(disabled_bytecode_passes, "Disable a bytecode optimization pass (jump-threading, redundant-mov-elimination, unreachable-block-elimination)", "disable-bytecode-pass", {}, "passes");
     args_parser.add_option(test_globs, "Only run tests matching the given glob", "filter", 'f', "glob");
     for (auto& entry : g_extra_args)
         args_parser.add_option(*entry.key, entry.value.get<0>().characters(), entry.value.get<1>().characters(), entry.value.get<2>());
@@ -135,6 +139,13 @@ int main(int argc, char** argv)
     if (per_file)
         print_json = true;
 
+    for (auto const& pass : disabled_bytecode_passes) {
+        if (!JS::Bytecode::disable_bytecode_optimization_pass(pass)) {
+            warnln("Unknown bytecode optimization pass: {}", pass);
+            return 1;
+        }
+    }
+
     for (auto& glob : test_globs)
         glob = ByteString::formatted("*{}*", glob);
     if (test_globs.is_empty())
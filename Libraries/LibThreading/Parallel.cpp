@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/Vector.h>
+#include <LibCore/System.h>
+#include <LibThreading/Parallel.h>
+#include <LibThreading/Thread.h>
+
+namespace Threading {
+
+void for_each_in_parallel(size_t count, Function<void(size_t)> const& callback, size_t minimum_count_per_thread)
+{
+    auto thread_count = min<size_t>(Core::System::hardware_concurrency(), count / max<size_t>(minimum_count_per_thread, 1));
+    if (thread_count <= 1) {
+        for (size_t i = 0; i < count; ++i)
+            callback(i);
+        return;
+    }
+
+    // Indices are handed out one at a time, so a few expensive ones don't leave the other threads idle.
+    Atomic<size_t> next_index { 0 };
+    auto run = [&] {
+        for (;;) {
+            auto index = next_index.fetch_add(1, AK::MemoryOrder::memory_order_relaxed);
+            if (index >= count)
+                return;
+            callback(index);
+        }
+    };
+
+    Vector<NonnullRefPtr<Thread>> threads;
+    threads.ensure_capacity(thread_count - 1);
+    for (size_t i = 1; i < thread_count; ++i) {
+        auto thread = Thread::construct([&] {
+            run();
+            return static_cast<intptr_t>(0);
+        },
+            "Parallel worker"sv);
+        thread->start();
+        threads.unchecked_append(move(thread));
+    }
+
+    run();
+
+    for (auto& thread : threads)
+        (void)thread->join();
+}
+
+}
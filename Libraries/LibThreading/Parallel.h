@@ -0,0 +1,22 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Function.h>
+#include <AK/Types.h>
+
+namespace Threading {
+
+// Calls `callback` once for every index in [0, count), spread across up to one thread per hardware thread.
+// The calling thread takes part in the work, and every call has returned by the time this returns.
+// Fewer than `minimum_count_per_thread` indices per thread are not worth a thread, so small counts run inline.
+//
+// NOTE: Calls run concurrently with each other, so `callback` must not create, copy or destroy
+//       reference-counted objects that other calls (or the calling thread) can see.
+void for_each_in_parallel(size_t count, Function<void(size_t)> const& callback, size_t minimum_count_per_thread = 1);
+
+}
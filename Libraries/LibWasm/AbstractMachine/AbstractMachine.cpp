@@ -558,6 +558,10 @@ Result AbstractMachine::invoke(Interpreter& interpreter, FunctionAddress address
     Configuration configuration { m_store };
     if (m_should_limit_instruction_count)
         configuration.enable_instruction_count_limit();
+    if (m_should_use_baseline_compiler)
+        configuration.enable_baseline_compiler();
+    if (agent_can_block && !agent_can_block())
+        configuration.disallow_blocking();
     return configuration.call(interpreter, address, move(arguments));
 }
 
@@ -11,9 +11,13 @@
 #include <AK/HashMap.h>
 #include <AK/HashTable.h>
 #include <AK/NonnullOwnPtr.h>
+#include <AK/OwnPtr.h>
 #include <AK/StackInfo.h>
 #include <AK/UFixedBigInt.h>
+#include <LibThreading/Mutex.h>
+#include <LibWasm/AbstractMachine/MemoryReservation.h>
 #include <LibWasm/Export.h>
+#include <LibWasm/JIT/NativeFunction.h>
 #include <LibWasm/Types.h>
 
 namespace Wasm {
@@ -383,11 +387,22 @@ public:
     auto& code() const { return m_code; }
     RefPtr<Module const> module_ref() const { return m_module.strong_ref(); }
 
+    // The baseline compiler only gets one shot per function; functions it can't handle stay in the interpreter.
+    bool has_attempted_baseline_compilation() const { return m_has_attempted_baseline_compilation; }
+    JIT::NativeFunction const* baseline_code() const { return m_baseline_code.ptr(); }
+    void set_baseline_code(RefPtr<JIT::NativeFunction> code)
+    {
+        m_baseline_code = move(code);
+        m_has_attempted_baseline_compilation = true;
+    }
+
 private:
     FunctionType m_type;
     WeakPtr<Module const> m_module;
     ModuleInstance const& m_module_instance;
     CodeSection::Code const& m_code;
+    RefPtr<JIT::NativeFunction> m_baseline_code;
+    bool m_has_attempted_baseline_compilation { false };
 };
 
 class HostFunction {
@@ -456,18 +471,30 @@ public:
     static ErrorOr<MemoryInstance> create(MemoryType const& type)
     {
         MemoryInstance instance { type };
+        if (!instance.reserve_address_space())
+            return Error::from_string_literal("Failed to reserve address space for shared memory");
 
-        if (!instance.grow(type.limits().min() * Constants::page_size, GrowType::No))
+        if (!instance.grow(type.limits().min() * Constants::page_size, GrowType::No).has_value())
             return Error::from_string_literal("Failed to grow to requested size");
 
         return { move(instance) };
     }
 
     auto& type() const { return m_type; }
-    auto size() const { return m_size; }
+    bool is_shared() const { return m_is_shared; }
+
+    // NOTE: Other threads can grow a shared memory at any time. size() is always safe to read, but data() only has
+    //       the new size once the growing thread is done, so bounds checks should go against size().
+    size_t size() const { return __atomic_load_n(&m_size, __ATOMIC_ACQUIRE); }
     auto& data() const { return m_data; }
     auto& data() { return m_data; }
 
+    // Whether every access at a u32 address plus a u32 offset either hits the memory or faults in its guard region.
+    bool has_guard_region() const { return m_reservation && m_reservation->has_guard_region(); }
+
+    // NOTE: The caller must have bounds checked the access against size() already.
+    ALWAYS_INLINE Bytes unchecked_slice(u64 address, size_t length) { return { m_data.data() + address, length }; }
+
     enum class InhibitGrowCallback {
         No,
         Yes,
@@ -478,28 +505,62 @@ public:
         Yes,
     };
 
-    bool grow(size_t size_to_grow, GrowType grow_type = GrowType::Yes, InhibitGrowCallback inhibit_callback = InhibitGrowCallback::No)
+    // Returns the size the memory had before growing, or nothing if it can't grow by that much.
+    Optional<size_t> grow(size_t size_to_grow, GrowType grow_type = GrowType::Yes, InhibitGrowCallback inhibit_callback = InhibitGrowCallback::No)
+    {
+        if (!m_grow_mutex)
+            return grow_impl(size_to_grow, grow_type, inhibit_callback);
+
+        // NOTE: Another thread may be growing a shared memory at the same time, so checking the limits, committing the
+        //       new pages and publishing the new size have to happen as one step.
+        Threading::MutexLocker locker(*m_grow_mutex);
+        return grow_impl(size_to_grow, grow_type, inhibit_callback);
+    }
+
+    // Called after the memory has grown on the thread that created it. If another thread grows a shared memory,
+    // the hook isn't called, and the creating thread sees the new size the next time it asks for it.
+    Function<void()> successful_grow_hook;
+
+private:
+    explicit MemoryInstance(MemoryType const& type)
+        : m_type(type)
+        , m_is_shared(type.limits().is_shared())
+        , m_owner_thread(pthread_self())
+    {
+        if (m_is_shared)
+            m_grow_mutex = make<Threading::Mutex>();
+    }
+
+    Optional<size_t> grow_impl(size_t size_to_grow, GrowType grow_type, InhibitGrowCallback inhibit_callback)
     {
+        auto previous_size = m_size;
         if (size_to_grow == 0)
-            return true;
-        u64 new_size = m_data.size() + size_to_grow;
+            return previous_size;
+        u64 new_size = previous_size + size_to_grow;
         // Can't grow past 2^16 pages.
-        if (new_size >= Constants::page_size * 65536)
-            return false;
+        if (new_size >= Constants::page_size * (Constants::max_memory_pages + 1))
+            return {};
         if (auto max = m_type.limits().max(); max.has_value()) {
             if (max.value() * Constants::page_size < new_size)
-                return false;
+                return {};
         }
-        auto previous_size = m_size;
-        if (m_data.try_resize(new_size).is_error())
-            return false;
-        m_size = new_size;
-        // The spec requires that we zero out everything on grow
-        __builtin_memset(m_data.offset_pointer(previous_size), 0, size_to_grow);
+        if (m_reservation) {
+            if (m_reservation->commit(new_size).is_error())
+                return {};
+            // NOTE: The spec requires that we zero out everything on grow, which newly committed pages already are.
+            m_data.set_size(new_size);
+        } else {
+            if (m_data.try_resize(new_size).is_error())
+                return {};
+            // The spec requires that we zero out everything on grow
+            __builtin_memset(m_data.offset_pointer(previous_size), 0, size_to_grow);
+        }
+        // NOTE: Everything up to the new size is accessible before any other thread can see it.
+        __atomic_store_n(&m_size, static_cast<size_t>(new_size), __ATOMIC_RELEASE);
 
         // NOTE: This exists because wasm-js-api wants to execute code after a successful grow,
         //       See [this issue](https://github.com/WebAssembly/spec/issues/1635) for more details.
-        if (inhibit_callback == InhibitGrowCallback::No && successful_grow_hook)
+        if (inhibit_callback == InhibitGrowCallback::No && successful_grow_hook && pthread_equal(pthread_self(), m_owner_thread))
             successful_grow_hook();
 
         if (grow_type == GrowType::Yes) {
@@ -507,23 +568,39 @@ public:
             //
             // See relevant spec link:
             // https://www.w3.org/TR/wasm-core-2/#growing-memories%E2%91%A0
-            m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max()) };
+            m_type = MemoryType { Limits(m_type.limits().address_type(), m_type.limits().min() + size_to_grow / Constants::page_size, m_type.limits().max(), m_is_shared) };
         }
 
-        return true;
+        return previous_size;
     }
 
-    Function<void()> successful_grow_hook;
-
-private:
-    explicit MemoryInstance(MemoryType const& type)
-        : m_type(type)
+    bool reserve_address_space()
     {
+        // OPTIMIZATION: Reserve address space for the largest size this memory can ever grow to, so that growing it
+        //               only has to commit more pages, and never copies the existing contents. Memories with 32-bit
+        //               addresses also get a guard region, which lets native code leave out its bounds checks.
+        u64 max_pages = min(m_type.limits().max().value_or(Constants::max_memory_pages), Constants::max_memory_pages);
+        auto guard_region = m_type.limits().address_type() == AddressType::I32 ? MemoryReservation::GuardRegion::Yes : MemoryReservation::GuardRegion::No;
+        auto reservation = MemoryReservation::create(max_pages * Constants::page_size, guard_region);
+        if (reservation.is_error()) {
+            // NOTE: Other threads access a shared memory without going through this instance, so it must never move
+            //       when it grows. Any other memory can fall back to growing its buffer on demand.
+            return !m_is_shared;
+        }
+
+        m_reservation = reservation.release_value();
+        m_data = ByteBuffer::create_with_external_storage({ m_reservation->base(), m_reservation->maximum_size() });
+        return true;
     }
 
     MemoryType m_type;
+    bool m_is_shared { false };
     size_t m_size { 0 };
+    // NOTE: The reservation has to outlive m_data, which only points into it.
+    OwnPtr<MemoryReservation> m_reservation;
     ByteBuffer m_data;
+    OwnPtr<Threading::Mutex> m_grow_mutex;
+    pthread_t m_owner_thread;
 };
 
 class GlobalInstance {
@@ -718,6 +795,14 @@ public:
 
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
 
+    // Compile functions to native code on their first call, where supported. The interpreter remains the
+    // reference implementation, and still runs everything the baseline compiler can't handle.
+    void enable_baseline_compiler() { m_should_use_baseline_compiler = true; }
+
+    // Host hook for whether the agent calling into this machine may block, like an ECMAScript agent's [[CanBlock]].
+    // memory.atomic.wait traps where it can't. Without a hook, every caller may block.
+    Function<bool()> agent_can_block;
+
     void visit_external_resources(HostVisitOps const&);
 
 private:
@@ -751,6 +836,7 @@ private:
     StackInfo m_stack_info;
     HashTable<Interpreter*> m_active_interpreters;
     bool m_should_limit_instruction_count { false };
+    bool m_should_use_baseline_compiler { false };
 };
 
 class WASM_API Linker {
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Atomic.h>
 #include <AK/Bitmap.h>
 #include <AK/ByteReader.h>
 #include <AK/Debug.h>
@@ -19,6 +20,7 @@
 #include <LibWasm/AbstractMachine/BytecodeInterpreter.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Operators.h>
+#include <LibWasm/AbstractMachine/WaiterList.h>
 #include <LibWasm/Opcode.h>
 #include <LibWasm/Printer/Printer.h>
 #include <LibWasm/Types.h>
@@ -1622,12 +1624,12 @@ HANDLE_INSTRUCTION(memory_grow)
     auto& args = instruction->arguments().get<Instruction::MemoryIndexArgument>();
     auto address = configuration.frame().module().memories().data()[args.memory_index.value()];
     auto instance = configuration.store().get(address);
-    i32 old_pages = instance->size() / Constants::page_size;
     auto& entry = configuration.source_value(0, addresses.sources); // bounds checked by verifier.
     auto new_pages = entry.to<i32>();
-    dbgln_if(WASM_TRACE_DEBUG, "memory.grow({}), previously {} pages...", new_pages, old_pages);
-    if (instance->grow(new_pages * Constants::page_size))
-        entry = Value(old_pages);
+    dbgln_if(WASM_TRACE_DEBUG, "memory.grow({}), previously {} pages...", new_pages, instance->size() / Constants::page_size);
+    // NOTE: Another thread may grow a shared memory in the meantime, so the previous size has to come from the grow itself.
+    if (auto previous_size = instance->grow(new_pages * Constants::page_size); previous_size.has_value())
+        entry = Value(static_cast<i32>(*previous_size / Constants::page_size));
     else
         entry = Value(-1);
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
@@ -1646,7 +1648,7 @@ HANDLE_INSTRUCTION(memory_fill)
 
         Checked<u64> checked_end = destination_offset;
         checked_end += count;
-        TRAP_IN_LOOP_IF_NOT(!checked_end.has_overflow() && static_cast<size_t>(checked_end.value()) <= instance->data().size());
+        TRAP_IN_LOOP_IF_NOT(!checked_end.has_overflow() && static_cast<size_t>(checked_end.value()) <= instance->size());
 
         if (count == 0)
             TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
@@ -1677,8 +1679,8 @@ HANDLE_INSTRUCTION(memory_copy)
     source_position.saturating_add(count);
     Checked<size_t> destination_position = destination_offset;
     destination_position.saturating_add(count);
-    TRAP_IN_LOOP_IF_NOT(source_position <= source_instance->data().size());
-    TRAP_IN_LOOP_IF_NOT(destination_position <= destination_instance->data().size());
+    TRAP_IN_LOOP_IF_NOT(source_position <= source_instance->size());
+    TRAP_IN_LOOP_IF_NOT(destination_position <= destination_instance->size());
 
     if (count == 0)
         TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
@@ -1717,7 +1719,7 @@ HANDLE_INSTRUCTION(memory_init)
     Checked<size_t> destination_position = destination_offset;
     destination_position.saturating_add(count);
     TRAP_IN_LOOP_IF_NOT(source_position <= data.data().size());
-    TRAP_IN_LOOP_IF_NOT(destination_position <= memory->data().size());
+    TRAP_IN_LOOP_IF_NOT(destination_position <= memory->size());
 
     if (count == 0)
         TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
@@ -3754,6 +3756,474 @@ HANDLE_INSTRUCTION(i32x4_relaxed_dot_i8x16_i7x16_add_s)
     TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
 }
 
+HANDLE_INSTRUCTION(memory_atomic_notify)
+{
+    if (interpreter.atomic_notify(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(memory_atomic_wait32)
+{
+    if (interpreter.atomic_wait<u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(memory_atomic_wait64)
+{
+    if (interpreter.atomic_wait<u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(atomic_fence)
+{
+    AK::atomic_thread_fence(AK::memory_order_seq_cst);
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_load)
+{
+    if (interpreter.atomic_load_and_push<u32, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load)
+{
+    if (interpreter.atomic_load_and_push<u64, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_load8_u)
+{
+    if (interpreter.atomic_load_and_push<u8, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_load16_u)
+{
+    if (interpreter.atomic_load_and_push<u16, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load8_u)
+{
+    if (interpreter.atomic_load_and_push<u8, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load16_u)
+{
+    if (interpreter.atomic_load_and_push<u16, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_load32_u)
+{
+    if (interpreter.atomic_load_and_push<u32, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_store)
+{
+    if (interpreter.atomic_pop_and_store<u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store)
+{
+    if (interpreter.atomic_pop_and_store<u64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_store8)
+{
+    if (interpreter.atomic_pop_and_store<u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_store16)
+{
+    if (interpreter.atomic_pop_and_store<u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store8)
+{
+    if (interpreter.atomic_pop_and_store<u8>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store16)
+{
+    if (interpreter.atomic_pop_and_store<u16>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_store32)
+{
+    if (interpreter.atomic_pop_and_store<u32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Add>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Add>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Add>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Add>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Add>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Add>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Add>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Subtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Subtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Subtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Subtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Subtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Subtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Subtract>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::And>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::And>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::And>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::And>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::And>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::And>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::And>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Or>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Or>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Or>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Or>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Or>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Or>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Or>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Xor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Xor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Xor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Xor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Xor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Xor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Xor>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    if (interpreter.atomic_read_modify_write<u32, i32, BytecodeInterpreter::AtomicOperation::Exchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    if (interpreter.atomic_read_modify_write<u64, i64, BytecodeInterpreter::AtomicOperation::Exchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i32, BytecodeInterpreter::AtomicOperation::Exchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i32, BytecodeInterpreter::AtomicOperation::Exchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<u8, i64, BytecodeInterpreter::AtomicOperation::Exchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<u16, i64, BytecodeInterpreter::AtomicOperation::Exchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    if (interpreter.atomic_read_modify_write<u32, i64, BytecodeInterpreter::AtomicOperation::Exchange>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    if (interpreter.atomic_compare_exchange<u32, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    if (interpreter.atomic_compare_exchange<u64, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<u8, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<u16, i32>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<u8, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<u16, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
+HANDLE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    if (interpreter.atomic_compare_exchange<u32, i64>(configuration, *instruction, addresses))
+        return Outcome::Return;
+    TAILCALL return continue_(HANDLER_PARAMS(DECOMPOSE_PARAMS_NAME_ONLY));
+}
+
 HANDLE_INSTRUCTION(throw_ref)
 {
     interpreter.set_trap("Not Implemented: Proposal 'Exception-handling'"sv);
@@ -3886,7 +4356,7 @@ bool BytecodeInterpreter::load_and_push(Configuration& configuration, Instructio
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "load({} : {}) -> stack", instance_address, sizeof(ReadType));
-    auto slice = memory->data().bytes().slice(instance_address, sizeof(ReadType));
+    auto slice = memory->unchecked_slice(instance_address, sizeof(ReadType));
     entry = Value(static_cast<PushType>(read_value<ReadType>(slice)));
     return false;
 }
@@ -3912,7 +4382,7 @@ bool BytecodeInterpreter::load_and_push_mxn(Configuration& configuration, Instru
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-load({} : {}) -> stack", instance_address, M * N / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M * N / 8);
+    auto slice = memory->unchecked_slice(instance_address, M * N / 8);
     using V64 = NativeVectorType<M, N, SetSign>;
     using V128 = NativeVectorType<M * 2, N, SetSign>;
 
@@ -3940,7 +4410,7 @@ bool BytecodeInterpreter::load_and_push_lane_n(Configuration& configuration, Ins
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
+    auto slice = memory->unchecked_slice(instance_address, N / 8);
     auto dst = bit_cast<u8*>(&vector) + memarg_and_lane.lane * N / 8;
     memcpy(dst, slice.data(), N / 8);
     configuration.push_to_destination(Value(vector), addresses.destination);
@@ -3960,7 +4430,7 @@ bool BytecodeInterpreter::load_and_push_zero_n(Configuration& configuration, Ins
         m_trap = Trap::from_string("Memory access out of bounds");
         return true;
     }
-    auto slice = memory->data().bytes().slice(instance_address, N / 8);
+    auto slice = memory->unchecked_slice(instance_address, N / 8);
     u128 vector = 0;
     memcpy(&vector, slice.data(), N / 8);
     configuration.push_to_destination(Value(vector), addresses.destination);
@@ -3982,7 +4452,7 @@ bool BytecodeInterpreter::load_and_push_m_splat(Configuration& configuration, In
         return true;
     }
     dbgln_if(WASM_TRACE_DEBUG, "vec-splat({} : {}) -> stack", instance_address, M / 8);
-    auto slice = memory->data().bytes().slice(instance_address, M / 8);
+    auto slice = memory->unchecked_slice(instance_address, M / 8);
     auto value = read_value<NativeIntegralType<M>>(slice);
     set_top_m_splat<M, NativeIntegralType>(configuration, value, addresses);
     return false;
@@ -4189,9 +4659,148 @@ bool BytecodeInterpreter::store_to_memory(MemoryInstance& memory, u64 address, T
 
     dbgln_if(WASM_TRACE_DEBUG, "temporary({}b) -> store({})", data_size, address);
     if constexpr (IsSame<ReadonlyBytes, T>)
-        (void)value.copy_to(memory.data().bytes().slice(address, data_size));
+        (void)value.copy_to(memory.unchecked_slice(address, data_size));
     else
-        memcpy(memory.data().bytes().offset_pointer(address), &value, data_size);
+        memcpy(memory.unchecked_slice(address, data_size).data(), &value, data_size);
+    return false;
+}
+
+template<typename AccessT>
+AccessT* BytecodeInterpreter::atomic_memory_location(Configuration& configuration, Instruction::MemoryArgument const& arg, u32 base)
+{
+    auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
+    auto memory = configuration.store().get(address);
+    u64 instance_address = static_cast<u64>(base) + arg.offset;
+    if (instance_address % sizeof(AccessT) != 0) {
+        m_trap = Trap::from_string("Unaligned atomic memory access");
+        return nullptr;
+    }
+    if (instance_address + sizeof(AccessT) > memory->size()) {
+        m_trap = Trap::from_string("Memory access out of bounds");
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Memory access out of bounds (expected {} to be less than or equal to {})", instance_address + sizeof(AccessT), memory->size());
+        return nullptr;
+    }
+    // NOTE: Wasm memory is little-endian, and so are all hosts we can run atomics on natively.
+    return reinterpret_cast<AccessT*>(memory->unchecked_slice(instance_address, sizeof(AccessT)).data());
+}
+
+template<typename AccessT, typename PushT>
+bool BytecodeInterpreter::atomic_load_and_push(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto base = configuration.take_source(0, addresses.sources).to<u32>(); // bounds checked by verifier.
+    auto* location = atomic_memory_location<AccessT>(configuration, arg, base);
+    if (!location)
+        return true;
+    configuration.push_to_destination(Value(static_cast<PushT>(AK::atomic_load(location))), addresses.destination);
+    return false;
+}
+
+template<typename AccessT>
+bool BytecodeInterpreter::atomic_pop_and_store(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto value = configuration.take_source(0, addresses.sources).to<AccessT>(); // bounds checked by verifier.
+    auto base = configuration.take_source(1, addresses.sources).to<u32>();
+    auto* location = atomic_memory_location<AccessT>(configuration, arg, base);
+    if (!location)
+        return true;
+    AK::atomic_store(location, value);
+    return false;
+}
+
+template<typename AccessT, typename PushT, BytecodeInterpreter::AtomicOperation operation>
+bool BytecodeInterpreter::atomic_read_modify_write(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto value = configuration.take_source(0, addresses.sources).to<AccessT>(); // bounds checked by verifier.
+    auto base = configuration.take_source(1, addresses.sources).to<u32>();
+    auto* location = atomic_memory_location<AccessT>(configuration, arg, base);
+    if (!location)
+        return true;
+
+    AccessT old_value;
+    if constexpr (operation == AtomicOperation::Add)
+        old_value = AK::atomic_fetch_add(location, value);
+    else if constexpr (operation == AtomicOperation::Subtract)
+        old_value = AK::atomic_fetch_sub(location, value);
+    else if constexpr (operation == AtomicOperation::And)
+        old_value = AK::atomic_fetch_and(location, value);
+    else if constexpr (operation == AtomicOperation::Or)
+        old_value = AK::atomic_fetch_or(location, value);
+    else if constexpr (operation == AtomicOperation::Xor)
+        old_value = AK::atomic_fetch_xor(location, value);
+    else
+        old_value = AK::atomic_exchange(location, value);
+
+    // NOTE: Narrow accesses zero-extend the value they read.
+    configuration.push_to_destination(Value(static_cast<PushT>(old_value)), addresses.destination);
+    return false;
+}
+
+template<typename AccessT, typename PushT>
+bool BytecodeInterpreter::atomic_compare_exchange(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto replacement = configuration.take_source(0, addresses.sources).to<AccessT>(); // bounds checked by verifier.
+    auto expected = configuration.take_source(1, addresses.sources).to<AccessT>();
+    auto base = configuration.take_source(2, addresses.sources).to<u32>();
+    auto* location = atomic_memory_location<AccessT>(configuration, arg, base);
+    if (!location)
+        return true;
+
+    // On failure, `expected` is updated to the value that was read, so it always ends up holding the old value.
+    (void)AK::atomic_compare_exchange_strong(location, expected, replacement);
+    configuration.push_to_destination(Value(static_cast<PushT>(expected)), addresses.destination);
+    return false;
+}
+
+template<typename AccessT>
+bool BytecodeInterpreter::atomic_wait(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto timeout = configuration.take_source(0, addresses.sources).to<i64>(); // bounds checked by verifier.
+    auto expected = configuration.take_source(1, addresses.sources).to<AccessT>();
+    auto base = configuration.take_source(2, addresses.sources).to<u32>();
+    auto* location = atomic_memory_location<AccessT>(configuration, arg, base);
+    if (!location)
+        return true;
+
+    // Nothing else could ever wake us up if the memory isn't shared.
+    auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
+    if (trap_if_not(configuration.store().get(address)->is_shared(), "Expected shared memory"sv))
+        return true;
+
+    // Like Atomics.wait, this must not block an agent that isn't allowed to, e.g. the main thread of a window.
+    if (trap_if_not(configuration.can_block(), "Agent cannot block"sv))
+        return true;
+
+    // A negative timeout means waiting forever.
+    Optional<AK::Duration> duration;
+    if (timeout >= 0)
+        duration = AK::Duration::from_nanoseconds(timeout);
+
+    auto result = WaiterList::the().wait(location, sizeof(AccessT), expected, duration);
+    configuration.push_to_destination(Value(to_underlying(result)), addresses.destination);
+    return false;
+}
+
+bool BytecodeInterpreter::atomic_notify(Configuration& configuration, Instruction const& instruction, SourcesAndDestination const& addresses)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto count = configuration.take_source(0, addresses.sources).to<u32>(); // bounds checked by verifier.
+    auto base = configuration.take_source(1, addresses.sources).to<u32>();
+    auto* location = atomic_memory_location<u32>(configuration, arg, base);
+    if (!location)
+        return true;
+
+    // Only shared memories can have waiters.
+    auto& address = configuration.frame().module().memories()[arg.memory_index.value()];
+    u32 woken_count = 0;
+    if (configuration.store().get(address)->is_shared())
+        woken_count = WaiterList::the().notify(location, count);
+
+    configuration.push_to_destination(Value(woken_count), addresses.destination);
     return false;
 }
 
@@ -101,6 +101,29 @@ struct WASM_API BytecodeInterpreter final : public Interpreter {
     template<typename T>
     bool store_to_memory(MemoryInstance&, u64 address, T value);
 
+    enum class AtomicOperation {
+        Add,
+        Subtract,
+        And,
+        Or,
+        Xor,
+        Exchange,
+    };
+
+    template<typename AccessT>
+    AccessT* atomic_memory_location(Configuration&, Instruction::MemoryArgument const&, u32 base);
+    template<typename AccessT, typename PushT>
+    bool atomic_load_and_push(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename AccessT>
+    bool atomic_pop_and_store(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename AccessT, typename PushT, AtomicOperation>
+    bool atomic_read_modify_write(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename AccessT, typename PushT>
+    bool atomic_compare_exchange(Configuration&, Instruction const&, SourcesAndDestination const&);
+    template<typename AccessT>
+    bool atomic_wait(Configuration&, Instruction const&, SourcesAndDestination const&);
+    bool atomic_notify(Configuration&, Instruction const&, SourcesAndDestination const&);
+
     template<typename PopTypeLHS, typename PushType, typename Operator, typename PopTypeRHS = PopTypeLHS, typename... Args>
     bool binary_numeric_operation(Configuration&, SourcesAndDestination const&, Args&&...);
 
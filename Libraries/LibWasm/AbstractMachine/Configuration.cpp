@@ -7,6 +7,7 @@
 #include <AK/MemoryStream.h>
 #include <LibWasm/AbstractMachine/Configuration.h>
 #include <LibWasm/AbstractMachine/Interpreter.h>
+#include <LibWasm/JIT/BaselineCompiler.h>
 #include <LibWasm/Printer/Printer.h>
 
 namespace Wasm {
@@ -22,10 +23,64 @@ Result Configuration::call(Interpreter& interpreter, FunctionAddress address, Ve
 {
     if (auto fn = TRY(prepare_call(address, arguments)); fn.has_value())
         return fn->function()(*this, arguments);
+    if (m_should_use_baseline_compiler && !m_should_limit_instruction_count) {
+        if (auto result = execute_baseline_code(address); result.has_value())
+            return result.release_value();
+    }
     m_ip = 0;
     return execute(interpreter);
 }
 
+Optional<Result> Configuration::execute_baseline_code(FunctionAddress address)
+{
+    auto& function = m_store.get(address)->get<WasmFunction>();
+    auto const& memories = function.module().memories();
+    auto* memory = memories.is_empty() ? nullptr : m_store.get(memories.first());
+
+    if (!function.has_attempted_baseline_compilation())
+        function.set_baseline_code(JIT::BaselineCompiler::compile(function, memory));
+
+    auto const* native_function = function.baseline_code();
+    if (!native_function)
+        return {};
+
+    // NOTE: prepare_call() has already pushed the frame, and its locals are laid out exactly the way native code expects.
+    auto& locals = frame().locals();
+    VERIFY(locals.size() == native_function->local_count());
+
+    u64 raw_result = 0;
+    auto status = native_function->run(locals.data(), memory ? memory->data().data() : nullptr, memory ? memory->size() : 0, &raw_result);
+    switch (status) {
+    case JIT::NativeFunction::ExitStatus::Returned:
+        break;
+    case JIT::NativeFunction::ExitStatus::MemoryAccessOutOfBounds:
+        return Result { Trap::from_string("Memory access out of bounds") };
+    case JIT::NativeFunction::ExitStatus::IntegerDivisionOverflow:
+        return Result { Trap::from_string("Integer division overflow") };
+    case JIT::NativeFunction::ExitStatus::Unreachable:
+        return Result { Trap::from_string("Unreachable") };
+    }
+
+    label_stack().take_last();
+
+    auto const& result_types = function.type().results();
+    if (result_types.is_empty())
+        return Result { Vector<Value> {} };
+
+    switch (result_types.first().kind()) {
+    case ValueType::I32:
+        return Result { Vector<Value> { Value(static_cast<i32>(raw_result)) } };
+    case ValueType::I64:
+        return Result { Vector<Value> { Value(static_cast<i64>(raw_result)) } };
+    case ValueType::F32:
+        return Result { Vector<Value> { Value(bit_cast<float>(static_cast<u32>(raw_result))) } };
+    case ValueType::F64:
+        return Result { Vector<Value> { Value(bit_cast<double>(raw_result)) } };
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
 ErrorOr<Optional<HostFunction&>, Trap> Configuration::prepare_call(FunctionAddress address, Vector<Value>& arguments, bool is_tailcall)
 {
     auto* function = m_store.get(address);
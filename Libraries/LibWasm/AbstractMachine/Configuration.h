@@ -76,6 +76,12 @@ public:
     void enable_instruction_count_limit() { m_should_limit_instruction_count = true; }
     bool should_limit_instruction_count() const { return m_should_limit_instruction_count; }
 
+    void enable_baseline_compiler() { m_should_use_baseline_compiler = true; }
+    bool should_use_baseline_compiler() const { return m_should_use_baseline_compiler; }
+
+    void disallow_blocking() { m_can_block = false; }
+    bool can_block() const { return m_can_block; }
+
     void dump_stack();
 
     ALWAYS_INLINE FLATTEN void push_to_destination(Value value, Dispatch::RegisterOrStack destination)
@@ -117,6 +123,7 @@ public:
 
 private:
     void unwind_impl();
+    Optional<Result> execute_baseline_code(FunctionAddress);
 
     Store& m_store;
     Vector<Value, 64, FastLastAccess::Yes> m_value_stack;
@@ -125,6 +132,8 @@ private:
     size_t m_depth { 0 };
     u64 m_ip { 0 };
     bool m_should_limit_instruction_count { false };
+    bool m_should_use_baseline_compiler { false };
+    bool m_can_block { true };
     Value* m_locals_base { nullptr };
 };
 
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Platform.h>
+#include <LibCore/System.h>
+#include <LibWasm/AbstractMachine/MemoryReservation.h>
+
+#if !defined(AK_OS_WINDOWS)
+#    include <sys/mman.h>
+#endif
+
+namespace Wasm {
+
+ErrorOr<NonnullOwnPtr<MemoryReservation>> MemoryReservation::create(size_t maximum_size, GuardRegion guard_region)
+{
+#if defined(AK_OS_WINDOWS)
+    // FIXME: Reserve with VirtualAlloc(MEM_RESERVE) and commit with VirtualAlloc(MEM_COMMIT).
+    (void)maximum_size;
+    (void)guard_region;
+    return Error::from_errno(ENOTSUP);
+#else
+    size_t reserved_size = maximum_size;
+#    if defined(AK_ARCH_64_BIT)
+    if (guard_region == GuardRegion::Yes)
+        reserved_size = max<size_t>(reserved_size, guarded_size);
+#    else
+    (void)guard_region;
+#    endif
+    if (reserved_size == 0)
+        reserved_size = Constants::page_size;
+
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#    if defined(MAP_NORESERVE)
+    flags |= MAP_NORESERVE;
+#    endif
+
+    auto* base = TRY(Core::System::mmap(nullptr, reserved_size, PROT_NONE, flags, -1, 0));
+    auto* reservation = new (nothrow) MemoryReservation(static_cast<u8*>(base), reserved_size, maximum_size);
+    if (!reservation) {
+        MUST(Core::System::munmap(base, reserved_size));
+        return Error::from_errno(ENOMEM);
+    }
+    return adopt_own(*reservation);
+#endif
+}
+
+MemoryReservation::~MemoryReservation()
+{
+#if !defined(AK_OS_WINDOWS)
+    MUST(Core::System::munmap(m_base, m_reserved_size));
+#endif
+}
+
+ErrorOr<void> MemoryReservation::commit(size_t size)
+{
+    VERIFY(size <= m_maximum_size);
+    if (size <= m_committed_size)
+        return {};
+
+#if defined(AK_OS_WINDOWS)
+    VERIFY_NOT_REACHED();
+#else
+    // NOTE: Memories grow in whole Wasm pages, which are a multiple of the host page size.
+    TRY(Core::System::mprotect(m_base + m_committed_size, size - m_committed_size, PROT_READ | PROT_WRITE));
+    m_committed_size = size;
+    return {};
+#endif
+}
+
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Error.h>
+#include <AK/NonnullOwnPtr.h>
+#include <AK/Noncopyable.h>
+#include <AK/Types.h>
+#include <LibWasm/Constants.h>
+#include <LibWasm/Export.h>
+
+namespace Wasm {
+
+// The address space backing a linear memory. The whole range is reserved up front without being accessible,
+// and pages are committed as the memory grows, so the memory's data never moves.
+//
+// A reservation can also cover a guard region past the largest size the memory can grow to. Nothing in there
+// is ever committed, so an access that lands in it faults instead of touching anything else.
+class WASM_API MemoryReservation {
+    AK_MAKE_NONCOPYABLE(MemoryReservation);
+    AK_MAKE_NONMOVABLE(MemoryReservation);
+
+public:
+    enum class GuardRegion {
+        No,
+        Yes,
+    };
+
+    // A memory with 32-bit addresses is accessed at a u32 address plus a u32 offset, by at most 16 bytes at a time.
+    // Reserving this much means that every such access lands inside the reservation.
+    static constexpr u64 guarded_size = 8 * GiB + Constants::page_size;
+
+    static ErrorOr<NonnullOwnPtr<MemoryReservation>> create(size_t maximum_size, GuardRegion);
+    ~MemoryReservation();
+
+    u8* base() const { return m_base; }
+    size_t maximum_size() const { return m_maximum_size; }
+    size_t committed_size() const { return m_committed_size; }
+    bool has_guard_region() const { return m_reserved_size >= guarded_size; }
+
+    // Makes everything up to `size` accessible. Pages that are committed for the first time read as zero.
+    ErrorOr<void> commit(size_t size);
+
+private:
+    MemoryReservation(u8* base, size_t reserved_size, size_t maximum_size)
+        : m_base(base)
+        , m_reserved_size(reserved_size)
+        , m_maximum_size(maximum_size)
+    {
+    }
+
+    u8* m_base { nullptr };
+    size_t m_reserved_size { 0 };
+    size_t m_maximum_size { 0 };
+    size_t m_committed_size { 0 };
+};
+
+}
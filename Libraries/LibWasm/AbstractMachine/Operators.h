@@ -22,6 +22,72 @@ namespace Wasm::Operators {
 
 using namespace AK::SIMD;
 
+template<typename ResultT, typename Op>
+struct SaturatingOp;
+
+namespace Detail {
+
+// The vector operators below work on whole native vectors where they can, so that e.g. i32x4.add is a single host
+// instruction rather than a loop over the lanes. These helpers cover the lane-wise operations C++ has no operator for.
+
+// Picks each lane from `if_true` where `mask` is all ones, and from `if_false` where it is all zeroes.
+// Comparing two vectors produces exactly such a mask.
+template<typename V, typename Mask>
+ALWAYS_INLINE static V select(Mask mask, V if_true, V if_false)
+{
+    auto bits = bit_cast<u64x2>(mask);
+    return bit_cast<V>((bit_cast<u64x2>(if_true) & bits) | (bit_cast<u64x2>(if_false) & ~bits));
+}
+
+// Clamps each lane to the range of `Element`, then narrows it to that type.
+template<typename Element, typename V>
+ALWAYS_INLINE static auto saturating_narrow(V value)
+{
+    using Lane = RemoveCVReference<decltype(value[0])>;
+    using Result = NativeVectorType<sizeof(Element) * 8, sizeof(V) / sizeof(Lane), MakeUnsigned, Element>;
+    auto const minimum = V {} + static_cast<Lane>(NumericLimits<Element>::min());
+    auto const maximum = V {} + static_cast<Lane>(NumericLimits<Element>::max());
+    value = select(value < minimum, minimum, value);
+    value = select(value > maximum, maximum, value);
+    return __builtin_convertvector(value, Result);
+}
+
+// Lane 2i of a vector is the low half of lane i of the same bits viewed as a vector of lanes twice as wide
+// (and lane 2i + 1 its high half), as Wasm lanes are laid out in little-endian order.
+template<typename Wide>
+ALWAYS_INLINE static Wide extend_even_lanes(Wide value)
+{
+    constexpr auto half_width = sizeof(value[0]) * 4;
+    return (value << half_width) >> half_width;
+}
+
+template<typename Wide>
+ALWAYS_INLINE static Wide extend_odd_lanes(Wide value)
+{
+    constexpr auto half_width = sizeof(value[0]) * 4;
+    return value >> half_width;
+}
+
+template<typename V>
+ALWAYS_INLINE static V float_minimum(V lhs, V rhs)
+{
+    using Lane = RemoveCVReference<decltype(lhs[0])>;
+    // Or-ing the lesser lane picked both ways round makes min(-0, +0) be -0, which `<` alone can't tell apart.
+    auto bits = bit_cast<u64x2>(select(lhs < rhs, lhs, rhs)) | bit_cast<u64x2>(select(rhs < lhs, rhs, lhs));
+    return select((lhs != lhs) | (rhs != rhs), V {} + AK::NaN<Lane>, bit_cast<V>(bits));
+}
+
+template<typename V>
+ALWAYS_INLINE static V float_maximum(V lhs, V rhs)
+{
+    using Lane = RemoveCVReference<decltype(lhs[0])>;
+    // And-ing the greater lane picked both ways round makes max(-0, +0) be +0, which `>` alone can't tell apart.
+    auto bits = bit_cast<u64x2>(select(lhs > rhs, lhs, rhs)) & bit_cast<u64x2>(select(rhs > lhs, rhs, lhs));
+    return select((lhs != lhs) | (rhs != rhs), V {} + AK::NaN<Lane>, bit_cast<V>(bits));
+}
+
+}
+
 #define DEFINE_BINARY_OPERATOR(Name, operation) \
     struct Name {                               \
         template<typename Lhs, typename Rhs>    \
@@ -339,16 +405,11 @@ template<size_t VectorSize, typename Op, template<typename> typename SetSign = M
 struct VectorCmpOp {
     auto operator()(u128 c1, u128 c2) const
     {
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        auto result = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c1);
-        auto other = bit_cast<Native128ByteVectorOf<ElementType, SetSign>>(c2);
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            SetSign<ElementType> lhs = result[i];
-            SetSign<ElementType> rhs = other[i];
-            result[i] = op(lhs, rhs) ? static_cast<MakeUnsigned<ElementType>>(-1) : 0;
-        }
-        return bit_cast<u128>(result);
+        using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        auto first = bit_cast<VectorType>(c1);
+        auto other = bit_cast<VectorType>(c2);
+        // Comparing vectors yields all ones in the lanes where the comparison holds, and all zeroes elsewhere.
+        return bit_cast<u128>(Op {}(first, other));
     }
 
     static StringView name()
@@ -374,12 +435,7 @@ struct VectorFloatCmpOp {
     {
         auto first = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c1);
         auto other = bit_cast<NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>>(c2);
-        using ElementType = NativeIntegralType<128 / VectorSize>;
-        Native128ByteVectorOf<ElementType, MakeUnsigned> result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i)
-            result[i] = op(first[i], other[i]) ? static_cast<ElementType>(-1) : 0;
-        return bit_cast<u128>(result);
+        return bit_cast<u128>(Op {}(first, other));
     }
 
     static StringView name()
@@ -575,17 +631,11 @@ struct VectorIntegerExtOpPairwise {
     auto operator()(u128 c) const
     {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
-        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
-        auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-        Op op;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(vector[i * 2], vector[(i * 2) + 1]);
-        }
-
-        return bit_cast<u128>(result);
+        using LaneBits = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+        auto vector = bit_cast<VectorResult>(c);
+        auto even = bit_cast<LaneBits>(Detail::extend_even_lanes(vector));
+        auto odd = bit_cast<LaneBits>(Detail::extend_odd_lanes(vector));
+        return bit_cast<u128>(Op {}(even, odd));
     }
 
     static StringView name()
@@ -608,26 +658,24 @@ enum class VectorExt {
     Low,
 };
 
+namespace Detail {
+
+template<VectorExt Mode, typename Half>
+ALWAYS_INLINE static Half half_of(u128 value)
+{
+    static_assert(sizeof(Half) == sizeof(u64));
+    return bit_cast<Half>(bit_cast<u64x2>(value)[Mode == VectorExt::High ? 1 : 0]);
+}
+
+}
+
 template<size_t VectorSize, VectorExt Mode, template<typename> typename SetSign = MakeSigned>
 struct VectorIntegerExt {
     auto operator()(u128 c) const
     {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
-        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
-        auto vector = bit_cast<VectorInput>(c);
-        VectorResult result;
-
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High)
-                result[i] = vector[VectorSize + i];
-            else if constexpr (Mode == VectorExt::Low)
-                result[i] = vector[i];
-            else
-                VERIFY_NOT_REACHED();
-        }
-
-        return bit_cast<u128>(result);
+        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize, SetSign>;
+        return bit_cast<u128>(__builtin_convertvector(Detail::half_of<Mode, VectorInput>(c), VectorResult));
     }
 
     static StringView name()
@@ -650,28 +698,21 @@ struct VectorIntegerExtOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
-        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, SetSign>;
-        auto first = bit_cast<VectorInput>(lhs);
-        auto second = bit_cast<VectorInput>(rhs);
-        VectorResult result;
-        Op op;
-
-        using ResultType = SetSign<NativeIntegralType<128 / VectorSize>>;
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            if constexpr (Mode == VectorExt::High) {
-                ResultType a = first[VectorSize + i];
-                ResultType b = second[VectorSize + i];
-                result[i] = op(a, b);
-            } else if constexpr (Mode == VectorExt::Low) {
-                ResultType a = first[i];
-                ResultType b = second[i];
-                result[i] = op(a, b);
-            } else
-                VERIFY_NOT_REACHED();
+        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize, SetSign>;
+        auto first = __builtin_convertvector(Detail::half_of<Mode, VectorInput>(lhs), VectorResult);
+        auto second = __builtin_convertvector(Detail::half_of<Mode, VectorInput>(rhs), VectorResult);
+
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            // NOTE: Wrapping arithmetic is done on unsigned lanes, so that signed overflow isn't undefined behavior.
+            using LaneBits = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+            return bit_cast<u128>(Op {}(bit_cast<LaneBits>(first), bit_cast<LaneBits>(second)));
+        } else {
+            VectorResult result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i)
+                result[i] = op(first[i], second[i]);
+            return bit_cast<u128>(result);
         }
-
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -694,17 +735,42 @@ struct VectorIntegerBinaryOp {
     auto operator()(u128 lhs, u128 rhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        using LaneBits = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply, BitAnd, BitOr, BitXor>) {
+            // NOTE: Wrapping arithmetic is done on unsigned lanes, so that signed overflow isn't undefined behavior.
+            return bit_cast<u128>(Op {}(bit_cast<LaneBits>(first), bit_cast<LaneBits>(second)));
+        } else if constexpr (IsSame<Op, Minimum>) {
+            return bit_cast<u128>(Detail::select(first < second, first, second));
+        } else if constexpr (IsSame<Op, Maximum>) {
+            return bit_cast<u128>(Detail::select(first > second, first, second));
+        } else if constexpr (IsSame<Op, Average>) {
+            // (a + b + 1) / 2, without the intermediate sum overflowing the lane.
+            auto a = bit_cast<LaneBits>(first);
+            auto b = bit_cast<LaneBits>(second);
+            return bit_cast<u128>((a | b) - ((a ^ b) >> 1));
+        } else if constexpr (IsSpecializationOf<Op, SaturatingOp>) {
+            // Lanes twice as wide can hold any exact result, which is then clamped back into range.
+            // Each half is done separately, so that the wide lanes still fit in a 128-bit register.
+            using HalfVectorType = NativeVectorType<128 / VectorSize, VectorSize / 2, SetSign>;
+            using WideVectorType = NativeVectorType<2 * 128 / VectorSize, VectorSize / 2, MakeSigned>;
+            auto saturate = [](HalfVectorType a, HalfVectorType b) {
+                auto wide_result = typename Op::Operation {}(__builtin_convertvector(a, WideVectorType), __builtin_convertvector(b, WideVectorType));
+                return bit_cast<u64>(Detail::saturating_narrow<typename Op::ResultType>(wide_result));
+            };
+            return bit_cast<u128>(u64x2 {
+                saturate(Detail::half_of<VectorExt::Low, HalfVectorType>(lhs), Detail::half_of<VectorExt::Low, HalfVectorType>(rhs)),
+                saturate(Detail::half_of<VectorExt::High, HalfVectorType>(lhs), Detail::half_of<VectorExt::High, HalfVectorType>(rhs)),
+            });
+        } else {
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i)
+                result[i] = op(first[i], second[i]);
+            return bit_cast<u128>(result);
         }
-
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -772,20 +838,14 @@ struct VectorDotProduct {
     template<typename... ContinuationArgs>
     auto operator()(u128 lhs, u128 rhs, ContinuationArgs&&... args) const
     {
-        using VectorInput = NativeVectorType<128 / (VectorSize * 2), VectorSize * 2, MakeSigned>;
         using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>;
-        auto v1 = bit_cast<VectorInput>(lhs);
-        auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
-
-        using ResultType = MakeUnsigned<NativeIntegralType<128 / VectorSize>>;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            ResultType low = v1[i * 2] * v2[i * 2];
-            ResultType high = v1[(i * 2) + 1] * v2[(i * 2) + 1];
-            result[i] = low + high;
-        }
+        using LaneBits = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
+        auto v1 = bit_cast<VectorResult>(lhs);
+        auto v2 = bit_cast<VectorResult>(rhs);
+        auto low = bit_cast<LaneBits>(Detail::extend_even_lanes(v1)) * bit_cast<LaneBits>(Detail::extend_even_lanes(v2));
+        auto high = bit_cast<LaneBits>(Detail::extend_odd_lanes(v1)) * bit_cast<LaneBits>(Detail::extend_odd_lanes(v2));
 
-        return ContinuationOp { forward<ContinuationArgs>(args)... }(bit_cast<u128>(result));
+        return ContinuationOp { forward<ContinuationArgs>(args)... }(bit_cast<u128>(low + high));
     }
 
     static StringView name() { return "dot"sv; }
@@ -796,29 +856,9 @@ struct VectorNarrow {
     auto operator()(u128 lhs, u128 rhs) const
     {
         using VectorInput = NativeVectorType<128 / (VectorSize / 2), VectorSize / 2, MakeSigned>;
-        using VectorResult = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
-        auto v1 = bit_cast<VectorInput>(lhs);
-        auto v2 = bit_cast<VectorInput>(rhs);
-        VectorResult result;
-
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v1[i] <= NumericLimits<Element>::min())
-                result[i] = NumericLimits<Element>::min();
-            else if (v1[i] >= NumericLimits<Element>::max())
-                result[i] = NumericLimits<Element>::max();
-            else
-                result[i] = v1[i];
-        }
-        for (size_t i = 0; i < (VectorSize / 2); ++i) {
-            if (v2[i] <= NumericLimits<Element>::min())
-                result[i + VectorSize / 2] = NumericLimits<Element>::min();
-            else if (v2[i] >= NumericLimits<Element>::max())
-                result[i + VectorSize / 2] = NumericLimits<Element>::max();
-            else
-                result[i + VectorSize / 2] = v2[i];
-        }
-
-        return bit_cast<u128>(result);
+        auto low = Detail::saturating_narrow<Element>(bit_cast<VectorInput>(lhs));
+        auto high = Detail::saturating_narrow<Element>(bit_cast<VectorInput>(rhs));
+        return bit_cast<u128>(u64x2 { bit_cast<u64>(low), bit_cast<u64>(high) });
     }
 
     static StringView name() { return "narrow"sv; }
@@ -829,16 +869,23 @@ struct VectorIntegerUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeVectorType<128 / VectorSize, VectorSize, SetSign>;
+        using LaneBits = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
-        Op op;
 
-        // FIXME: Find a way to not loop here
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(value[i]);
+        if constexpr (IsSame<Op, Negate>) {
+            return bit_cast<u128>(-bit_cast<LaneBits>(value));
+        } else if constexpr (IsSame<Op, Absolute>) {
+            // Flip the negative lanes and add one, leaving the most negative value as is (as the spec asks for).
+            auto negative = bit_cast<LaneBits>(bit_cast<NativeVectorType<128 / VectorSize, VectorSize, MakeSigned>>(value) < 0);
+            return bit_cast<u128>((bit_cast<LaneBits>(value) ^ negative) - negative);
+        } else {
+            VectorType result;
+            Op op;
+            // FIXME: Find a way to not loop here
+            for (size_t i = 0; i < VectorSize; ++i)
+                result[i] = op(value[i]);
+            return bit_cast<u128>(result);
         }
-
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -865,12 +912,26 @@ struct VectorFloatBinaryOp {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
         auto first = bit_cast<VectorType>(lhs);
         auto second = bit_cast<VectorType>(rhs);
-        VectorType result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(first[i], second[i]);
+
+        if constexpr (IsOneOf<Op, Add, Subtract, Multiply>) {
+            return bit_cast<u128>(Op {}(first, second));
+        } else if constexpr (IsSame<Op, Divide>) {
+            return bit_cast<u128>(first / second);
+        } else if constexpr (IsSame<Op, Minimum>) {
+            return bit_cast<u128>(Detail::float_minimum(first, second));
+        } else if constexpr (IsSame<Op, Maximum>) {
+            return bit_cast<u128>(Detail::float_maximum(first, second));
+        } else if constexpr (IsSame<Op, PseudoMinimum>) {
+            return bit_cast<u128>(Detail::select(second < first, second, first));
+        } else if constexpr (IsSame<Op, PseudoMaximum>) {
+            return bit_cast<u128>(Detail::select(first < second, second, first));
+        } else {
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i)
+                result[i] = op(first[i], second[i]);
+            return bit_cast<u128>(result);
         }
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -891,13 +952,22 @@ struct VectorFloatUnaryOp {
     auto operator()(u128 lhs) const
     {
         using VectorType = NativeFloatingVectorType<128, VectorSize, NativeFloatingType<128 / VectorSize>>;
+        using LaneBits = NativeVectorType<128 / VectorSize, VectorSize, MakeUnsigned>;
         auto value = bit_cast<VectorType>(lhs);
-        VectorType result;
-        Op op;
-        for (size_t i = 0; i < VectorSize; ++i) {
-            result[i] = op(value[i]);
+
+        // Negation and absolute value only touch the sign bit, NaNs included.
+        constexpr auto sign_bit = static_cast<NativeIntegralType<128 / VectorSize>>(1) << (128 / VectorSize - 1);
+        if constexpr (IsSame<Op, Negate>) {
+            return bit_cast<u128>(bit_cast<LaneBits>(value) ^ sign_bit);
+        } else if constexpr (IsSame<Op, Absolute>) {
+            return bit_cast<u128>(bit_cast<LaneBits>(value) & ~sign_bit);
+        } else {
+            VectorType result;
+            Op op;
+            for (size_t i = 0; i < VectorSize; ++i)
+                result[i] = op(value[i]);
+            return bit_cast<u128>(result);
         }
-        return bit_cast<u128>(result);
     }
 
     static StringView name()
@@ -1170,6 +1240,9 @@ struct SaturatingTruncate {
 
 template<typename ResultT, typename Op>
 struct SaturatingOp {
+    using ResultType = ResultT;
+    using Operation = Op;
+
     template<typename Lhs, typename Rhs>
     ResultT operator()(Lhs lhs, Rhs rhs) const
     {
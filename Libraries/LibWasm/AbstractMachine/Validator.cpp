@@ -5,9 +5,11 @@
  */
 
 #include <AK/HashTable.h>
+#include <AK/NonnullOwnPtr.h>
 #include <AK/SourceLocation.h>
 #include <AK/TemporaryChange.h>
 #include <AK/Try.h>
+#include <LibThreading/Parallel.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWasm/Printer/Printer.h>
 
@@ -249,28 +251,59 @@ ErrorOr<void, ValidationError> Validator::validate(TableSection const& section)
 
 ErrorOr<void, ValidationError> Validator::validate(CodeSection const& section)
 {
+    // Function bodies are validated (and compiled to dispatch lists) independently of each other, so we do that in parallel.
+    // NOTE: The per-function validators share reference-counted storage with our context, so they are only ever
+    //       created and destroyed on this thread; the workers only read through them.
+    static constexpr size_t minimum_functions_per_thread = 32;
+
+    auto& functions = section.functions();
+    Vector<NonnullOwnPtr<Validator>> function_validators;
+    function_validators.ensure_capacity(functions.size());
+
+    Optional<ValidationError> index_error;
     size_t index = m_context.imported_function_count;
-    for (auto& entry : section.functions()) {
+    for (auto& entry : functions) {
         auto function_index = index++;
-        TRY(validate(FunctionIndex { function_index }));
+        if (auto result = validate(FunctionIndex { function_index }); result.is_error()) {
+            index_error = result.release_error();
+            break;
+        }
         auto& function_type = m_context.functions[function_index];
         auto& function = entry.func();
 
-        auto function_validator = fork();
-        function_validator.m_context.locals = {};
-        function_validator.m_context.locals.extend(function_type.parameters());
+        auto function_validator = adopt_own(*new Validator(m_context));
+        function_validator->m_context.locals = {};
+        function_validator->m_context.locals.extend(function_type.parameters());
         for (auto& local : function.locals()) {
             for (size_t i = 0; i < local.n(); ++i)
-                function_validator.m_context.locals.append(local.type());
+                function_validator->m_context.locals.append(local.type());
         }
 
-        function_validator.m_frames.empend(function_type, FrameKind::Function, (size_t)0);
-        function_validator.m_max_frame_size = max(function_validator.m_max_frame_size, function_validator.m_frames.size());
+        function_validator->m_frames.empend(function_type, FrameKind::Function, (size_t)0);
+        function_validator->m_max_frame_size = max(function_validator->m_max_frame_size, function_validator->m_frames.size());
+        function_validators.unchecked_append(move(function_validator));
+    }
 
-        auto results = TRY(function_validator.validate(function.body(), function_type.results()));
-        if (results.result_types.size() != function_type.results().size())
-            return Errors::invalid("function result"sv, function_type.results(), results.result_types);
+    Vector<Optional<ValidationError>> errors;
+    errors.resize(function_validators.size());
+    Threading::for_each_in_parallel(
+        function_validators.size(), [&](size_t i) {
+            auto& function_type = m_context.functions[m_context.imported_function_count + i];
+            auto results = function_validators[i]->validate(functions[i].func().body(), function_type.results());
+            if (results.is_error())
+                errors[i] = results.release_error();
+            else if (results.value().result_types.size() != function_type.results().size())
+                errors[i] = Errors::invalid("function result"sv, function_type.results(), results.value().result_types);
+        },
+        minimum_functions_per_thread);
+
+    // Report the same error a sequential walk over the functions would have.
+    for (auto& error : errors) {
+        if (error.has_value())
+            return error.release_value();
     }
+    if (index_error.has_value())
+        return index_error.release_value();
 
     return {};
 }
@@ -284,7 +317,13 @@ ErrorOr<void, ValidationError> Validator::validate(TableType const& type)
 ErrorOr<void, ValidationError> Validator::validate(MemoryType const& type)
 {
     u64 bound = type.limits().address_type() == AddressType::I64 ? 1ull << 48 : 1ull << 16;
-    return validate(type.limits(), bound);
+    TRY(validate(type.limits(), bound));
+
+    // Proposal 'threads': shared memories must have a maximum size, as they can never move once shared.
+    if (type.limits().is_shared() && !type.limits().max().has_value())
+        return Errors::invalid("shared memory without a maximum size"sv);
+
+    return {};
 }
 
 ErrorOr<void, ValidationError> Validator::validate(Wasm::TagType const& tag_type)
@@ -3995,6 +4034,791 @@ VALIDATE_INSTRUCTION(i32x4_relaxed_dot_i8x16_i7x16_add_s)
     return stack.take_and_put<ValueType::V128, ValueType::V128, ValueType::V128>(ValueType::V128);
 }
 
+VALIDATE_INSTRUCTION(memory_atomic_notify)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait32)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(memory_atomic_wait64)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(atomic_fence)
+{
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load8_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_load16_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load8_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load16_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_load32_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store8)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_store16)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store8)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store16)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_store32)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_add)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_add)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_add_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_sub)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_sub)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_sub_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_and)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_and)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_and_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_or)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_or)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_or_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xor)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xor)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xor_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_xchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_xchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_xchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw_cmpxchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i32)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw_cmpxchg)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(i64)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw8_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i32_atomic_rmw16_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I32>()));
+    TRY((stack.take<ValueType::I32>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I32));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw8_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u8)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw16_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u16)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
+VALIDATE_INSTRUCTION(i64_atomic_rmw32_cmpxchg_u)
+{
+    auto& arg = instruction.arguments().get<Instruction::MemoryArgument>();
+    auto memory = TRY(validate_atomic_memory_argument(arg, sizeof(u32)));
+
+    TRY((stack.take<ValueType::I64>()));
+    TRY((stack.take<ValueType::I64>()));
+    TRY((take_memory_address(stack, memory, arg)));
+
+    stack.append(ValueType(ValueType::I64));
+    return {};
+}
+
 VALIDATE_INSTRUCTION(synthetic_end_expression)
 {
     is_constant = true;
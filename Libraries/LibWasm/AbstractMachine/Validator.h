@@ -318,6 +318,15 @@ public:
         return {};
     }
 
+    // Proposal 'threads': atomic memory accesses must state their natural alignment.
+    ErrorOr<MemoryType, ValidationError> validate_atomic_memory_argument(Instruction::MemoryArgument const& arg, size_t access_size) const
+    {
+        auto memory = TRY(validate(arg.memory_index));
+        if ((1ull << arg.align) != access_size)
+            return Errors::invalid("atomic memory op alignment"sv, access_size, 1ull << arg.align);
+        return memory;
+    }
+
 private:
     explicit Validator(Context context)
         : m_context(move(context))
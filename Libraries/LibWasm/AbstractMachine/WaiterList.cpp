@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <LibThreading/ConditionVariable.h>
+#include <LibWasm/AbstractMachine/WaiterList.h>
+
+namespace Wasm {
+
+struct WaiterList::Waiter {
+    Waiter(Threading::Mutex& mutex, void const* location)
+        : location(location)
+        , condition(mutex)
+    {
+    }
+
+    void const* location { nullptr };
+    bool was_woken { false };
+    Threading::ConditionVariable condition;
+};
+
+WaiterList& WaiterList::the()
+{
+    static WaiterList waiter_list;
+    return waiter_list;
+}
+
+static u64 load_value(void const* location, size_t size)
+{
+    switch (size) {
+    case sizeof(u32):
+        return AK::atomic_load(static_cast<u32 volatile*>(const_cast<void*>(location)));
+    case sizeof(u64):
+        return AK::atomic_load(static_cast<u64 volatile*>(const_cast<void*>(location)));
+    default:
+        VERIFY_NOT_REACHED();
+    }
+}
+
+WaiterList::WaitResult WaiterList::wait(void const* location, size_t size, u64 expected, Optional<AK::Duration> timeout)
+{
+    Optional<UnixDateTime> deadline;
+    if (timeout.has_value())
+        deadline = UnixDateTime::now() + *timeout;
+
+    Threading::MutexLocker locker(m_mutex);
+
+    // NOTE: Stores are not done under the lock, but a thread that stores a new value and then calls notify() has to
+    //       take the lock to do so, so it either sees this waiter in the list or we see the new value here.
+    if (load_value(location, size) != expected)
+        return WaitResult::NotEqual;
+
+    Waiter waiter { m_mutex, location };
+    m_waiters.append(&waiter);
+
+    while (!waiter.was_woken) {
+        if (!deadline.has_value()) {
+            waiter.condition.wait();
+            continue;
+        }
+        if (!waiter.condition.wait_until(*deadline) && !waiter.was_woken) {
+            m_waiters.remove_first_matching([&](auto* entry) { return entry == &waiter; });
+            return WaitResult::TimedOut;
+        }
+    }
+
+    return WaitResult::Woken;
+}
+
+u32 WaiterList::notify(void const* location, u32 count)
+{
+    Threading::MutexLocker locker(m_mutex);
+
+    u32 woken_count = 0;
+    m_waiters.remove_all_matching([&](Waiter* waiter) {
+        if (woken_count == count || waiter->location != location)
+            return false;
+        waiter->was_woken = true;
+        waiter->condition.signal();
+        ++woken_count;
+        return true;
+    });
+    return woken_count;
+}
+
+}
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/Time.h>
+#include <AK/Types.h>
+#include <AK/Vector.h>
+#include <LibThreading/Mutex.h>
+#include <LibWasm/Export.h>
+
+namespace Wasm {
+
+// The threads blocked in memory.atomic.wait{32,64}, for memory.atomic.notify to wake up.
+//
+// Waiters are keyed by the host address of the location they wait on. This identifies a location across every
+// instance sharing a memory, as shared memories are never moved when they grow.
+class WASM_API WaiterList {
+    AK_MAKE_NONCOPYABLE(WaiterList);
+    AK_MAKE_NONMOVABLE(WaiterList);
+
+public:
+    static WaiterList& the();
+
+    // These are the values memory.atomic.wait pushes.
+    enum class WaitResult : i32 {
+        Woken = 0,
+        NotEqual = 1,
+        TimedOut = 2,
+    };
+
+    // Blocks the calling thread if the `size` bytes at `location` hold `expected`, until it is woken up by notify()
+    // or the timeout (if any) expires. The comparison and going to sleep are atomic with respect to notify().
+    WaitResult wait(void const* location, size_t size, u64 expected, Optional<AK::Duration> timeout);
+
+    // Wakes up at most `count` threads waiting on `location`, in the order they started waiting.
+    // Returns the number of threads woken up.
+    u32 notify(void const* location, u32 count);
+
+private:
+    WaiterList() = default;
+
+    struct Waiter;
+
+    Threading::Mutex m_mutex;
+    Vector<Waiter*> m_waiters;
+};
+
+}
@@ -51,6 +51,7 @@ static constexpr auto extern_global_tag = 0x03;
 static constexpr auto extern_tag_tag = 0x04; // Proposal "exception-handling"
 
 static constexpr auto page_size = 64 * KiB;
+static constexpr u64 max_memory_pages = 65535;
 
 // Implementation-defined limits
 // These are not concretely defined by the spec, so the values are only defined by us.
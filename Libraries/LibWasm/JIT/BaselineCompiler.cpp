@@ -0,0 +1,745 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/BitCast.h>
+#include <AK/Debug.h>
+#include <AK/Platform.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/JIT/BaselineCompiler.h>
+#include <LibWasm/Printer/Printer.h>
+
+namespace Wasm::JIT {
+
+using Reg = Assembler::Reg;
+using Condition = Assembler::Condition;
+using Width = Assembler::Width;
+using ShiftKind = Assembler::ShiftKind;
+using ExitStatus = NativeFunction::ExitStatus;
+
+// Native code register assignment. These are all callee-saved, and are set up from the arguments in the prologue.
+static constexpr auto LOCALS_BASE = Reg::RBX;
+static constexpr auto MEMORY_BASE = Reg::R12;
+static constexpr auto MEMORY_SIZE = Reg::R13;
+static constexpr auto RESULT_POINTER = Reg::R14;
+
+// The callee-saved registers above are pushed right below the saved frame pointer, operand stack slots follow them.
+static constexpr i32 saved_registers_size = 4 * sizeof(u64);
+
+// Keeps every local displacement comfortably within a disp32.
+static constexpr size_t max_local_count = 1 * MiB;
+
+// NOTE: The prologue moves the stack pointer down by the whole frame at once, without probing the pages in between.
+//       Keeping the saved registers and operand stack slots within a single page means every access to the frame is
+//       less than a page away from the pushes that precede it, so it can't skip over a guard page at the end of the
+//       stack. Functions with deeper operand stacks stay in the interpreter.
+static constexpr size_t max_frame_size = 4 * KiB; // The smallest page size on any platform we support.
+static constexpr size_t max_stack_height = (max_frame_size - saved_registers_size) / sizeof(u64);
+
+static bool is_supported_value_type(ValueType const& type)
+{
+    switch (type.kind()) {
+    case ValueType::I32:
+    case ValueType::I64:
+    case ValueType::F32:
+    case ValueType::F64:
+        return true;
+    default:
+        return false;
+    }
+}
+
+void BaselineCompiler::load_slot(Reg dst, size_t slot)
+{
+    m_assembler.load64(dst, Reg::RBP, -saved_registers_size - static_cast<i32>((slot + 1) * sizeof(u64)));
+}
+
+void BaselineCompiler::store_slot(size_t slot, Reg src)
+{
+    m_assembler.store64(Reg::RBP, -saved_registers_size - static_cast<i32>((slot + 1) * sizeof(u64)), src);
+}
+
+void BaselineCompiler::load_local(Reg dst, LocalIndex index)
+{
+    // NOTE: Numeric values keep their bits in the low half of the Value.
+    m_assembler.load64(dst, LOCALS_BASE, static_cast<i32>(index.value() * sizeof(Value)));
+}
+
+void BaselineCompiler::store_local(LocalIndex index, Reg src)
+{
+    m_assembler.store64(LOCALS_BASE, static_cast<i32>(index.value() * sizeof(Value)), src);
+}
+
+void BaselineCompiler::emit_prologue(size_t frame_size)
+{
+    m_assembler.push(Reg::RBP);
+    m_assembler.mov64(Reg::RBP, Reg::RSP);
+    m_assembler.push(LOCALS_BASE);
+    m_assembler.push(MEMORY_BASE);
+    m_assembler.push(MEMORY_SIZE);
+    m_assembler.push(RESULT_POINTER);
+    if (frame_size > 0)
+        m_assembler.sub(Width::Bits64, Reg::RSP, static_cast<i32>(frame_size));
+
+    // System V: (Value* locals, u8* memory_base, u64 memory_size, u64* result)
+    m_assembler.mov64(LOCALS_BASE, Reg::RDI);
+    m_assembler.mov64(MEMORY_BASE, Reg::RSI);
+    m_assembler.mov64(MEMORY_SIZE, Reg::RDX);
+    m_assembler.mov64(RESULT_POINTER, Reg::RCX);
+}
+
+void BaselineCompiler::emit_epilogue()
+{
+    m_epilogue_offset = m_assembler.current_offset();
+    m_assembler.mov64(Reg::RSP, Reg::RBP);
+    m_assembler.sub(Width::Bits64, Reg::RSP, saved_registers_size);
+    m_assembler.pop(RESULT_POINTER);
+    m_assembler.pop(MEMORY_SIZE);
+    m_assembler.pop(MEMORY_BASE);
+    m_assembler.pop(LOCALS_BASE);
+    m_assembler.pop(Reg::RBP);
+    m_assembler.ret();
+}
+
+void BaselineCompiler::emit_trap_if(Condition condition, ExitStatus status)
+{
+    // NOTE: Trap stubs are emitted out of line once the whole function has been compiled.
+    m_pending_traps.append({ m_assembler.jump_if(condition), status });
+}
+
+bool BaselineCompiler::enter_block(ControlFrame::Kind kind, BlockType const& block_type)
+{
+    size_t arity = 0;
+    switch (block_type.kind()) {
+    case BlockType::Empty:
+        break;
+    case BlockType::Type:
+        if (!is_supported_value_type(block_type.value_type()))
+            return false;
+        arity = 1;
+        break;
+    case BlockType::Index:
+        // FIXME: Support blocks with parameters and multiple results.
+        return false;
+    }
+
+    m_control_stack.append({
+        .kind = kind,
+        .stack_height = m_stack_height,
+        .arity = arity,
+        .loop_start_offset = m_assembler.current_offset(),
+        .branches_to_end = {},
+        .jump_to_else = {},
+    });
+    return true;
+}
+
+BaselineCompiler::ControlFrame* BaselineCompiler::frame_for_label(LabelIndex label)
+{
+    if (label.value() >= m_control_stack.size())
+        return nullptr;
+    return &m_control_stack[m_control_stack.size() - 1 - label.value()];
+}
+
+bool BaselineCompiler::branch_needs_moves(ControlFrame const& target) const
+{
+    // NOTE: Branching to a loop goes back to its start, which takes no values since loops can't have parameters here.
+    if (target.kind == ControlFrame::Kind::Loop || target.arity == 0)
+        return false;
+    return m_stack_height - target.arity != target.stack_height;
+}
+
+void BaselineCompiler::emit_branch(ControlFrame& target)
+{
+    if (target.kind == ControlFrame::Kind::Loop) {
+        m_assembler.link(m_assembler.jump(), target.loop_start_offset);
+        return;
+    }
+
+    // Move the branch's values to where the target block leaves its results. Only RAX is clobbered here.
+    if (branch_needs_moves(target)) {
+        for (size_t i = 0; i < target.arity; ++i) {
+            load_slot(Reg::RAX, m_stack_height - target.arity + i);
+            store_slot(target.stack_height + i, Reg::RAX);
+        }
+    }
+    target.branches_to_end.append(m_assembler.jump());
+}
+
+bool BaselineCompiler::emit_branch_to_label(LabelIndex label)
+{
+    auto* target = frame_for_label(label);
+    if (!target)
+        return false;
+    emit_branch(*target);
+    return true;
+}
+
+bool BaselineCompiler::emit_branch_to_label_if_nonzero(LabelIndex label, Reg condition)
+{
+    auto* target = frame_for_label(label);
+    if (!target)
+        return false;
+
+    m_assembler.test(Width::Bits32, condition, condition);
+    if (branch_needs_moves(*target)) {
+        auto skip = m_assembler.jump_if(Condition::Equal);
+        emit_branch(*target);
+        m_assembler.link_to_here(skip);
+        return true;
+    }
+
+    auto jump = m_assembler.jump_if(Condition::NotEqual);
+    if (target->kind == ControlFrame::Kind::Loop)
+        m_assembler.link(jump, target->loop_start_offset);
+    else
+        target->branches_to_end.append(jump);
+    return true;
+}
+
+void BaselineCompiler::emit_binary(Width width, OpCode opcode)
+{
+    load_slot(Reg::RAX, m_stack_height - 2);
+    load_slot(Reg::RCX, m_stack_height - 1);
+
+    switch (opcode.value()) {
+    case Instructions::i32_add.value():
+    case Instructions::i64_add.value():
+        m_assembler.add(width, Reg::RAX, Reg::RCX);
+        break;
+    case Instructions::i32_sub.value():
+    case Instructions::i64_sub.value():
+        m_assembler.sub(width, Reg::RAX, Reg::RCX);
+        break;
+    case Instructions::i32_mul.value():
+    case Instructions::i64_mul.value():
+        m_assembler.imul(width, Reg::RAX, Reg::RCX);
+        break;
+    case Instructions::i32_and.value():
+    case Instructions::i64_and.value():
+        m_assembler.and_(width, Reg::RAX, Reg::RCX);
+        break;
+    case Instructions::i32_or.value():
+    case Instructions::i64_or.value():
+        m_assembler.or_(width, Reg::RAX, Reg::RCX);
+        break;
+    case Instructions::i32_xor.value():
+    case Instructions::i64_xor.value():
+        m_assembler.xor_(width, Reg::RAX, Reg::RCX);
+        break;
+    // NOTE: x86 masks the shift count in CL exactly the way Wasm wants it to.
+    case Instructions::i32_shl.value():
+    case Instructions::i64_shl.value():
+        m_assembler.shift_by_cl(width, ShiftKind::Left, Reg::RAX);
+        break;
+    case Instructions::i32_shrs.value():
+    case Instructions::i64_shrs.value():
+        m_assembler.shift_by_cl(width, ShiftKind::ArithmeticRight, Reg::RAX);
+        break;
+    case Instructions::i32_shru.value():
+    case Instructions::i64_shru.value():
+        m_assembler.shift_by_cl(width, ShiftKind::LogicalRight, Reg::RAX);
+        break;
+    case Instructions::i32_rotl.value():
+    case Instructions::i64_rotl.value():
+        m_assembler.shift_by_cl(width, ShiftKind::RotateLeft, Reg::RAX);
+        break;
+    case Instructions::i32_rotr.value():
+    case Instructions::i64_rotr.value():
+        m_assembler.shift_by_cl(width, ShiftKind::RotateRight, Reg::RAX);
+        break;
+    default:
+        VERIFY_NOT_REACHED();
+    }
+
+    store_slot(m_stack_height - 2, Reg::RAX);
+    --m_stack_height;
+}
+
+void BaselineCompiler::emit_comparison(Width width, Condition condition)
+{
+    load_slot(Reg::RAX, m_stack_height - 2);
+    load_slot(Reg::RCX, m_stack_height - 1);
+    m_assembler.cmp(width, Reg::RAX, Reg::RCX);
+    m_assembler.set_if(condition, Reg::RAX);
+    store_slot(m_stack_height - 2, Reg::RAX);
+    --m_stack_height;
+}
+
+void BaselineCompiler::emit_division(Width width, bool is_signed, bool is_remainder)
+{
+    load_slot(Reg::RAX, m_stack_height - 2);
+    load_slot(Reg::RCX, m_stack_height - 1);
+
+    m_assembler.test(width, Reg::RCX, Reg::RCX);
+    emit_trap_if(Condition::Equal, ExitStatus::IntegerDivisionOverflow);
+
+    Optional<Assembler::Jump> done;
+    if (is_signed) {
+        // INT_MIN / -1 overflows (and faults on x86), INT_MIN % -1 is defined to be 0.
+        m_assembler.cmp(width, Reg::RCX, -1);
+        auto not_minus_one = m_assembler.jump_if(Condition::NotEqual);
+        if (is_remainder) {
+            m_assembler.mov32(Reg::RAX, 0u);
+            done = m_assembler.jump();
+        } else if (width == Width::Bits32) {
+            m_assembler.cmp(width, Reg::RAX, NumericLimits<i32>::min());
+            emit_trap_if(Condition::Equal, ExitStatus::IntegerDivisionOverflow);
+        } else {
+            m_assembler.mov64(Reg::RDX, bit_cast<u64>(NumericLimits<i64>::min()));
+            m_assembler.cmp(width, Reg::RAX, Reg::RDX);
+            emit_trap_if(Condition::Equal, ExitStatus::IntegerDivisionOverflow);
+        }
+        m_assembler.link_to_here(not_minus_one);
+        m_assembler.sign_extend_into_rdx(width);
+    } else {
+        m_assembler.mov32(Reg::RDX, 0u);
+    }
+
+    m_assembler.divide(width, Reg::RCX, is_signed);
+    if (is_remainder)
+        m_assembler.mov64(Reg::RAX, Reg::RDX);
+    if (done.has_value())
+        m_assembler.link_to_here(*done);
+
+    store_slot(m_stack_height - 2, Reg::RAX);
+    --m_stack_height;
+}
+
+bool BaselineCompiler::emit_effective_address(Instruction::MemoryArgument const& argument, size_t access_size, size_t address_slot)
+{
+    if (!m_has_memory || argument.memory_index.value() != 0 || argument.offset > NumericLimits<u32>::max())
+        return false;
+
+    // The address is a u32, and so is the offset, so their sum can't overflow 64 bits.
+    load_slot(Reg::RAX, address_slot);
+    m_assembler.mov32(Reg::RAX, Reg::RAX);
+    if (argument.offset != 0) {
+        m_assembler.mov64(Reg::RCX, argument.offset);
+        m_assembler.add(Width::Bits64, Reg::RAX, Reg::RCX);
+    }
+
+    if (m_has_guarded_memory) {
+        // OPTIMIZATION: Anything this can address past the end of the memory is in its guard region, so an out of
+        //               bounds access faults, and the fault handler resumes at the memory fault stub.
+        m_needs_memory_fault_stub = true;
+    } else {
+        m_assembler.mov64(Reg::RCX, Reg::RAX);
+        m_assembler.add(Width::Bits64, Reg::RCX, static_cast<i32>(access_size));
+        m_assembler.cmp(Width::Bits64, Reg::RCX, MEMORY_SIZE);
+        emit_trap_if(Condition::Above, ExitStatus::MemoryAccessOutOfBounds);
+    }
+
+    m_assembler.add(Width::Bits64, Reg::RAX, MEMORY_BASE);
+    return true;
+}
+
+bool BaselineCompiler::emit_load(Instruction const& instruction, size_t size, bool sign_extend)
+{
+    auto const& argument = instruction.arguments().get<Instruction::MemoryArgument>();
+    if (!emit_effective_address(argument, size, m_stack_height - 1))
+        return false;
+
+    m_assembler.load_extended(Reg::RAX, Reg::RAX, 0, size, sign_extend);
+    store_slot(m_stack_height - 1, Reg::RAX);
+    return true;
+}
+
+bool BaselineCompiler::emit_store(Instruction const& instruction, size_t size)
+{
+    auto const& argument = instruction.arguments().get<Instruction::MemoryArgument>();
+    if (!emit_effective_address(argument, size, m_stack_height - 2))
+        return false;
+
+    load_slot(Reg::RCX, m_stack_height - 1);
+    m_assembler.store_truncated(Reg::RAX, 0, Reg::RCX, size);
+    m_stack_height -= 2;
+    return true;
+}
+
+bool BaselineCompiler::compile_instruction(Instruction const& instruction)
+{
+    auto opcode = instruction.opcode();
+
+    if (m_is_unreachable) {
+        switch (opcode.value()) {
+        case Instructions::block.value():
+        case Instructions::loop.value():
+        case Instructions::if_.value():
+            ++m_unreachable_block_depth;
+            return true;
+        case Instructions::structured_else.value():
+        case Instructions::structured_end.value():
+            if (m_unreachable_block_depth > 0) {
+                if (opcode == Instructions::structured_end)
+                    --m_unreachable_block_depth;
+                return true;
+            }
+            break;
+        case Instructions::synthetic_end_expression.value():
+            break;
+        default:
+            return true;
+        }
+    }
+
+    switch (opcode.value()) {
+    case Instructions::unreachable.value():
+        m_pending_traps.append({ m_assembler.jump(), ExitStatus::Unreachable });
+        m_is_unreachable = true;
+        return true;
+    case Instructions::nop.value():
+        return true;
+
+    case Instructions::block.value():
+        return enter_block(ControlFrame::Kind::Block, instruction.arguments().get<Instruction::StructuredInstructionArgs>().block_type);
+    case Instructions::loop.value():
+        return enter_block(ControlFrame::Kind::Loop, instruction.arguments().get<Instruction::StructuredInstructionArgs>().block_type);
+    case Instructions::if_.value(): {
+        load_slot(Reg::RAX, --m_stack_height);
+        m_assembler.test(Width::Bits32, Reg::RAX, Reg::RAX);
+        auto jump_to_else = m_assembler.jump_if(Condition::Equal);
+        if (!enter_block(ControlFrame::Kind::If, instruction.arguments().get<Instruction::StructuredInstructionArgs>().block_type))
+            return false;
+        m_control_stack.last().jump_to_else = jump_to_else;
+        return true;
+    }
+    case Instructions::structured_else.value(): {
+        if (m_control_stack.size() < 2)
+            return false;
+        auto& frame = m_control_stack.last();
+        if (!m_is_unreachable)
+            frame.branches_to_end.append(m_assembler.jump());
+        if (frame.jump_to_else.has_value())
+            m_assembler.link_to_here(*frame.jump_to_else);
+        frame.jump_to_else.clear();
+        m_stack_height = frame.stack_height;
+        m_is_unreachable = false;
+        return true;
+    }
+    case Instructions::structured_end.value(): {
+        if (m_control_stack.size() < 2)
+            return false;
+        auto frame = m_control_stack.take_last();
+        if (frame.jump_to_else.has_value())
+            m_assembler.link_to_here(*frame.jump_to_else);
+        for (auto& jump : frame.branches_to_end)
+            m_assembler.link_to_here(jump);
+        m_stack_height = frame.stack_height + frame.arity;
+        m_is_unreachable = false;
+        return true;
+    }
+    case Instructions::synthetic_end_expression.value():
+        return compile_function_end();
+
+    case Instructions::br.value():
+        m_is_unreachable = true;
+        return emit_branch_to_label(instruction.arguments().get<LabelIndex>());
+    case Instructions::br_if.value():
+        load_slot(Reg::RDX, --m_stack_height);
+        return emit_branch_to_label_if_nonzero(instruction.arguments().get<LabelIndex>(), Reg::RDX);
+    case Instructions::br_table.value(): {
+        // NOTE: A chain of compares is good enough for a baseline tier. RDX holds the index, branches only clobber RAX.
+        auto const& arguments = instruction.arguments().get<Instruction::TableBranchArgs>();
+        load_slot(Reg::RDX, --m_stack_height);
+        for (size_t i = 0; i < arguments.labels.size(); ++i) {
+            if (i > static_cast<size_t>(NumericLimits<i32>::max()))
+                return false;
+            m_assembler.cmp(Width::Bits32, Reg::RDX, static_cast<i32>(i));
+            auto next = m_assembler.jump_if(Condition::NotEqual);
+            if (!emit_branch_to_label(arguments.labels[i]))
+                return false;
+            m_assembler.link_to_here(next);
+        }
+        m_is_unreachable = true;
+        return emit_branch_to_label(arguments.default_);
+    }
+    case Instructions::return_.value():
+        m_is_unreachable = true;
+        emit_branch(m_control_stack.first());
+        return true;
+
+    case Instructions::drop.value():
+        --m_stack_height;
+        return true;
+    case Instructions::select_typed.value():
+        for (auto const& type : instruction.arguments().get<Vector<ValueType>>()) {
+            if (!is_supported_value_type(type))
+                return false;
+        }
+        [[fallthrough]];
+    case Instructions::select.value():
+        load_slot(Reg::RAX, m_stack_height - 3);
+        load_slot(Reg::RCX, m_stack_height - 2);
+        load_slot(Reg::RDX, m_stack_height - 1);
+        m_assembler.test(Width::Bits32, Reg::RDX, Reg::RDX);
+        m_assembler.move_if(Condition::Equal, Reg::RAX, Reg::RCX);
+        store_slot(m_stack_height - 3, Reg::RAX);
+        m_stack_height -= 2;
+        return true;
+
+    case Instructions::local_get.value():
+        load_local(Reg::RAX, instruction.local_index());
+        store_slot(m_stack_height++, Reg::RAX);
+        return true;
+    case Instructions::local_set.value():
+        load_slot(Reg::RAX, --m_stack_height);
+        store_local(instruction.local_index(), Reg::RAX);
+        return true;
+    case Instructions::local_tee.value():
+        load_slot(Reg::RAX, m_stack_height - 1);
+        store_local(instruction.local_index(), Reg::RAX);
+        return true;
+
+    case Instructions::i32_const.value():
+        m_assembler.mov32(Reg::RAX, bit_cast<u32>(instruction.arguments().get<i32>()));
+        store_slot(m_stack_height++, Reg::RAX);
+        return true;
+    case Instructions::i64_const.value():
+        m_assembler.mov64(Reg::RAX, bit_cast<u64>(instruction.arguments().get<i64>()));
+        store_slot(m_stack_height++, Reg::RAX);
+        return true;
+    case Instructions::f32_const.value():
+        m_assembler.mov32(Reg::RAX, bit_cast<u32>(instruction.arguments().get<float>()));
+        store_slot(m_stack_height++, Reg::RAX);
+        return true;
+    case Instructions::f64_const.value():
+        m_assembler.mov64(Reg::RAX, bit_cast<u64>(instruction.arguments().get<double>()));
+        store_slot(m_stack_height++, Reg::RAX);
+        return true;
+
+    case Instructions::i32_eqz.value():
+    case Instructions::i64_eqz.value():
+        load_slot(Reg::RAX, m_stack_height - 1);
+        m_assembler.test(opcode == Instructions::i32_eqz ? Width::Bits32 : Width::Bits64, Reg::RAX, Reg::RAX);
+        m_assembler.set_if(Condition::Equal, Reg::RAX);
+        store_slot(m_stack_height - 1, Reg::RAX);
+        return true;
+
+#define CASE_COMPARISON(name, condition)                                   \
+    case Instructions::i32_##name.value():                                 \
+        emit_comparison(Width::Bits32, Condition::condition);              \
+        return true;                                                       \
+    case Instructions::i64_##name.value():                                 \
+        emit_comparison(Width::Bits64, Condition::condition);              \
+        return true;
+        CASE_COMPARISON(eq, Equal)
+        CASE_COMPARISON(ne, NotEqual)
+        CASE_COMPARISON(lts, LessThan)
+        CASE_COMPARISON(ltu, Below)
+        CASE_COMPARISON(gts, GreaterThan)
+        CASE_COMPARISON(gtu, Above)
+        CASE_COMPARISON(les, LessThanOrEqual)
+        CASE_COMPARISON(leu, BelowOrEqual)
+        CASE_COMPARISON(ges, GreaterThanOrEqual)
+        CASE_COMPARISON(geu, AboveOrEqual)
+#undef CASE_COMPARISON
+
+#define CASE_BINARY(name)                               \
+    case Instructions::i32_##name.value():              \
+        emit_binary(Width::Bits32, opcode);             \
+        return true;                                    \
+    case Instructions::i64_##name.value():              \
+        emit_binary(Width::Bits64, opcode);             \
+        return true;
+        CASE_BINARY(add)
+        CASE_BINARY(sub)
+        CASE_BINARY(mul)
+        CASE_BINARY(and)
+        CASE_BINARY(or)
+        CASE_BINARY(xor)
+        CASE_BINARY(shl)
+        CASE_BINARY(shrs)
+        CASE_BINARY(shru)
+        CASE_BINARY(rotl)
+        CASE_BINARY(rotr)
+#undef CASE_BINARY
+
+#define CASE_DIVISION(name, is_signed, is_remainder)                   \
+    case Instructions::i32_##name.value():                             \
+        emit_division(Width::Bits32, is_signed, is_remainder);         \
+        return true;                                                   \
+    case Instructions::i64_##name.value():                             \
+        emit_division(Width::Bits64, is_signed, is_remainder);         \
+        return true;
+        CASE_DIVISION(divs, true, false)
+        CASE_DIVISION(divu, false, false)
+        CASE_DIVISION(rems, true, true)
+        CASE_DIVISION(remu, false, true)
+#undef CASE_DIVISION
+
+    // NOTE: An i32 only ever looks at the low half of its slot, so wrapping and reinterpreting bits are no-ops.
+    case Instructions::i32_wrap_i64.value():
+    case Instructions::i32_reinterpret_f32.value():
+    case Instructions::i64_reinterpret_f64.value():
+    case Instructions::f32_reinterpret_i32.value():
+    case Instructions::f64_reinterpret_i64.value():
+        return true;
+    case Instructions::i64_extend_ui32.value():
+        load_slot(Reg::RAX, m_stack_height - 1);
+        m_assembler.mov32(Reg::RAX, Reg::RAX);
+        store_slot(m_stack_height - 1, Reg::RAX);
+        return true;
+    case Instructions::i64_extend_si32.value():
+    case Instructions::i64_extend32_s.value():
+    case Instructions::i32_extend8_s.value():
+    case Instructions::i32_extend16_s.value():
+    case Instructions::i64_extend8_s.value():
+    case Instructions::i64_extend16_s.value(): {
+        size_t from_size = 4;
+        if (opcode == Instructions::i32_extend8_s || opcode == Instructions::i64_extend8_s)
+            from_size = 1;
+        else if (opcode == Instructions::i32_extend16_s || opcode == Instructions::i64_extend16_s)
+            from_size = 2;
+        load_slot(Reg::RAX, m_stack_height - 1);
+        m_assembler.sign_extend64(Reg::RAX, Reg::RAX, from_size);
+        store_slot(m_stack_height - 1, Reg::RAX);
+        return true;
+    }
+
+    case Instructions::i32_load.value():
+    case Instructions::f32_load.value():
+    case Instructions::i64_load32_u.value():
+        return emit_load(instruction, 4, false);
+    case Instructions::i64_load.value():
+    case Instructions::f64_load.value():
+        return emit_load(instruction, 8, false);
+    case Instructions::i32_load8_s.value():
+    case Instructions::i64_load8_s.value():
+        return emit_load(instruction, 1, true);
+    case Instructions::i32_load8_u.value():
+    case Instructions::i64_load8_u.value():
+        return emit_load(instruction, 1, false);
+    case Instructions::i32_load16_s.value():
+    case Instructions::i64_load16_s.value():
+        return emit_load(instruction, 2, true);
+    case Instructions::i32_load16_u.value():
+    case Instructions::i64_load16_u.value():
+        return emit_load(instruction, 2, false);
+    case Instructions::i64_load32_s.value():
+        return emit_load(instruction, 4, true);
+    case Instructions::i32_store.value():
+    case Instructions::f32_store.value():
+    case Instructions::i64_store32.value():
+        return emit_store(instruction, 4);
+    case Instructions::i64_store.value():
+    case Instructions::f64_store.value():
+        return emit_store(instruction, 8);
+    case Instructions::i32_store8.value():
+    case Instructions::i64_store8.value():
+        return emit_store(instruction, 1);
+    case Instructions::i32_store16.value():
+    case Instructions::i64_store16.value():
+        return emit_store(instruction, 2);
+    case Instructions::memory_size.value():
+        if (!m_has_memory || instruction.arguments().get<Instruction::MemoryIndexArgument>().memory_index.value() != 0)
+            return false;
+        m_assembler.mov64(Reg::RAX, MEMORY_SIZE);
+        m_assembler.shift_right64(Reg::RAX, 16);
+        static_assert(Constants::page_size == 64 * KiB);
+        store_slot(m_stack_height++, Reg::RAX);
+        return true;
+
+    default:
+        dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Baseline compiler does not support {}", instruction_name(opcode));
+        return false;
+    }
+}
+
+bool BaselineCompiler::compile_function_end()
+{
+    if (m_control_stack.size() != 1 || m_unreachable_block_depth != 0)
+        return false;
+
+    auto& frame = m_control_stack.first();
+    for (auto& jump : frame.branches_to_end)
+        m_assembler.link_to_here(jump);
+    frame.branches_to_end.clear();
+
+    if (frame.arity == 1) {
+        load_slot(Reg::RAX, 0);
+        m_assembler.store64(RESULT_POINTER, 0, Reg::RAX);
+    }
+    m_assembler.mov32(Reg::RAX, to_underlying(ExitStatus::Returned));
+    emit_epilogue();
+
+    for (auto& trap : m_pending_traps) {
+        m_assembler.link_to_here(trap.jump);
+        m_assembler.mov32(Reg::RAX, to_underlying(trap.status));
+        m_assembler.link(m_assembler.jump(), m_epilogue_offset);
+    }
+    m_pending_traps.clear();
+
+    if (m_needs_memory_fault_stub) {
+        m_memory_fault_stub_offset = m_assembler.current_offset();
+        m_assembler.mov32(Reg::RAX, to_underlying(ExitStatus::MemoryAccessOutOfBounds));
+        m_assembler.link(m_assembler.jump(), m_epilogue_offset);
+    }
+    return true;
+}
+
+RefPtr<NativeFunction> BaselineCompiler::compile(WasmFunction const& function, MemoryInstance const* memory)
+{
+#if ARCH(X86_64) && !defined(AK_OS_WINDOWS)
+    auto const& type = function.type();
+    auto const& code = function.code().func();
+
+    if (type.results().size() > 1)
+        return nullptr;
+    for (auto const& result : type.results()) {
+        if (!is_supported_value_type(result))
+            return nullptr;
+    }
+
+    size_t local_count = type.parameters().size();
+    for (auto const& parameter : type.parameters()) {
+        if (!is_supported_value_type(parameter))
+            return nullptr;
+    }
+    for (auto const& locals : code.locals()) {
+        if (!is_supported_value_type(locals.type()))
+            return nullptr;
+        local_count += locals.n();
+        if (local_count > max_local_count)
+            return nullptr;
+    }
+
+    // NOTE: The validator records how deep the operand stack gets, which is exactly how many slots the native frame needs.
+    auto stack_usage = code.body().stack_usage_hint();
+    if (!stack_usage.has_value() || *stack_usage > max_stack_height)
+        return nullptr;
+
+    // NOTE: memory64 addresses would need 64-bit bounds checks, leave those to the interpreter for now.
+    bool has_memory = memory && memory->type().limits().address_type() == AddressType::I32;
+
+    // NOTE: The guard region only covers addresses that are a u32 plus a u32 offset, which is all we compile.
+    bool has_guarded_memory = has_memory && memory->has_guard_region() && NativeFunction::ensure_memory_fault_handler();
+
+    BaselineCompiler compiler { *stack_usage, has_memory, has_guarded_memory };
+    compiler.emit_prologue(round_up_to_power_of_two(*stack_usage * sizeof(u64), 16));
+    compiler.m_control_stack.append({ .kind = ControlFrame::Kind::Block, .stack_height = 0, .arity = type.results().size() });
+
+    for (auto const& instruction : code.body().instructions()) {
+        if (!compiler.compile_instruction(instruction))
+            return nullptr;
+        if (compiler.m_stack_height > compiler.m_max_stack_height)
+            return nullptr;
+    }
+
+    // NOTE: The epilogue is only emitted once the end of the body has been compiled.
+    if (compiler.m_epilogue_offset == 0)
+        return nullptr;
+
+    auto native_function = NativeFunction::create(compiler.m_output.span(), local_count, compiler.m_memory_fault_stub_offset);
+    dbgln_if(WASM_TRACE_DEBUG, "LibWasm: Compiled function with {} instructions to {} bytes of native code", code.body().instructions().size(), compiler.m_output.size());
+    return native_function;
+#else
+    (void)function;
+    (void)memory;
+    return nullptr;
+#endif
+}
+
+}
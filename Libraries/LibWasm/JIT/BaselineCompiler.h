@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Optional.h>
+#include <AK/RefPtr.h>
+#include <AK/Vector.h>
+#include <LibJIT/Assembler.h>
+#include <LibWasm/JIT/NativeFunction.h>
+#include <LibWasm/Types.h>
+
+namespace Wasm {
+
+class MemoryInstance;
+class WasmFunction;
+
+}
+
+namespace Wasm::JIT {
+
+using ::JIT::Assembler;
+
+// Single-pass baseline compiler from a validated Wasm function body to x86-64 machine code.
+//
+// The compiler relies on validation having succeeded: operand types are taken from the opcodes, and the
+// native frame is sized from the operand stack depth the Validator recorded for the function body. Every
+// operand stack slot lives at a fixed offset in the native frame, and each instruction loads its operands
+// from there and stores its result back, which keeps the compiler a straightforward walk over the
+// instructions with no register allocation.
+//
+// Only functions that stick to integer arithmetic, locals, structured control flow and memory 0 loads and
+// stores are compiled; anything else (calls, globals, tables, floating point arithmetic, SIMD, memory.grow,
+// multi-value blocks...) makes the whole function stay in the interpreter.
+class BaselineCompiler {
+public:
+    static RefPtr<NativeFunction> compile(WasmFunction const&, MemoryInstance const* memory);
+
+private:
+    using Reg = Assembler::Reg;
+    using Width = Assembler::Width;
+
+    BaselineCompiler(size_t max_stack_height, bool has_memory, bool has_guarded_memory)
+        : m_assembler(m_output)
+        , m_max_stack_height(max_stack_height)
+        , m_has_memory(has_memory)
+        , m_has_guarded_memory(has_guarded_memory)
+    {
+    }
+
+    struct ControlFrame {
+        enum class Kind {
+            Block,
+            Loop,
+            If,
+        };
+
+        Kind kind { Kind::Block };
+        size_t stack_height { 0 };
+        size_t arity { 0 };
+        size_t loop_start_offset { 0 };
+        Vector<Assembler::Jump> branches_to_end;
+        Optional<Assembler::Jump> jump_to_else;
+    };
+
+    struct PendingTrap {
+        Assembler::Jump jump;
+        NativeFunction::ExitStatus status;
+    };
+
+    bool compile_instruction(Instruction const&);
+    bool compile_function_end();
+
+    void emit_prologue(size_t frame_size);
+    void emit_epilogue();
+    void emit_trap_if(Assembler::Condition, NativeFunction::ExitStatus);
+
+    void load_slot(Reg, size_t slot);
+    void store_slot(size_t slot, Reg);
+    void load_local(Reg, LocalIndex);
+    void store_local(LocalIndex, Reg);
+
+    bool enter_block(ControlFrame::Kind, BlockType const&);
+    ControlFrame* frame_for_label(LabelIndex);
+    bool branch_needs_moves(ControlFrame const&) const;
+    void emit_branch(ControlFrame&);
+    bool emit_branch_to_label(LabelIndex);
+    bool emit_branch_to_label_if_nonzero(LabelIndex, Reg condition);
+
+    void emit_binary(Width, OpCode);
+    void emit_comparison(Width, Assembler::Condition);
+    void emit_division(Width, bool is_signed, bool is_remainder);
+    bool emit_effective_address(Instruction::MemoryArgument const&, size_t access_size, size_t address_slot);
+    bool emit_load(Instruction const&, size_t size, bool sign_extend);
+    bool emit_store(Instruction const&, size_t size);
+
+    Vector<u8> m_output;
+    Assembler m_assembler;
+
+    Vector<ControlFrame, 16> m_control_stack;
+    Vector<PendingTrap> m_pending_traps;
+    size_t m_epilogue_offset { 0 };
+
+    size_t m_stack_height { 0 };
+    size_t m_max_stack_height { 0 };
+    bool m_has_memory { false };
+
+    // Accesses to a memory with a guard region aren't bounds checked; they fault instead, and resume at a stub.
+    bool m_has_guarded_memory { false };
+    bool m_needs_memory_fault_stub { false };
+    Optional<size_t> m_memory_fault_stub_offset;
+
+    // After an unconditional branch, code up to the end of the enclosing block is dead, and is skipped.
+    bool m_is_unreachable { false };
+    size_t m_unreachable_block_depth { 0 };
+};
+
+}
@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Array.h>
+#include <AK/Format.h>
+#include <AK/Platform.h>
+#include <LibWasm/AbstractMachine/MemoryReservation.h>
+#include <LibWasm/JIT/NativeFunction.h>
+
+#if !defined(AK_OS_WINDOWS)
+#    include <sys/mman.h>
+#endif
+
+#if ARCH(X86_64) && (defined(AK_OS_LINUX) || defined(AK_OS_MACOS) || defined(AK_OS_FREEBSD))
+#    define HAS_MEMORY_FAULT_HANDLER
+#    include <signal.h>
+#    include <sys/ucontext.h>
+#endif
+
+namespace Wasm::JIT {
+
+using Entry = u32 (*)(Value* locals, u8* memory_base, u64 memory_size, u64* result);
+
+#if defined(HAS_MEMORY_FAULT_HANDLER)
+// The native function running on this thread, for the fault handler to tell its faults apart from anything else's.
+// Native functions never call back into the runtime, so there is at most one of them per thread.
+struct ActiveCall {
+    FlatPtr code_start { 0 };
+    FlatPtr code_end { 0 };
+    FlatPtr memory_fault_stub { 0 };
+    FlatPtr guard_start { 0 };
+    FlatPtr guard_end { 0 };
+};
+
+// NOTE: The fault handler reads this, which has to be a plain load off the thread pointer, as calling into the dynamic
+//       loader to find a thread's storage isn't async-signal-safe. With the default (dynamic) TLS models for code in
+//       a shared library that's not guaranteed, so ask for initial-exec on ELF. On macOS the storage is set up by
+//       run() writing to it before any native code can fault.
+#    if defined(AK_OS_MACOS)
+static thread_local ActiveCall t_active_call;
+#    else
+[[gnu::tls_model("initial-exec")]] static thread_local ActiveCall t_active_call;
+#    endif
+
+// Depending on the platform, an access to an inaccessible page raises either of these.
+static constexpr Array memory_fault_signals { SIGSEGV, SIGBUS };
+static struct sigaction s_previous_actions[memory_fault_signals.size()];
+
+static FlatPtr& program_counter(void* context)
+{
+    auto& ucontext = *static_cast<ucontext_t*>(context);
+#    if defined(AK_OS_LINUX)
+    return reinterpret_cast<FlatPtr&>(ucontext.uc_mcontext.gregs[REG_RIP]);
+#    elif defined(AK_OS_MACOS)
+    return reinterpret_cast<FlatPtr&>(ucontext.uc_mcontext->__ss.__rip);
+#    elif defined(AK_OS_FREEBSD)
+    return reinterpret_cast<FlatPtr&>(ucontext.uc_mcontext.mc_rip);
+#    endif
+}
+
+static void handle_memory_fault(int signal_number, siginfo_t* info, void* context)
+{
+    auto const& call = t_active_call;
+    auto fault_address = bit_cast<FlatPtr>(info->si_addr);
+    auto& pc = program_counter(context);
+    if (call.memory_fault_stub != 0 && pc >= call.code_start && pc < call.code_end && fault_address >= call.guard_start && fault_address < call.guard_end) {
+        // NOTE: The stub leaves through the epilogue, which restores the stack pointer from the frame pointer,
+        //       so it doesn't matter how far into the function we were.
+        pc = call.memory_fault_stub;
+        return;
+    }
+
+    // Not one of ours, so hand it to whoever was handling it before us.
+    for (size_t i = 0; i < memory_fault_signals.size(); ++i) {
+        if (memory_fault_signals[i] != signal_number)
+            continue;
+        auto const& previous = s_previous_actions[i];
+        if (previous.sa_flags & SA_SIGINFO) {
+            previous.sa_sigaction(signal_number, info, context);
+        } else if (previous.sa_handler == SIG_DFL || previous.sa_handler == SIG_IGN) {
+            // Returning re-executes the faulting instruction, which then gets the default treatment.
+            ::signal(signal_number, SIG_DFL);
+        } else {
+            previous.sa_handler(signal_number);
+        }
+        return;
+    }
+}
+#endif
+
+bool NativeFunction::ensure_memory_fault_handler()
+{
+#if defined(HAS_MEMORY_FAULT_HANDLER)
+    static bool const is_installed = [] {
+        struct sigaction action {};
+        action.sa_sigaction = handle_memory_fault;
+        action.sa_flags = SA_SIGINFO | SA_ONSTACK;
+        sigemptyset(&action.sa_mask);
+        for (size_t i = 0; i < memory_fault_signals.size(); ++i) {
+            if (sigaction(memory_fault_signals[i], &action, &s_previous_actions[i]) < 0) {
+                perror("sigaction");
+                return false;
+            }
+        }
+        return true;
+    }();
+    return is_installed;
+#else
+    return false;
+#endif
+}
+
+RefPtr<NativeFunction> NativeFunction::create(ReadonlyBytes code, size_t local_count, Optional<size_t> memory_fault_stub_offset)
+{
+#if defined(AK_OS_WINDOWS)
+    // FIXME: Use VirtualAlloc() and VirtualProtect() once the baseline compiler supports the Windows calling convention.
+    (void)code;
+    (void)local_count;
+    (void)memory_fault_stub_offset;
+    return nullptr;
+#else
+    if (code.is_empty())
+        return nullptr;
+
+    auto* memory = mmap(nullptr, code.size(), PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+    if (memory == MAP_FAILED) {
+        dbgln("LibWasm: Failed to allocate {} bytes for native code", code.size());
+        return nullptr;
+    }
+
+    memcpy(memory, code.data(), code.size());
+
+    // NOTE: We never keep native code writable and executable at the same time.
+    if (mprotect(memory, code.size(), PROT_READ | PROT_EXEC) < 0) {
+        perror("mprotect");
+        munmap(memory, code.size());
+        return nullptr;
+    }
+
+    return adopt_ref(*new NativeFunction(memory, code.size(), local_count, memory_fault_stub_offset));
+#endif
+}
+
+NativeFunction::NativeFunction(void* code, size_t size, size_t local_count, Optional<size_t> memory_fault_stub_offset)
+    : m_code(code)
+    , m_size(size)
+    , m_local_count(local_count)
+    , m_memory_fault_stub_offset(memory_fault_stub_offset)
+{
+}
+
+NativeFunction::~NativeFunction()
+{
+#if !defined(AK_OS_WINDOWS)
+    if (munmap(m_code, m_size) < 0) {
+        perror("munmap");
+        VERIFY_NOT_REACHED();
+    }
+#endif
+}
+
+NativeFunction::ExitStatus NativeFunction::run(Value* locals, u8* memory_base, u64 memory_size, u64* result) const
+{
+    auto entry = reinterpret_cast<Entry>(m_code);
+#if defined(HAS_MEMORY_FAULT_HANDLER)
+    if (m_memory_fault_stub_offset.has_value()) {
+        auto code = bit_cast<FlatPtr>(m_code);
+        auto memory = bit_cast<FlatPtr>(memory_base);
+        t_active_call = {
+            .code_start = code,
+            .code_end = code + m_size,
+            .memory_fault_stub = code + *m_memory_fault_stub_offset,
+            .guard_start = memory,
+            .guard_end = memory + MemoryReservation::guarded_size,
+        };
+        auto status = entry(locals, memory_base, memory_size, result);
+        t_active_call = {};
+        return static_cast<ExitStatus>(status);
+    }
+#else
+    VERIFY(!m_memory_fault_stub_offset.has_value());
+#endif
+    return static_cast<ExitStatus>(entry(locals, memory_base, memory_size, result));
+}
+
+}
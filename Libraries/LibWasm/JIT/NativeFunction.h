@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/Noncopyable.h>
+#include <AK/Optional.h>
+#include <AK/RefCounted.h>
+#include <AK/RefPtr.h>
+#include <AK/Span.h>
+#include <AK/Types.h>
+
+namespace Wasm {
+
+class Value;
+
+}
+
+namespace Wasm::JIT {
+
+// Machine code produced by the baseline compiler for a single Wasm function.
+// Native functions never call back into the runtime; they run to completion and
+// report how they finished, leaving it to the caller to turn traps into Trap values.
+class NativeFunction : public RefCounted<NativeFunction> {
+    AK_MAKE_NONCOPYABLE(NativeFunction);
+    AK_MAKE_NONMOVABLE(NativeFunction);
+
+public:
+    enum class ExitStatus : u32 {
+        Returned = 0,
+        MemoryAccessOutOfBounds,
+        IntegerDivisionOverflow,
+        Unreachable,
+    };
+
+    // Code that leaves out the bounds checks of its memory accesses passes the offset of a stub that exits
+    // with MemoryAccessOutOfBounds. A fault in the guard region of the memory resumes execution there.
+    static RefPtr<NativeFunction> create(ReadonlyBytes code, size_t local_count, Optional<size_t> memory_fault_stub_offset);
+    ~NativeFunction();
+
+    // Installs the handler that turns faults in a memory's guard region into traps, if this platform has one.
+    // Until this has returned true, native code has to bounds check every memory access itself.
+    static bool ensure_memory_fault_handler();
+
+    // `locals` must hold local_count() values, starting with the arguments. Memory 0 is passed
+    // as a base pointer and size, since native code cannot grow memory, so neither can change under it.
+    // If the function returns a value, its raw bits are written to `result`.
+    [[nodiscard]] ExitStatus run(Value* locals, u8* memory_base, u64 memory_size, u64* result) const;
+
+    [[nodiscard]] size_t local_count() const { return m_local_count; }
+    [[nodiscard]] size_t code_size() const { return m_size; }
+
+private:
+    NativeFunction(void* code, size_t size, size_t local_count, Optional<size_t> memory_fault_stub_offset);
+
+    void* m_code { nullptr };
+    size_t m_size { 0 };
+    size_t m_local_count { 0 };
+    Optional<size_t> m_memory_fault_stub_offset;
+};
+
+}
@@ -481,25 +481,92 @@ namespace Instructions {
     M(i16x8_relaxed_q15mulr_s, 0xfd00000000000111, 2, 1)             \
     M(i16x8_relaxed_dot_i8x16_i7x16_s, 0xfd00000000000112, 2, 1)     \
     M(i32x4_relaxed_dot_i8x16_i7x16_add_s, 0xfd00000000000113, 3, 1) \
+    M(memory_atomic_notify, 0xfe00000000000000ull, 2, 1)             \
+    M(memory_atomic_wait32, 0xfe00000000000001ull, 3, 1)             \
+    M(memory_atomic_wait64, 0xfe00000000000002ull, 3, 1)             \
+    M(atomic_fence, 0xfe00000000000003ull, 0, 0)                     \
+    M(i32_atomic_load, 0xfe00000000000010ull, 1, 1)                  \
+    M(i64_atomic_load, 0xfe00000000000011ull, 1, 1)                  \
+    M(i32_atomic_load8_u, 0xfe00000000000012ull, 1, 1)               \
+    M(i32_atomic_load16_u, 0xfe00000000000013ull, 1, 1)              \
+    M(i64_atomic_load8_u, 0xfe00000000000014ull, 1, 1)               \
+    M(i64_atomic_load16_u, 0xfe00000000000015ull, 1, 1)              \
+    M(i64_atomic_load32_u, 0xfe00000000000016ull, 1, 1)              \
+    M(i32_atomic_store, 0xfe00000000000017ull, 2, 0)                 \
+    M(i64_atomic_store, 0xfe00000000000018ull, 2, 0)                 \
+    M(i32_atomic_store8, 0xfe00000000000019ull, 2, 0)                \
+    M(i32_atomic_store16, 0xfe0000000000001aull, 2, 0)               \
+    M(i64_atomic_store8, 0xfe0000000000001bull, 2, 0)                \
+    M(i64_atomic_store16, 0xfe0000000000001cull, 2, 0)               \
+    M(i64_atomic_store32, 0xfe0000000000001dull, 2, 0)               \
+    M(i32_atomic_rmw_add, 0xfe0000000000001eull, 2, 1)               \
+    M(i64_atomic_rmw_add, 0xfe0000000000001full, 2, 1)               \
+    M(i32_atomic_rmw8_add_u, 0xfe00000000000020ull, 2, 1)            \
+    M(i32_atomic_rmw16_add_u, 0xfe00000000000021ull, 2, 1)           \
+    M(i64_atomic_rmw8_add_u, 0xfe00000000000022ull, 2, 1)            \
+    M(i64_atomic_rmw16_add_u, 0xfe00000000000023ull, 2, 1)           \
+    M(i64_atomic_rmw32_add_u, 0xfe00000000000024ull, 2, 1)           \
+    M(i32_atomic_rmw_sub, 0xfe00000000000025ull, 2, 1)               \
+    M(i64_atomic_rmw_sub, 0xfe00000000000026ull, 2, 1)               \
+    M(i32_atomic_rmw8_sub_u, 0xfe00000000000027ull, 2, 1)            \
+    M(i32_atomic_rmw16_sub_u, 0xfe00000000000028ull, 2, 1)           \
+    M(i64_atomic_rmw8_sub_u, 0xfe00000000000029ull, 2, 1)            \
+    M(i64_atomic_rmw16_sub_u, 0xfe0000000000002aull, 2, 1)           \
+    M(i64_atomic_rmw32_sub_u, 0xfe0000000000002bull, 2, 1)           \
+    M(i32_atomic_rmw_and, 0xfe0000000000002cull, 2, 1)               \
+    M(i64_atomic_rmw_and, 0xfe0000000000002dull, 2, 1)               \
+    M(i32_atomic_rmw8_and_u, 0xfe0000000000002eull, 2, 1)            \
+    M(i32_atomic_rmw16_and_u, 0xfe0000000000002full, 2, 1)           \
+    M(i64_atomic_rmw8_and_u, 0xfe00000000000030ull, 2, 1)            \
+    M(i64_atomic_rmw16_and_u, 0xfe00000000000031ull, 2, 1)           \
+    M(i64_atomic_rmw32_and_u, 0xfe00000000000032ull, 2, 1)           \
+    M(i32_atomic_rmw_or, 0xfe00000000000033ull, 2, 1)                \
+    M(i64_atomic_rmw_or, 0xfe00000000000034ull, 2, 1)                \
+    M(i32_atomic_rmw8_or_u, 0xfe00000000000035ull, 2, 1)             \
+    M(i32_atomic_rmw16_or_u, 0xfe00000000000036ull, 2, 1)            \
+    M(i64_atomic_rmw8_or_u, 0xfe00000000000037ull, 2, 1)             \
+    M(i64_atomic_rmw16_or_u, 0xfe00000000000038ull, 2, 1)            \
+    M(i64_atomic_rmw32_or_u, 0xfe00000000000039ull, 2, 1)            \
+    M(i32_atomic_rmw_xor, 0xfe0000000000003aull, 2, 1)               \
+    M(i64_atomic_rmw_xor, 0xfe0000000000003bull, 2, 1)               \
+    M(i32_atomic_rmw8_xor_u, 0xfe0000000000003cull, 2, 1)            \
+    M(i32_atomic_rmw16_xor_u, 0xfe0000000000003dull, 2, 1)           \
+    M(i64_atomic_rmw8_xor_u, 0xfe0000000000003eull, 2, 1)            \
+    M(i64_atomic_rmw16_xor_u, 0xfe0000000000003full, 2, 1)           \
+    M(i64_atomic_rmw32_xor_u, 0xfe00000000000040ull, 2, 1)           \
+    M(i32_atomic_rmw_xchg, 0xfe00000000000041ull, 2, 1)              \
+    M(i64_atomic_rmw_xchg, 0xfe00000000000042ull, 2, 1)              \
+    M(i32_atomic_rmw8_xchg_u, 0xfe00000000000043ull, 2, 1)           \
+    M(i32_atomic_rmw16_xchg_u, 0xfe00000000000044ull, 2, 1)          \
+    M(i64_atomic_rmw8_xchg_u, 0xfe00000000000045ull, 2, 1)           \
+    M(i64_atomic_rmw16_xchg_u, 0xfe00000000000046ull, 2, 1)          \
+    M(i64_atomic_rmw32_xchg_u, 0xfe00000000000047ull, 2, 1)          \
+    M(i32_atomic_rmw_cmpxchg, 0xfe00000000000048ull, 3, 1)           \
+    M(i64_atomic_rmw_cmpxchg, 0xfe00000000000049ull, 3, 1)           \
+    M(i32_atomic_rmw8_cmpxchg_u, 0xfe0000000000004aull, 3, 1)        \
+    M(i32_atomic_rmw16_cmpxchg_u, 0xfe0000000000004bull, 3, 1)       \
+    M(i64_atomic_rmw8_cmpxchg_u, 0xfe0000000000004cull, 3, 1)        \
+    M(i64_atomic_rmw16_cmpxchg_u, 0xfe0000000000004dull, 3, 1)       \
+    M(i64_atomic_rmw32_cmpxchg_u, 0xfe0000000000004eull, 3, 1)       \
     /* Synthetic fused insns */                                      \
     ENUMERATE_SYNTHETIC_INSTRUCTION_OPCODES(M)
 
 #define ENUMERATE_SYNTHETIC_INSTRUCTION_OPCODES(M)               \
-    M(synthetic_i32_add2local, 0xfe00000000000000ull, 0, 1)      \
-    M(synthetic_i32_addconstlocal, 0xfe00000000000001ull, 0, 1)  \
-    M(synthetic_i32_andconstlocal, 0xfe00000000000002ull, 0, 1)  \
-    M(synthetic_i32_storelocal, 0xfe00000000000003ull, 1, 0)     \
-    M(synthetic_i64_storelocal, 0xfe00000000000004ull, 1, 0)     \
-    M(synthetic_local_seti32_const, 0xfe00000000000005ull, 0, 0) \
-    M(synthetic_call_00, 0xfe00000000000006ull, 0, 0)            \
-    M(synthetic_call_01, 0xfe00000000000007ull, 0, 1)            \
-    M(synthetic_call_10, 0xfe00000000000008ull, 1, 0)            \
-    M(synthetic_call_11, 0xfe00000000000009ull, 1, 1)            \
-    M(synthetic_call_20, 0xfe0000000000000aull, 2, 0)            \
-    M(synthetic_call_21, 0xfe0000000000000bull, 2, 1)            \
-    M(synthetic_call_30, 0xfe0000000000000cull, 3, 0)            \
-    M(synthetic_call_31, 0xfe0000000000000dull, 3, 1)            \
-    M(synthetic_end_expression, 0xfe0000000000000eull, 0, 0)
+    M(synthetic_i32_add2local, 0xff00000000000000ull, 0, 1)      \
+    M(synthetic_i32_addconstlocal, 0xff00000000000001ull, 0, 1)  \
+    M(synthetic_i32_andconstlocal, 0xff00000000000002ull, 0, 1)  \
+    M(synthetic_i32_storelocal, 0xff00000000000003ull, 1, 0)     \
+    M(synthetic_i64_storelocal, 0xff00000000000004ull, 1, 0)     \
+    M(synthetic_local_seti32_const, 0xff00000000000005ull, 0, 0) \
+    M(synthetic_call_00, 0xff00000000000006ull, 0, 0)            \
+    M(synthetic_call_01, 0xff00000000000007ull, 0, 1)            \
+    M(synthetic_call_10, 0xff00000000000008ull, 1, 0)            \
+    M(synthetic_call_11, 0xff00000000000009ull, 1, 1)            \
+    M(synthetic_call_20, 0xff0000000000000aull, 2, 0)            \
+    M(synthetic_call_21, 0xff0000000000000bull, 2, 1)            \
+    M(synthetic_call_30, 0xff0000000000000cull, 3, 0)            \
+    M(synthetic_call_31, 0xff0000000000000dull, 3, 1)            \
+    M(synthetic_end_expression, 0xff0000000000000eull, 0, 0)
 
 #define ENUMERATE_WASM_OPCODES(M)         \
     ENUMERATE_SINGLE_BYTE_WASM_OPCODES(M) \
@@ -509,7 +576,7 @@ namespace Instructions {
 ENUMERATE_WASM_OPCODES(M)
 #undef M
 
-static constexpr inline OpCode SyntheticInstructionBase = 0xfe00000000000000ull;
+static constexpr inline OpCode SyntheticInstructionBase = 0xff00000000000000ull;
 static constexpr inline size_t SyntheticInstructionCount = 15;
 
 }
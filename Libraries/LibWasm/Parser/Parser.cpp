@@ -11,6 +11,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeLogger.h>
 #include <AK/UFixedBigInt.h>
+#include <LibThreading/Parallel.h>
 #include <LibWasm/Types.h>
 
 namespace Wasm {
@@ -168,10 +169,12 @@ ParseResult<Limits> Limits::parse(ConstrainedStream& stream)
     auto flag = TRY_READ(stream, u8, ParseError::ExpectedKindTag);
 
     // Proposal 'memory64': flags 0/1 refer to 32-bit limits, flags 4/5 refer to 64-bit limits.
-    if (flag & ~0b00000101)
+    // Proposal 'threads': flag 2 marks the limits as shared.
+    if (flag & ~0b00000111)
         return with_eof_check(stream, ParseError::InvalidTag);
 
     auto address_type = (flag & 0b00000100) ? AddressType::I64 : AddressType::I32;
+    auto is_shared = (flag & 0b00000010) != 0;
 
     auto min_or_error = stream.read_value<LEB128<u64>>();
     if (min_or_error.is_error())
@@ -186,7 +189,7 @@ ParseResult<Limits> Limits::parse(ConstrainedStream& stream)
         max = value_or_error.release_value();
     }
 
-    return Limits { address_type, min, move(max) };
+    return Limits { address_type, min, move(max), is_shared };
 }
 
 ParseResult<MemoryType> MemoryType::parse(ConstrainedStream& stream)
@@ -203,6 +206,8 @@ ParseResult<TableType> TableType::parse(ConstrainedStream& stream)
     if (!type_result.is_reference())
         return ParseError::InvalidType;
     auto limits_result = TRY(Limits::parse(stream));
+    if (limits_result.is_shared())
+        return ParseError::InvalidTag;
     return TableType { type_result, limits_result };
 }
 
@@ -594,7 +599,8 @@ ParseResult<Instruction> Instruction::parse(ConstrainedStream& stream)
     case Instructions::i64_extend32_s.value():
         return Instruction { opcode };
     case 0xfc:
-    case 0xfd: {
+    case 0xfd:
+    case 0xfe: {
         // These are multibyte instructions.
         auto selector = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
         OpCode full_opcode = static_cast<u64>(opcode.value()) << 56 | selector;
@@ -961,6 +967,94 @@ ParseResult<Instruction> Instruction::parse(ConstrainedStream& stream)
         case Instructions::i32x4_relaxed_dot_i8x16_i7x16_add_s.value():
             // op
             return Instruction { full_opcode };
+        case Instructions::memory_atomic_notify.value():
+        case Instructions::memory_atomic_wait32.value():
+        case Instructions::memory_atomic_wait64.value():
+        case Instructions::i32_atomic_load.value():
+        case Instructions::i64_atomic_load.value():
+        case Instructions::i32_atomic_load8_u.value():
+        case Instructions::i32_atomic_load16_u.value():
+        case Instructions::i64_atomic_load8_u.value():
+        case Instructions::i64_atomic_load16_u.value():
+        case Instructions::i64_atomic_load32_u.value():
+        case Instructions::i32_atomic_store.value():
+        case Instructions::i64_atomic_store.value():
+        case Instructions::i32_atomic_store8.value():
+        case Instructions::i32_atomic_store16.value():
+        case Instructions::i64_atomic_store8.value():
+        case Instructions::i64_atomic_store16.value():
+        case Instructions::i64_atomic_store32.value():
+        case Instructions::i32_atomic_rmw_add.value():
+        case Instructions::i64_atomic_rmw_add.value():
+        case Instructions::i32_atomic_rmw8_add_u.value():
+        case Instructions::i32_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw8_add_u.value():
+        case Instructions::i64_atomic_rmw16_add_u.value():
+        case Instructions::i64_atomic_rmw32_add_u.value():
+        case Instructions::i32_atomic_rmw_sub.value():
+        case Instructions::i64_atomic_rmw_sub.value():
+        case Instructions::i32_atomic_rmw8_sub_u.value():
+        case Instructions::i32_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw8_sub_u.value():
+        case Instructions::i64_atomic_rmw16_sub_u.value():
+        case Instructions::i64_atomic_rmw32_sub_u.value():
+        case Instructions::i32_atomic_rmw_and.value():
+        case Instructions::i64_atomic_rmw_and.value():
+        case Instructions::i32_atomic_rmw8_and_u.value():
+        case Instructions::i32_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw8_and_u.value():
+        case Instructions::i64_atomic_rmw16_and_u.value():
+        case Instructions::i64_atomic_rmw32_and_u.value():
+        case Instructions::i32_atomic_rmw_or.value():
+        case Instructions::i64_atomic_rmw_or.value():
+        case Instructions::i32_atomic_rmw8_or_u.value():
+        case Instructions::i32_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw8_or_u.value():
+        case Instructions::i64_atomic_rmw16_or_u.value():
+        case Instructions::i64_atomic_rmw32_or_u.value():
+        case Instructions::i32_atomic_rmw_xor.value():
+        case Instructions::i64_atomic_rmw_xor.value():
+        case Instructions::i32_atomic_rmw8_xor_u.value():
+        case Instructions::i32_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw8_xor_u.value():
+        case Instructions::i64_atomic_rmw16_xor_u.value():
+        case Instructions::i64_atomic_rmw32_xor_u.value():
+        case Instructions::i32_atomic_rmw_xchg.value():
+        case Instructions::i64_atomic_rmw_xchg.value():
+        case Instructions::i32_atomic_rmw8_xchg_u.value():
+        case Instructions::i32_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw8_xchg_u.value():
+        case Instructions::i64_atomic_rmw16_xchg_u.value():
+        case Instructions::i64_atomic_rmw32_xchg_u.value():
+        case Instructions::i32_atomic_rmw_cmpxchg.value():
+        case Instructions::i64_atomic_rmw_cmpxchg.value():
+        case Instructions::i32_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i32_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw8_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw16_cmpxchg_u.value():
+        case Instructions::i64_atomic_rmw32_cmpxchg_u.value(): {
+            // op (align [multi-memory memindex] offset)
+            u32 align = TRY_READ(stream, LEB128<u32>, ParseError::ExpectedIndex);
+
+            // Proposal "multi-memory", if bit 6 of alignment is set, then a memory index follows the alignment.
+            auto memory_index = 0;
+            if ((align & 0x40) != 0) {
+                align &= ~0x40;
+                memory_index = TRY_READ(stream, LEB128<u32>, ParseError::InvalidInput);
+            }
+
+            // Proposal 'memory64': memarg offsets are u64 instead of u32.
+            auto offset = TRY_READ(stream, LEB128<u64>, ParseError::ExpectedIndex);
+
+            return Instruction { full_opcode, MemoryArgument { align, offset, MemoryIndex(memory_index) } };
+        }
+        case Instructions::atomic_fence.value(): {
+            // op 0x00
+            auto reserved = TRY_READ(stream, u8, ParseError::InvalidInput);
+            if (reserved != 0)
+                return ParseError::InvalidImmediate;
+            return Instruction { full_opcode };
+        }
         default:
             return ParseError::UnknownInstruction;
         }
@@ -1286,7 +1380,61 @@ ParseResult<CodeSection::Code> CodeSection::Code::parse(ConstrainedStream& strea
 ParseResult<CodeSection> CodeSection::parse(ConstrainedStream& stream)
 {
     ScopeLogger<WASM_BINPARSER_DEBUG> logger("CodeSection"sv);
-    auto result = TRY(parse_vector<Code>(stream));
+
+    // Function bodies are size-prefixed, so once the section has been split up into them, they can be parsed in parallel.
+    static constexpr size_t minimum_functions_per_thread = 32;
+
+    auto section_bytes_or_error = ByteBuffer::create_uninitialized(stream.remaining());
+    if (section_bytes_or_error.is_error())
+        return ParseError::OutOfMemory;
+    auto section_bytes = section_bytes_or_error.release_value();
+    if (stream.read_until_filled(section_bytes).is_error())
+        return ParseError::UnexpectedEof;
+
+    FixedMemoryStream section_stream { section_bytes.bytes() };
+    auto count_or_error = section_stream.read_value<LEB128<u32>>();
+    if (count_or_error.is_error())
+        return with_eof_check(section_stream, ParseError::ExpectedSize);
+    size_t count = count_or_error.release_value();
+
+    Vector<ReadonlyBytes> bodies;
+    bodies.ensure_capacity(min(count, section_stream.remaining()));
+    for (size_t i = 0; i < count; ++i) {
+        auto size = TRY_READ(section_stream, LEB128<u32>, ParseError::InvalidSize);
+        auto body_or_error = section_stream.read_in_place<u8 const>(size);
+        if (body_or_error.is_error())
+            return ParseError::UnexpectedEof;
+        bodies.append(body_or_error.release_value());
+    }
+    if (!section_stream.is_eof())
+        return ParseError::SectionSizeMismatch;
+
+    Vector<Optional<ParseResult<Func>>> funcs;
+    funcs.resize(bodies.size());
+    Threading::for_each_in_parallel(
+        bodies.size(), [&](size_t i) {
+            FixedMemoryStream body_stream { bodies[i] };
+            ConstrainedStream constrained_body_stream { MaybeOwned<Stream> { body_stream }, bodies[i].size() };
+
+            // Empirically, if there are `size` bytes to be read, then there's around
+            // `size / 2` instructions, so we pass that as our size hint.
+            auto func = Func::parse(constrained_body_stream, bodies[i].size() / 2);
+            if (!func.is_error() && !body_stream.is_eof()) {
+                funcs[i] = ParseResult<Func> { ParseError::SectionSizeMismatch };
+                return;
+            }
+            funcs[i] = move(func);
+        },
+        minimum_functions_per_thread);
+
+    Vector<Code> result;
+    result.ensure_capacity(bodies.size());
+    for (size_t i = 0; i < bodies.size(); ++i) {
+        auto func = funcs[i].release_value();
+        if (func.is_error())
+            return func.release_error();
+        result.unchecked_append(Code { static_cast<u32>(bodies[i].size()), func.release_value() });
+    }
     return CodeSection { move(result) };
 }
 
@@ -1477,6 +1625,40 @@ ParseResult<NonnullRefPtr<Module>> Module::parse(Stream& stream)
     return module_ptr;
 }
 
+size_t Module::retained_size() const
+{
+    auto expression_size = [](Expression const& expression) {
+        auto const& compiled = expression.compiled_instructions;
+        return expression.instructions().capacity() * sizeof(Instruction)
+            + compiled.dispatches.capacity() * sizeof(Dispatch)
+            + compiled.extra_instruction_storage.capacity() * sizeof(Instruction);
+    };
+
+    size_t size = sizeof(Module);
+    for (auto const& section : m_custom_sections)
+        size += sizeof(section) + section.name().length() + section.contents().size();
+
+    for (auto const& segment : m_element_section.segments()) {
+        size += sizeof(segment);
+        for (auto const& expression : segment.init)
+            size += sizeof(expression) + expression_size(expression);
+    }
+
+    for (auto const& code : m_code_section.functions()) {
+        auto const& func = code.func();
+        size += sizeof(code) + func.locals().capacity() * sizeof(Locals) + expression_size(func.body());
+    }
+
+    for (auto const& data : m_data_section.data()) {
+        size += sizeof(data);
+        data.value().visit(
+            [&](DataSection::Data::Passive const& passive) { size += passive.init.capacity(); },
+            [&](DataSection::Data::Active const& active) { size += active.init.capacity() + expression_size(active.offset); });
+    }
+
+    return size;
+}
+
 ByteString parse_error_to_byte_string(ParseError error)
 {
     switch (error) {
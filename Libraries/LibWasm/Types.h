@@ -259,10 +259,11 @@ enum class AddressType : u8 {
 // https://webassembly.github.io/spec/core/bikeshed/#limits%E2%91%A5
 class Limits {
 public:
-    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {})
+    explicit Limits(AddressType address_type, u64 min, Optional<u64> max = {}, bool is_shared = false)
         : m_address_type(address_type)
         , m_min(min)
         , m_max(move(max))
+        , m_is_shared(is_shared)
     {
     }
 
@@ -273,11 +274,14 @@ public:
     auto address_type() const { return m_address_type; }
     auto min() const { return m_min; }
     auto& max() const { return m_max; }
+    // Proposal 'threads': only memories can be shared, which makes them accessible from multiple agents at once.
+    auto is_shared() const { return m_is_shared; }
     bool is_subset_of(Limits other) const
     {
         return m_min >= other.min()
             && (!other.max().has_value() || (m_max.has_value() && *m_max <= *other.max()))
-            && m_address_type == other.m_address_type;
+            && m_address_type == other.m_address_type
+            && m_is_shared == other.m_is_shared;
     }
 
     static ParseResult<Limits> parse(ConstrainedStream& stream);
@@ -286,6 +290,7 @@ private:
     AddressType m_address_type { AddressType::I32 };
     u64 m_min { 0 };
     Optional<u64> m_max;
+    bool m_is_shared { false };
 };
 
 // https://webassembly.github.io/spec/core/bikeshed/#memory-types%E2%91%A4
@@ -1254,6 +1259,10 @@ public:
 
     static ParseResult<NonnullRefPtr<Module>> parse(Stream& stream);
 
+    // Roughly how much memory this module keeps alive: function bodies (including their dispatch lists once the module
+    // has been validated), element and data segments, and custom sections. The other sections are small next to these.
+    size_t retained_size() const;
+
 private:
     void set_validation_status(ValidationStatus status) { m_validation_status = status; }
 
@@ -224,11 +224,17 @@ void EventLoop::process()
         for (auto& win : same_loop_windows()) {
             win->start_an_idle_period();
         }
+
+        // NOTE: We have nothing better to do, so let the garbage collector make some progress in a short slice.
+        heap().perform_incremental_collection_slice();
     }
 
     // If there are eligible tasks in the queue, schedule a new round of processing. :^)
     if (m_task_queue->has_runnable_tasks() || (!m_microtask_queue->is_empty() && !m_performing_a_microtask_checkpoint)) {
         schedule();
+    } else if (m_type == Type::Window && heap().has_incremental_collection_work()) {
+        // NOTE: Come back for another garbage collection slice, since the collector isn't done yet.
+        schedule();
     }
 }
 
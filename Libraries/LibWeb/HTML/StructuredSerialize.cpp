@@ -135,6 +135,11 @@ static WebIDL::ExceptionOr<void> serialize_array_buffer(JS::VM& vm, TransferData
         if (for_storage)
             return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot serialize SharedArrayBuffer for storage"_utf16);
 
+        // FIXME: A WebAssembly memory's buffer has to stay shared with the receiving agent, but workers run in other processes,
+        //        and linear memory is not backed by a mapping that can cross into them yet. Refuse instead of handing over a copy.
+        if (array_buffer.has_unowned_data())
+            return WebIDL::DataCloneError::create(*vm.current_realm(), "Cannot serialize SharedArrayBuffer of a WebAssembly.Memory"_utf16);
+
         if (!array_buffer.is_fixed_length()) {
             // 3. If value has an [[ArrayBufferMaxByteLength]] internal slot, then set serialized to { [[Type]]: "GrowableSharedArrayBuffer",
             //           [[ArrayBufferData]]: value.[[ArrayBufferData]], [[ArrayBufferByteLengthData]]: value.[[ArrayBufferByteLengthData]],
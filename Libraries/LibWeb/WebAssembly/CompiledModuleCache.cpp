@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibWeb/WebAssembly/CompiledModuleCache.h>
+
+namespace Web::WebAssembly::Detail {
+
+CompiledModuleCache& CompiledModuleCache::the()
+{
+    static CompiledModuleCache cache;
+    return cache;
+}
+
+RefPtr<Wasm::Module> CompiledModuleCache::find(Key const& key)
+{
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+        return {};
+
+    // Move the entry to the back, so the least recently used entry is evicted first.
+    auto entry = m_entries.take(key).release_value();
+    auto module = entry.module;
+    m_entries.set(key, move(entry));
+    return module;
+}
+
+void CompiledModuleCache::add(Key const& key, NonnullRefPtr<Wasm::Module> module)
+{
+    VERIFY(module->validation_status() == Wasm::Module::ValidationStatus::Valid);
+
+    auto retained_size = module->retained_size();
+    if (retained_size > m_maximum_total_retained_size)
+        return;
+
+    if (auto existing_entry = m_entries.take(key); existing_entry.has_value())
+        m_total_retained_size -= existing_entry->retained_size;
+
+    while (!m_entries.is_empty() && m_total_retained_size + retained_size > m_maximum_total_retained_size)
+        m_total_retained_size -= m_entries.take_first().retained_size;
+
+    m_total_retained_size += retained_size;
+    m_entries.set(key, { retained_size, move(module) });
+}
+
+void CompiledModuleCache::clear()
+{
+    m_entries.clear();
+    m_total_retained_size = 0;
+}
+
+}
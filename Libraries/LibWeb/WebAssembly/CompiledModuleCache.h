@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#pragma once
+
+#include <AK/HashMap.h>
+#include <AK/Noncopyable.h>
+#include <AK/NonnullRefPtr.h>
+#include <AK/String.h>
+#include <LibCrypto/Hash/SHA2.h>
+#include <LibWasm/Types.h>
+#include <LibWeb/Export.h>
+
+namespace Web::WebAssembly::Detail {
+
+// Keeps recently compiled (i.e. parsed and validated) large modules around, keyed by a SHA-256 digest of their bytes,
+// so that compiling the same bytes again (e.g. on the next navigation to the same site, or from another realm) can
+// skip parsing, validation and the pre-compilation of function bodies to dispatch lists.
+// Wasm::Module is immutable once validated, so a single one can back any number of WebAssembly.Module objects.
+//
+// Like the HTTP cache, entries are partitioned by top-level site: otherwise a site could tell which modules another
+// one has compiled by how quickly its own compilations of the same bytes finish.
+//
+// The budget is spent on what the modules keep alive once compiled, which is several times their size on the wire.
+// Everything is dropped when the system runs low on memory.
+class WEB_API CompiledModuleCache {
+    AK_MAKE_NONCOPYABLE(CompiledModuleCache);
+    AK_MAKE_NONMOVABLE(CompiledModuleCache);
+
+public:
+    // Modules smaller than this are cheap enough to compile that hashing and caching them isn't worth it.
+    static constexpr size_t minimum_module_size = 64 * KiB;
+    static constexpr size_t default_maximum_total_retained_size = 256 * MiB;
+
+    using Digest = Crypto::Hash::SHA256::DigestType;
+
+    struct Key {
+        // The serialization of the top-level site, see https://html.spec.whatwg.org/multipage/browsers.html#site
+        String top_level_site;
+        Digest digest;
+
+        bool operator==(Key const&) const = default;
+    };
+
+    static CompiledModuleCache& the();
+
+    explicit CompiledModuleCache(size_t maximum_total_retained_size = default_maximum_total_retained_size)
+        : m_maximum_total_retained_size(maximum_total_retained_size)
+    {
+    }
+
+    RefPtr<Wasm::Module> find(Key const&);
+
+    // The module must have been validated, so that its retained size includes the dispatch lists.
+    void add(Key const&, NonnullRefPtr<Wasm::Module>);
+
+    void clear();
+
+    size_t entry_count() const { return m_entries.size(); }
+    size_t total_retained_size() const { return m_total_retained_size; }
+
+private:
+    struct Entry {
+        size_t retained_size { 0 };
+        NonnullRefPtr<Wasm::Module> module;
+    };
+
+    struct KeyTraits : public DefaultTraits<Key> {
+        static unsigned hash(Key const& key) { return pair_int_hash(key.top_level_site.hash(), Traits<ReadonlyBytes>::hash(key.digest.bytes())); }
+    };
+
+    OrderedHashMap<Key, Entry, KeyTraits> m_entries;
+    size_t m_total_retained_size { 0 };
+    size_t m_maximum_total_retained_size { 0 };
+};
+
+}
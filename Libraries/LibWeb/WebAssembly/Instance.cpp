@@ -73,9 +73,8 @@ void Instance::initialize(JS::Realm& realm)
             [&](Wasm::MemoryAddress const& address) {
                 Optional<GC::Ptr<Memory>> object = cache.get_memory_instance(address);
                 if (!object.has_value()) {
-                    // FIXME: Once LibWasm implements the threads/atomics proposal, the shared-ness should be
-                    //        obtained from the Wasm::MemoryInstance's type.
-                    object = realm.create<Memory>(realm, address, Memory::Shared::No);
+                    auto is_shared = cache.abstract_machine().store().get(address)->is_shared();
+                    object = realm.create<Memory>(realm, address, is_shared ? Memory::Shared::Yes : Memory::Shared::No);
                 }
 
                 m_exports->define_direct_property(name, *object, JS::default_attributes);
@@ -34,7 +34,7 @@ WebIDL::ExceptionOr<GC::Ref<Memory>> Memory::construct_impl(JS::Realm& realm, Me
     if (shared && !descriptor.maximum.has_value())
         return vm.throw_completion<JS::TypeError>("Maximum has to be specified for shared memory."sv);
 
-    Wasm::Limits limits { Wasm::AddressType::I32, descriptor.initial, descriptor.maximum.map([](auto x) -> u64 { return x; }) };
+    Wasm::Limits limits { Wasm::AddressType::I32, descriptor.initial, descriptor.maximum.map([](auto x) -> u64 { return x; }), shared };
     Wasm::MemoryType memory_type { move(limits) };
 
     auto& cache = Detail::get_cache(realm);
@@ -102,13 +102,13 @@ JS::ThrowCompletionOr<u32> Memory::grow(u32 delta)
     auto* memory = context.abstract_machine().store().get(address());
     VERIFY(memory);
 
-    auto previous_size = memory->size() / Wasm::Constants::page_size;
-    if (!memory->grow(delta * Wasm::Constants::page_size, Wasm::MemoryInstance::GrowType::No, Wasm::MemoryInstance::InhibitGrowCallback::Yes))
+    auto previous_size = memory->grow(delta * Wasm::Constants::page_size, Wasm::MemoryInstance::GrowType::No, Wasm::MemoryInstance::InhibitGrowCallback::Yes);
+    if (!previous_size.has_value())
         return vm.throw_completion<JS::RangeError>("Memory.grow() grows past the stated limit of the memory instance"sv);
 
     refresh_the_memory_buffer(vm, realm(), m_address);
 
-    return previous_size;
+    return *previous_size / Wasm::Constants::page_size;
 }
 
 // https://webassembly.github.io/threads/js-api/index.html#dom-memory-tofixedlengthbuffer
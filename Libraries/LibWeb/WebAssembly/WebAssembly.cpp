@@ -9,6 +9,7 @@
 #include <AK/MemoryStream.h>
 #include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
+#include <LibJS/Runtime/Agent.h>
 #include <LibJS/Runtime/Array.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/BigInt.h>
@@ -19,13 +20,16 @@
 #include <LibJS/Runtime/Object.h>
 #include <LibJS/Runtime/VM.h>
 #include <LibJS/Runtime/ValueInlines.h>
+#include <LibURL/Site.h>
 #include <LibWasm/AbstractMachine/Validator.h>
 #include <LibWeb/Bindings/Intrinsics.h>
 #include <LibWeb/Bindings/ResponsePrototype.h>
 #include <LibWeb/ContentSecurityPolicy/BlockingAlgorithms.h>
 #include <LibWeb/Fetch/Response.h>
+#include <LibWeb/HTML/Scripting/Environments.h>
 #include <LibWeb/HTML/Scripting/TemporaryExecutionContext.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/WebAssembly/CompiledModuleCache.h>
 #include <LibWeb/WebAssembly/Global.h>
 #include <LibWeb/WebAssembly/Instance.h>
 #include <LibWeb/WebAssembly/Memory.h>
@@ -49,7 +53,12 @@ HashMap<GC::Ptr<JS::Object>, WebAssemblyCache> s_caches;
 
 WebAssemblyCache& get_cache(JS::Realm& realm)
 {
-    return s_caches.ensure(realm.global_object());
+    return s_caches.ensure(realm.global_object(), [&] {
+        WebAssemblyCache cache;
+        // memory.atomic.wait blocks just like Atomics.wait does, so it's only allowed where Atomics.wait is.
+        cache.abstract_machine().agent_can_block = [&vm = realm.vm()] { return JS::agent_can_suspend(vm); };
+        return cache;
+    });
 }
 
 }
@@ -417,22 +426,54 @@ JS::ThrowCompletionOr<NonnullOwnPtr<Wasm::ModuleInstance>> instantiate_module(JS
     return instance_result.release_value();
 }
 
+// Returns the partition of the CompiledModuleCache that modules compiled in the given realm go into, if any.
+static Optional<String> compiled_module_cache_partition(JS::Realm& realm)
+{
+    auto& settings = HTML::principal_realm_settings_object(HTML::principal_realm(realm));
+    auto top_level_origin = settings.top_level_origin;
+    if (!top_level_origin.has_value() && settings.top_level_creation_url.has_value())
+        top_level_origin = settings.top_level_creation_url->origin();
+
+    // NOTE: Opaque sites all serialize to "null", so there's nothing we could tell them apart by.
+    if (!top_level_origin.has_value() || top_level_origin->is_opaque())
+        return {};
+    return URL::Site::obtain(*top_level_origin).serialize();
+}
+
 // // https://webassembly.github.io/spec/js-api/#compile-a-webassembly-module
 // https://webassembly.github.io/content-security-policy/js-api/#compile-a-webassembly-module
 JS::ThrowCompletionOr<NonnullRefPtr<CompiledWebAssemblyModule>> compile_a_webassembly_module(JS::VM& vm, ByteBuffer data)
 {
     TRY(host_ensure_can_compile_wasm_bytes(vm));
 
+    auto& cache = get_cache(*vm.current_realm());
+    auto& module_cache = CompiledModuleCache::the();
+
+    Optional<CompiledModuleCache::Key> cache_key;
+    if (data.size() >= CompiledModuleCache::minimum_module_size) {
+        if (auto partition = compiled_module_cache_partition(*vm.current_realm()); partition.has_value())
+            cache_key = CompiledModuleCache::Key { partition.release_value(), Crypto::Hash::SHA256::hash(data) };
+    }
+    if (cache_key.has_value()) {
+        if (auto module = module_cache.find(*cache_key)) {
+            auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module.release_nonnull());
+            cache.add_compiled_module(compiled_module);
+            return compiled_module;
+        }
+    }
+
     FixedMemoryStream stream { data.bytes() };
     auto module_result = Wasm::Module::parse(stream);
     if (module_result.is_error()) {
         return vm.throw_completion<CompileError>(Wasm::parse_error_to_byte_string(module_result.error()));
     }
 
-    auto& cache = get_cache(*vm.current_realm());
     if (auto validation_result = cache.abstract_machine().validate(module_result.value()); validation_result.is_error()) {
         return vm.throw_completion<CompileError>(validation_result.error().error_string);
     }
+    if (cache_key.has_value())
+        module_cache.add(*cache_key, module_result.value());
+
     auto compiled_module = make_ref_counted<CompiledWebAssemblyModule>(module_result.release_value());
     cache.add_compiled_module(compiled_module);
     return compiled_module;
@@ -119,6 +119,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     bool enable_idl_tracing = false;
     bool disable_http_cache = false;
     bool enable_http_disk_cache = false;
+    bool enable_js_baseline_tier = false;
     bool disable_content_filter = false;
     bool enable_autoplay = false;
     bool expose_internals_object = false;
@@ -168,6 +169,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(disable_http_cache, "Disable HTTP cache", "disable-http-cache");
     args_parser.add_option(enable_http_disk_cache, "Enable HTTP disk cache", "enable-http-disk-cache");
+    args_parser.add_option(enable_js_baseline_tier, "Compile hot JavaScript to native code", "enable-js-baseline-tier");
     args_parser.add_option(disable_content_filter, "Disable content filter", "disable-content-filter");
     args_parser.add_option(enable_autoplay, "Enable multimedia autoplay", "enable-autoplay");
     args_parser.add_option(expose_internals_object, "Expose internals object", "expose-internals-object");
@@ -272,6 +274,7 @@ ErrorOr<void> Application::initialize(Main::Arguments const& arguments)
         .disable_site_isolation = disable_site_isolation ? DisableSiteIsolation::Yes : DisableSiteIsolation::No,
         .enable_idl_tracing = enable_idl_tracing ? EnableIDLTracing::Yes : EnableIDLTracing::No,
         .enable_http_cache = disable_http_cache ? EnableHTTPCache::No : EnableHTTPCache::Yes,
+        .enable_js_baseline_tier = enable_js_baseline_tier ? EnableJSBaselineTier::Yes : EnableJSBaselineTier::No,
         .expose_internals_object = expose_internals_object ? ExposeInternalsObject::Yes : ExposeInternalsObject::No,
         .force_cpu_painting = force_cpu_painting ? ForceCPUPainting::Yes : ForceCPUPainting::No,
         .force_fontconfig = force_fontconfig ? ForceFontconfig::Yes : ForceFontconfig::No,
@@ -920,6 +923,14 @@ Optional<Core::TimeZoneWatcher&> Application::time_zone_watcher()
     return {};
 }
 
+void Application::system_memory_pressure()
+{
+    WebContentClient::for_each_client([](WebContentClient& client) {
+        client.async_system_memory_pressure();
+        return IterationDecision::Continue;
+    });
+}
+
 Vector<DevTools::TabDescription> Application::tab_list() const
 {
     Vector<DevTools::TabDescription> tabs;
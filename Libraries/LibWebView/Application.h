@@ -110,6 +110,9 @@ public:
 
     Optional<Core::TimeZoneWatcher&> time_zone_watcher();
 
+    // Asks every WebContent process to drop what it's only keeping around to speed things up later.
+    void system_memory_pressure();
+
 protected:
     explicit Application(Optional<ByteString> ladybird_binary_path = {});
 
@@ -122,6 +122,11 @@ enum class EnableHTTPCache {
     Yes,
 };
 
+enum class EnableJSBaselineTier {
+    No,
+    Yes,
+};
+
 enum class DisableSiteIsolation {
     No,
     Yes,
@@ -162,6 +167,7 @@ struct WebContentOptions {
     DisableSiteIsolation disable_site_isolation { DisableSiteIsolation::No };
     EnableIDLTracing enable_idl_tracing { EnableIDLTracing::No };
     EnableHTTPCache enable_http_cache { EnableHTTPCache::No };
+    EnableJSBaselineTier enable_js_baseline_tier { EnableJSBaselineTier::No };
     ExposeInternalsObject expose_internals_object { ExposeInternalsObject::No };
     ForceCPUPainting force_cpu_painting { ForceCPUPainting::No };
     ForceFontconfig force_fontconfig { ForceFontconfig::No };
@@ -24,6 +24,7 @@ if(INCLUDE_WASM_SPEC_TESTS)
     if(EXISTS ${WASM_SPEC_TEST_GZ_PATH} AND NOT EXISTS ${WASM_SPEC_TEST_PATH}/const_0.wasm)
         message(STATUS "Extracting the WebAssembly testsuite from ${WASM_SPEC_TEST_GZ_PATH}...")
         extract_path("${CMAKE_CURRENT_BINARY_DIR}" "${WASM_SPEC_TEST_GZ_PATH}" "testsuite-${WASM_SPEC_TEST_COMMIT}/*.wast" "${WASM_SPEC_TEST_PATH}")
+        extract_path("${CMAKE_CURRENT_BINARY_DIR}" "${WASM_SPEC_TEST_GZ_PATH}" "testsuite-${WASM_SPEC_TEST_COMMIT}/proposals/threads/*.wast" "${WASM_SPEC_TEST_PATH}")
         file(MAKE_DIRECTORY ${WASM_SPEC_TEST_PATH})
         file(GLOB WASM_TESTS "${CMAKE_CURRENT_BINARY_DIR}/testsuite-${WASM_SPEC_TEST_COMMIT}/*.wast")
         foreach(PATH ${WASM_TESTS})
@@ -32,6 +33,13 @@ if(INCLUDE_WASM_SPEC_TESTS)
             execute_process(
                 COMMAND env SKIP_PRETTIER=${SKIP_PRETTIER} bash ${SerenityOS_SOURCE_DIR}/Meta/generate-libwasm-spec-test.sh "${PATH}" "${CMAKE_CURRENT_BINARY_DIR}/Tests/Spec" "${NAME}" "${WASM_SPEC_TEST_PATH}")
         endforeach()
+        # The threads proposal's own copies of these cover shared memories and the atomic instructions.
+        # They're prefixed so they don't clash with the core tests of the same name.
+        foreach(NAME atomic memory)
+            message(STATUS "Generating test cases for WebAssembly threads test ${NAME}...")
+            execute_process(
+                COMMAND env SKIP_PRETTIER=${SKIP_PRETTIER} bash ${SerenityOS_SOURCE_DIR}/Meta/generate-libwasm-spec-test.sh "${CMAKE_CURRENT_BINARY_DIR}/testsuite-${WASM_SPEC_TEST_COMMIT}/proposals/threads/${NAME}.wast" "${CMAKE_CURRENT_BINARY_DIR}/Tests/Spec" "threads-${NAME}" "${WASM_SPEC_TEST_PATH}")
+        endforeach()
         file(REMOVE testsuite-${WASM_SPEC_TEST_COMMIT})
     endif()
 endif()
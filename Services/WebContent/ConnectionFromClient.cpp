@@ -12,12 +12,14 @@
 #include <AK/JsonObject.h>
 #include <AK/QuickSort.h>
 #include <LibCore/EventLoop.h>
+#include <LibCore/File.h>
 #include <LibGC/Heap.h>
 #include <LibGfx/Bitmap.h>
 #include <LibGfx/Font/FontDatabase.h>
 #include <LibGfx/SystemTheme.h>
 #include <LibJS/Runtime/ConsoleObject.h>
 #include <LibJS/Runtime/Date.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibUnicode/TimeZone.h>
 #include <LibWeb/ARIA/RoleType.h>
 #include <LibWeb/Bindings/MainThreadVM.h>
@@ -50,6 +52,7 @@
 #include <LibWeb/Painting/ViewportPaintable.h>
 #include <LibWeb/PermissionsPolicy/AutoplayAllowlist.h>
 #include <LibWeb/Platform/EventLoopPlugin.h>
+#include <LibWeb/WebAssembly/CompiledModuleCache.h>
 #include <LibWebView/Attribute.h>
 #include <WebContent/ConnectionFromClient.h>
 #include <WebContent/PageClient.h>
@@ -377,6 +380,68 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
         return;
     }
 
+    if (request == "start-js-sampling-profiler") {
+        auto interval_in_milliseconds = argument.to_number<u32>().value_or(1);
+        Web::Bindings::main_thread_vm().start_sampling_profiler(interval_in_milliseconds);
+        return;
+    }
+
+    if (request == "stop-js-sampling-profiler") {
+        auto profiler = Web::Bindings::main_thread_vm().stop_sampling_profiler();
+        if (!profiler)
+            return;
+
+        if (argument.is_empty()) {
+            dbgln("{}", profiler->to_collapsed_stacks());
+            return;
+        }
+
+        if (auto result = profiler->write_to_file(argument); result.is_error())
+            dbgln("Failed to write JS profile to '{}': {}", argument, result.error());
+        else
+            dbgln("Wrote {} JS profile samples to '{}'", profiler->sample_count(), argument);
+        return;
+    }
+
+    if (request == "start-allocation-sampling") {
+        auto sampling_interval = argument.to_number<size_t>().value_or(64 * KiB);
+        Web::Bindings::main_thread_vm().start_allocation_sampling(sampling_interval);
+        return;
+    }
+
+    if (request == "stop-allocation-sampling") {
+        Web::Bindings::main_thread_vm().heap().stop_allocation_sampling();
+        return;
+    }
+
+    if (request == "dump-allocation-samples") {
+        // NOTE: Like "collect-garbage", we use deferred_invoke to collect with as little on the stack as possible.
+        Core::deferred_invoke([path = argument] {
+            auto& heap = Web::Bindings::main_thread_vm().heap();
+            auto* allocation_sampler = heap.allocation_sampler();
+            if (!allocation_sampler) {
+                dbgln("Allocation sampling is not enabled");
+                return;
+            }
+
+            heap.collect_garbage();
+            if (path.is_empty()) {
+                allocation_sampler->dump_live_heap();
+                return;
+            }
+
+            auto snapshot = allocation_sampler->live_heap_snapshot().serialized();
+            auto result = [&]() -> ErrorOr<void> {
+                auto file = TRY(Core::File::open(path, Core::File::OpenMode::Write | Core::File::OpenMode::Truncate));
+                TRY(file->write_until_depleted(snapshot.bytes()));
+                return {};
+            }();
+            if (result.is_error())
+                dbgln("Failed to write allocation samples to '{}': {}", path, result.error());
+        });
+        return;
+    }
+
     if (request == "set-line-box-borders") {
         bool state = argument == "on";
         auto traversable = page->page().top_level_traversable();
@@ -387,6 +452,7 @@ void ConnectionFromClient::debug_request(u64 page_id, ByteString request, ByteSt
 
     if (request == "clear-cache") {
         Web::ResourceLoader::the().clear_cache();
+        Web::WebAssembly::Detail::CompiledModuleCache::the().clear();
         return;
     }
 
@@ -1337,6 +1403,11 @@ void ConnectionFromClient::system_time_zone_changed()
     Unicode::clear_system_time_zone_cache();
 }
 
+void ConnectionFromClient::system_memory_pressure()
+{
+    Web::WebAssembly::Detail::CompiledModuleCache::the().clear();
+}
+
 void ConnectionFromClient::cookies_changed(Vector<Web::Cookie::Cookie> cookies)
 {
     for (auto& navigable : Web::HTML::all_navigables()) {
@@ -160,6 +160,7 @@ private:
     virtual void paste(u64 page_id, Utf16String text) override;
 
     virtual void system_time_zone_changed() override;
+    virtual void system_memory_pressure() override;
     virtual void cookies_changed(Vector<Web::Cookie::Cookie>) override;
 
     NonnullOwnPtr<PageHost> m_page_host;
@@ -81,6 +81,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool disable_site_isolation = false;
     bool enable_idl_tracing = false;
     bool enable_http_cache = false;
+    bool enable_js_baseline_tier = false;
     bool force_cpu_painting = false;
     bool force_fontconfig = false;
     bool collect_garbage_on_every_allocation = false;
@@ -104,6 +105,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_option(disable_site_isolation, "Disable site isolation", "disable-site-isolation");
     args_parser.add_option(enable_idl_tracing, "Enable IDL tracing", "enable-idl-tracing");
     args_parser.add_option(enable_http_cache, "Enable HTTP cache", "enable-http-cache");
+    args_parser.add_option(enable_js_baseline_tier, "Compile hot JavaScript to native code", "enable-js-baseline-tier");
     args_parser.add_option(force_cpu_painting, "Force CPU painting", "force-cpu-painting");
     args_parser.add_option(force_fontconfig, "Force using fontconfig for font loading", "force-fontconfig");
     args_parser.add_option(collect_garbage_on_every_allocation, "Collect garbage after every JS heap allocation", "collect-garbage-on-every-allocation");
@@ -193,6 +195,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
         Web::WebIDL::set_enable_idl_tracing(true);
     }
 
+    if (enable_js_baseline_tier)
+        JS::Bytecode::g_baseline_tier_enabled = true;
+
     auto maybe_content_filter_error = load_content_filters(config_path);
     if (maybe_content_filter_error.is_error())
         dbgln("Failed to load content filters: {}", maybe_content_filter_error.error());
@@ -6,6 +6,7 @@
 
 #include <LibTest/TestCase.h>
 
+#include <AK/Array.h>
 #include <AK/ByteBuffer.h>
 #include <AK/Vector.h>
 
@@ -63,6 +64,54 @@ TEST_CASE(zero_fill_new_elements_on_growth)
     EXPECT_EQ(buffer.span(), (Array<u8, 10> { 2, 2, 2, 2, 2, 2, 2, 2, 0, 0 }));
 }
 
+TEST_CASE(external_storage)
+{
+    Array<u8, 64> storage {};
+    storage.fill(0xaa);
+
+    auto buffer = ByteBuffer::create_with_external_storage(storage.span());
+    EXPECT(buffer.has_external_storage());
+    EXPECT(buffer.is_empty());
+    EXPECT_EQ(buffer.capacity(), storage.size());
+
+    // Growing within the storage neither allocates nor moves.
+    buffer.resize(48);
+    EXPECT_EQ(buffer.data(), storage.data());
+    buffer[0] = 1;
+    EXPECT_EQ(storage[0], 1);
+
+    // Shrinking below the inline capacity keeps using the storage.
+    buffer.trim(8, false);
+    EXPECT_EQ(buffer.data(), storage.data());
+
+    EXPECT(buffer.try_resize(storage.size() + 1).is_error());
+    EXPECT_EQ(buffer.size(), 8u);
+
+    auto moved = move(buffer);
+    EXPECT(moved.has_external_storage());
+    EXPECT_EQ(moved.data(), storage.data());
+    EXPECT(!buffer.has_external_storage());
+
+    moved.clear();
+    EXPECT(!moved.has_external_storage());
+    EXPECT_EQ(storage[0], 1);
+
+    // Copying into the buffer gives it storage of its own, even if the copy would have fit.
+    auto larger = MUST(ByteBuffer::create_zeroed(storage.size() + 1));
+    auto copied_into = ByteBuffer::create_with_external_storage(storage.span());
+    copied_into = larger;
+    EXPECT(!copied_into.has_external_storage());
+    EXPECT_EQ(copied_into.size(), larger.size());
+    EXPECT_NE(copied_into.data(), storage.data());
+
+    auto smaller = MUST(ByteBuffer::create_zeroed(4));
+    copied_into = ByteBuffer::create_with_external_storage(storage.span());
+    copied_into = smaller;
+    EXPECT(!copied_into.has_external_storage());
+    EXPECT_EQ(copied_into.size(), smaller.size());
+    EXPECT_EQ(storage[0], 1);
+}
+
 BENCHMARK_CASE(append)
 {
     ByteBuffer bb;
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/HashTable.h>
+#include <AK/ScopeGuard.h>
+#include <LibJS/Bytecode/Executable.h>
+#include <LibJS/Bytecode/Instruction.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Bytecode/Op.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+struct Passes {
+    bool jump_threading { true };
+    bool redundant_mov_elimination { true };
+    bool unreachable_block_elimination { true };
+};
+
+static auto enable_passes(Passes passes)
+{
+    JS::Bytecode::g_bytecode_jump_threading_enabled = passes.jump_threading;
+    JS::Bytecode::g_bytecode_redundant_mov_elimination_enabled = passes.redundant_mov_elimination;
+    JS::Bytecode::g_bytecode_unreachable_block_elimination_enabled = passes.unreachable_block_elimination;
+    return ScopeGuard([] {
+        JS::Bytecode::g_bytecode_jump_threading_enabled = true;
+        JS::Bytecode::g_bytecode_redundant_mov_elimination_enabled = true;
+        JS::Bytecode::g_bytecode_unreachable_block_elimination_enabled = true;
+    });
+}
+
+struct TestFunction {
+    NonnullOwnPtr<JS::ExecutionContext> execution_context;
+    GC::Root<JS::ECMAScriptFunctionObject> function;
+};
+
+// The sources below evaluate to a function, so that the code we look at isn't cluttered with the completion value
+// bookkeeping of a script.
+static TestFunction create_test_function(JS::VM& vm, StringView source)
+{
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(vm);
+    auto script = MUST(JS::Script::parse(source, *execution_context->realm));
+
+    vm.push_execution_context(*execution_context);
+    auto function = MUST(vm.bytecode_interpreter().run(*script));
+    vm.pop_execution_context();
+
+    return {
+        .execution_context = move(execution_context),
+        .function = as<JS::ECMAScriptFunctionObject>(function.as_object()),
+    };
+}
+
+static GC::Ref<JS::Bytecode::Executable> compile(JS::VM& vm, StringView source, Passes passes)
+{
+    auto test = create_test_function(vm, source);
+
+    auto guard = enable_passes(passes);
+    vm.push_execution_context(*test.execution_context);
+    auto executable = MUST(JS::Bytecode::compile(vm, *test.function));
+    vm.pop_execution_context();
+    return executable;
+}
+
+static JS::Value run(JS::VM& vm, StringView source, Passes passes)
+{
+    auto guard = enable_passes(passes);
+    auto test = create_test_function(vm, source);
+
+    vm.push_execution_context(*test.execution_context);
+    auto result = MUST(JS::call(vm, test.function.ptr(), JS::js_undefined()));
+    vm.pop_execution_context();
+    return result;
+}
+
+static bool returns_string(JS::VM& vm, StringView source, Passes passes, StringView expected)
+{
+    auto result = run(vm, source, passes);
+    return result.is_string() && result.as_string().utf8_string_view() == expected;
+}
+
+static HashTable<size_t> instruction_offsets(JS::Bytecode::Executable const& executable)
+{
+    HashTable<size_t> offsets;
+    for (JS::Bytecode::InstructionStreamIterator it(executable.bytecode, &executable); !it.at_end(); ++it)
+        offsets.set(it.offset());
+    return offsets;
+}
+
+// Counts the labels that point at an unconditional Jump, i.e. the jumps that could have gone straight to the final target.
+static size_t count_labels_targeting_jumps(JS::Bytecode::Executable const& executable)
+{
+    size_t count = 0;
+    for (JS::Bytecode::InstructionStreamIterator it(executable.bytecode, &executable); !it.at_end(); ++it) {
+        const_cast<JS::Bytecode::Instruction&>(*it).visit_labels([&](JS::Bytecode::Label& label) {
+            JS::Bytecode::InstructionStreamIterator target(executable.bytecode, &executable, label.address());
+            if (!target.at_end() && (*target).type() == JS::Bytecode::Instruction::Type::Jump)
+                ++count;
+        });
+    }
+    return count;
+}
+
+// The end block of each inner `if` contains nothing but a jump to the end block of the outer `if`.
+static constexpr auto nested_control_flow_source = R"~~~(
+    (function () {
+        let result = "";
+        for (let i = 0; i < 6; ++i) {
+            outer: {
+                if (i % 2 === 0) {
+                    if (i % 3 === 0) {
+                        result += "a";
+                    } else {
+                        result += "b";
+                    }
+                } else {
+                    if (i === 3)
+                        break outer;
+                    result += "c";
+                }
+                result += "d";
+            }
+        }
+        return result;
+    });
+)~~~"sv;
+
+TEST_CASE(jump_threading_through_empty_blocks)
+{
+    auto vm = JS::VM::create();
+
+    // NOTE: Redundant Mov elimination runs after threading and could leave a Jump-only block behind.
+    auto threaded = compile(*vm, nested_control_flow_source, { .redundant_mov_elimination = false });
+    EXPECT_EQ(count_labels_targeting_jumps(*threaded), 0u);
+
+    auto unthreaded = compile(*vm, nested_control_flow_source, { .jump_threading = false, .redundant_mov_elimination = false });
+    EXPECT(count_labels_targeting_jumps(*unthreaded) > 0);
+    EXPECT(threaded->bytecode.size() <= unthreaded->bytecode.size());
+
+    EXPECT(returns_string(*vm, nested_control_flow_source, {}, "adcdbdbdcd"sv));
+    EXPECT(returns_string(*vm, nested_control_flow_source, { .jump_threading = false }, "adcdbdbdcd"sv));
+}
+
+// The catch and finally blocks are never the target of a jump, only of the exception handler table.
+static constexpr auto exception_handlers_source = R"~~~(
+    (function () {
+        let log = [];
+        function thrower(value) { throw value; }
+        try {
+            log.push("try");
+            thrower("thrown");
+            log.push("unreachable");
+        } catch (e) {
+            log.push(e);
+        } finally {
+            log.push("finally");
+        }
+        try {
+            try {
+                thrower("inner");
+            } finally {
+                log.push("inner finally");
+            }
+        } catch (e) {
+            log.push(e);
+        }
+        return log.join();
+    });
+)~~~"sv;
+
+TEST_CASE(unreachable_block_elimination_keeps_handlers_and_finalizers)
+{
+    auto vm = JS::VM::create();
+
+    auto executable = compile(*vm, exception_handlers_source, {});
+    auto offsets = instruction_offsets(*executable);
+
+    size_t handler_count = 0;
+    size_t finalizer_count = 0;
+    for (auto const& handlers : executable->exception_handlers) {
+        if (handlers.handler_offset.has_value()) {
+            EXPECT(offsets.contains(*handlers.handler_offset));
+            ++handler_count;
+        }
+        if (handlers.finalizer_offset.has_value()) {
+            EXPECT(offsets.contains(*handlers.finalizer_offset));
+            ++finalizer_count;
+        }
+    }
+    EXPECT(handler_count > 0);
+    EXPECT(finalizer_count > 0);
+
+    auto expected = "try,thrown,finally,inner finally,inner"sv;
+    EXPECT(returns_string(*vm, exception_handlers_source, {}, expected));
+    EXPECT(returns_string(*vm, exception_handlers_source, { .unreachable_block_elimination = false }, expected));
+}
+
+// Each copy is followed by a branch and read in a successor block, so none of those moves may be dropped.
+static constexpr auto mov_read_in_successor_source = R"~~~(
+    (function () {
+        function f(condition) {
+            let value = 1;
+            let copy = value;
+            if (condition)
+                value = 2;
+            return copy * 10 + value;
+        }
+        function g(count) {
+            let previous = 0;
+            let current = 0;
+            for (let i = 1; i <= count; ++i) {
+                previous = current;
+                current = i;
+            }
+            return previous * 100 + current;
+        }
+        return `${f(true)},${f(false)},${g(3)}`;
+    });
+)~~~"sv;
+
+TEST_CASE(mov_read_in_successor_is_not_redundant)
+{
+    auto vm = JS::VM::create();
+
+    EXPECT(returns_string(*vm, mov_read_in_successor_source, {}, "12,11,203"sv));
+    EXPECT(returns_string(*vm, mov_read_in_successor_source, { .redundant_mov_elimination = false }, "12,11,203"sv));
+}
@@ -5,6 +5,7 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/Debug.h>
 #include <AK/Enumerate.h>
 #include <LibJS/Runtime/ArrayBuffer.h>
 #include <LibJS/Runtime/Date.h>
@@ -68,6 +69,52 @@ TESTJS_GLOBAL_FUNCTION(get_weak_map_size, getWeakMapSize)
     return JS::Value(weak_map.values().size());
 }
 
+TESTJS_GLOBAL_FUNCTION(get_shape_counts, getShapeCounts)
+{
+    auto& realm = *vm.current_realm();
+    auto const& shape_counts = realm.shape_counts();
+
+    auto result = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    result->define_direct_property("shapes"_utf16_fly_string, JS::Value(shape_counts.shapes), JS::default_attributes);
+    result->define_direct_property("dictionaryShapes"_utf16_fly_string, JS::Value(shape_counts.dictionary_shapes), JS::default_attributes);
+    return result;
+}
+
+TESTJS_GLOBAL_FUNCTION(get_rope_flattening_counts, getRopeFlatteningCounts)
+{
+    auto& realm = *vm.current_realm();
+    auto const& rope_flattening_counts = vm.rope_flattening_counts();
+
+    auto result = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    result->define_direct_property("ropes"_utf16_fly_string, JS::Value(rope_flattening_counts.ropes), JS::default_attributes);
+    result->define_direct_property("bytes"_utf16_fly_string, JS::Value(rope_flattening_counts.bytes), JS::default_attributes);
+    return result;
+}
+
+TESTJS_GLOBAL_FUNCTION(get_property_lookup_cache_statistics, getPropertyLookupCacheStatistics)
+{
+    // NOTE: Nothing is counted without JS_PROPERTY_LOOKUP_CACHE_DEBUG, so tests can skip themselves.
+    if constexpr (!JS_PROPERTY_LOOKUP_CACHE_DEBUG)
+        return JS::js_undefined();
+
+    auto& realm = *vm.current_realm();
+    auto const& statistics = vm.bytecode_interpreter().property_lookup_cache_statistics();
+
+    auto result = JS::Object::create(realm, realm.intrinsics().object_prototype());
+    result->define_direct_property("hits"_utf16_fly_string, JS::Value(statistics.hits), JS::default_attributes);
+    result->define_direct_property("megamorphicHits"_utf16_fly_string, JS::Value(statistics.megamorphic_hits), JS::default_attributes);
+    result->define_direct_property("misses"_utf16_fly_string, JS::Value(statistics.misses), JS::default_attributes);
+    result->define_direct_property("megamorphicTransitions"_utf16_fly_string, JS::Value(statistics.megamorphic_transitions), JS::default_attributes);
+    result->define_direct_property("megamorphicResets"_utf16_fly_string, JS::Value(statistics.megamorphic_resets), JS::default_attributes);
+    return result;
+}
+
+TESTJS_GLOBAL_FUNCTION(collect_young_generation, collectYoungGeneration)
+{
+    vm.heap().collect_garbage(GC::Heap::CollectionType::CollectYoungGeneration);
+    return JS::js_undefined();
+}
+
 TESTJS_GLOBAL_FUNCTION(mark_as_garbage, markAsGarbage)
 {
     auto argument = vm.argument(0);
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/StringBuilder.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/ProgramCache.h>
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/ECMAScriptFunctionObject.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+static ByteString cacheable_source()
+{
+    StringBuilder builder;
+    builder.append("function readMarker() { let total = 0; for (let i = 0; i < 100; ++i) total += marker; return total; }\n"sv);
+    builder.append("var result = readMarker() + readMarker();\n"sv);
+
+    // Pad the script so that it's large enough to end up in the program cache.
+    builder.append("/*"sv);
+    while (builder.length() < JS::ProgramCache::minimum_source_length)
+        builder.append(" padding"sv);
+    builder.append(" */\n"sv);
+    return builder.to_byte_string();
+}
+
+struct ScriptRun {
+    NonnullOwnPtr<JS::ExecutionContext> execution_context;
+    GC::Root<JS::Script> script;
+    GC::Root<JS::ECMAScriptFunctionObject> read_marker;
+    JS::Value result;
+};
+
+static ScriptRun run_in_new_realm(JS::VM& vm, StringView source, i32 marker)
+{
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(vm);
+    auto& realm = *execution_context->realm;
+    auto& global_object = realm.global_object();
+    global_object.define_direct_property("marker"_utf16_fly_string, JS::Value(marker), JS::default_attributes);
+
+    auto script = MUST(JS::Script::parse(source, realm, "https://example.com/cached.js"sv));
+
+    vm.push_execution_context(*execution_context);
+    auto result = vm.bytecode_interpreter().run(*script);
+    vm.pop_execution_context();
+    EXPECT(!result.is_error());
+
+    auto read_marker = MUST(global_object.get("readMarker"_utf16_fly_string));
+    return {
+        .execution_context = move(execution_context),
+        .script = script,
+        .read_marker = as<JS::ECMAScriptFunctionObject>(read_marker.as_object()),
+        .result = MUST(global_object.get("result"_utf16_fly_string)),
+    };
+}
+
+TEST_CASE(program_cache_does_not_share_bytecode_between_realms)
+{
+    auto vm = JS::VM::create();
+    auto source = cacheable_source();
+
+    auto first = run_in_new_realm(*vm, source, 1);
+    auto second = run_in_new_realm(*vm, source, 2);
+
+    // The second realm should get the cached AST...
+    EXPECT_EQ(&first.script->parse_node(), &second.script->parse_node());
+
+    // ...but neither its bytecode nor the global variable caches in it.
+    EXPECT(first.read_marker->bytecode_executable());
+    EXPECT(second.read_marker->bytecode_executable());
+    EXPECT_NE(first.read_marker->bytecode_executable().ptr(), second.read_marker->bytecode_executable().ptr());
+    EXPECT_EQ(first.result, JS::Value(200));
+    EXPECT_EQ(second.result, JS::Value(400));
+
+    // Running the script again in the first realm must still read that realm's global.
+    vm->push_execution_context(*first.execution_context);
+    auto again = MUST(JS::call(*vm, first.read_marker.ptr(), JS::js_undefined()));
+    vm->pop_execution_context();
+    EXPECT_EQ(again, JS::Value(100));
+}
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/JsonArray.h>
+#include <AK/JsonObject.h>
+#include <AK/JsonValue.h>
+#include <AK/ScopeGuard.h>
+#include <LibJS/Bytecode/Interpreter.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibJS/Runtime/ValueInlines.h>
+#include <LibJS/Script.h>
+#include <LibTest/TestCase.h>
+
+// Everything in the loop has a native fast path, so with the baseline tier enabled it never goes back to the interpreter
+// on its own.
+static constexpr auto profiled_source = R"~~~(
+function hot(count) {
+    let total = 0;
+    for (let i = 0; i < count; ++i)
+        total = (total + i) | 0;
+    return total;
+}
+function outer() {
+    let result = 0;
+    for (let round = 0; round < 10; ++round)
+        result = result ^ hot(2000000);
+    return result;
+}
+outer();
+)~~~"sv;
+
+static NonnullOwnPtr<JS::SamplingProfiler> profile(JS::VM& vm, StringView source)
+{
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(vm);
+    auto script = MUST(JS::Script::parse(source, *execution_context->realm, "profiled.js"sv));
+
+    vm.start_sampling_profiler(1);
+    vm.push_execution_context(*execution_context);
+    auto result = vm.bytecode_interpreter().run(*script);
+    vm.pop_execution_context();
+    EXPECT(!result.is_error());
+
+    return vm.stop_sampling_profiler().release_nonnull();
+}
+
+static void expect_samples_in_hot_function(JS::SamplingProfiler const& profiler)
+{
+    EXPECT(profiler.sample_count() > 0);
+
+    auto collapsed_stacks = profiler.to_collapsed_stacks();
+    bool found_hot_stack = false;
+    for (auto line : collapsed_stacks.bytes_as_string_view().split_view('\n')) {
+        // Each line is "frame;frame;frame count", outermost frame first.
+        auto separator = line.find_last(' ');
+        VERIFY(separator.has_value());
+        EXPECT(line.substring_view(*separator + 1).to_number<size_t>().has_value());
+
+        auto frames = line.substring_view(0, *separator).split_view(';');
+        EXPECT(!frames.is_empty());
+        if (frames.last().starts_with("hot (profiled.js:"sv)) {
+            EXPECT(frames.size() >= 3);
+            EXPECT(frames[frames.size() - 2].starts_with("outer (profiled.js:"sv));
+            found_hot_stack = true;
+        }
+    }
+    EXPECT(found_hot_stack);
+}
+
+TEST_CASE(samples_are_aggregated_into_collapsed_stacks)
+{
+    auto vm = JS::VM::create();
+    auto profiler = profile(*vm, profiled_source);
+    expect_samples_in_hot_function(*profiler);
+}
+
+TEST_CASE(samples_are_taken_in_baseline_code)
+{
+    JS::Bytecode::g_baseline_tier_enabled = true;
+    JS::Bytecode::g_baseline_tier_hotness_threshold = 0;
+    ScopeGuard guard = [] {
+        JS::Bytecode::g_baseline_tier_enabled = false;
+        JS::Bytecode::g_baseline_tier_hotness_threshold = 1000;
+    };
+
+    auto vm = JS::VM::create();
+    auto profiler = profile(*vm, profiled_source);
+    expect_samples_in_hot_function(*profiler);
+}
+
+TEST_CASE(chrome_cpu_profile_is_consistent)
+{
+    auto vm = JS::VM::create();
+    auto profiler = profile(*vm, profiled_source);
+
+    auto json = MUST(JsonValue::from_string(profiler->to_chrome_cpu_profile()));
+    EXPECT(json.is_object());
+    auto const& cpu_profile = json.as_object();
+
+    auto const& nodes = cpu_profile.get_array("nodes"sv).value();
+    auto const& samples = cpu_profile.get_array("samples"sv).value();
+    auto const& time_deltas = cpu_profile.get_array("timeDeltas"sv).value();
+    EXPECT_EQ(samples.size(), profiler->sample_count());
+    EXPECT_EQ(time_deltas.size(), samples.size());
+
+    size_t total_hit_count = 0;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        auto const& node = nodes[i].as_object();
+        EXPECT_EQ(node.get_u64("id"sv).value(), i + 1);
+        total_hit_count += node.get_u64("hitCount"sv).value();
+        for (auto const& child : node.get_array("children"sv)->values())
+            EXPECT(child.get_u64().value() <= nodes.size());
+    }
+    EXPECT_EQ(total_hit_count, samples.size());
+
+    for (auto const& sample : samples.values())
+        EXPECT(sample.get_u64().value() <= nodes.size());
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibJS/Runtime/AbstractOperations.h>
+#include <LibJS/Runtime/Array.h>
+#include <LibJS/Runtime/GlobalObject.h>
+#include <LibJS/Runtime/VM.h>
+#include <LibTest/TestCase.h>
+
+TEST_CASE(storing_through_a_held_indexed_properties_reference_remembers_the_object)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    // Make the array part of the old generation.
+    GC::Root<JS::Array> array = MUST(JS::Array::create(realm, 0));
+    vm->heap().collect_garbage(GC::Heap::CollectionType::CollectYoungGeneration);
+    EXPECT(array->is_marked());
+    EXPECT(!array->is_remembered());
+
+    // Getting hold of the indexed properties is not a store, the barrier has to wait for the actual write.
+    auto& indexed_properties = array->indexed_properties();
+
+    // Allocate while holding on to the reference, and let that allocation trigger a collection.
+    (void)JS::Object::create(realm, nullptr);
+    vm->heap().collect_garbage(GC::Heap::CollectionType::CollectYoungGeneration);
+    EXPECT(!array->is_remembered());
+
+    // Storing a young object into the old array must put the array in the remembered set.
+    auto young_object = JS::Object::create(realm, nullptr);
+    indexed_properties.append(young_object);
+    EXPECT(array->is_remembered());
+
+    vm->heap().collect_garbage(GC::Heap::CollectionType::CollectYoungGeneration);
+    EXPECT_EQ(&array->indexed_properties().get(0)->value.as_object(), young_object.ptr());
+    EXPECT(young_object->is_marked());
+}
+
+TEST_CASE(replacing_indexed_property_elements_remembers_the_object)
+{
+    auto vm = JS::VM::create();
+    auto execution_context = JS::create_simple_execution_context<JS::GlobalObject>(*vm);
+    auto& realm = *execution_context->realm;
+
+    GC::Root<JS::Array> array = MUST(JS::Array::create(realm, 0));
+    vm->heap().collect_garbage(GC::Heap::CollectionType::CollectYoungGeneration);
+    EXPECT(!array->is_remembered());
+
+    auto young_object = JS::Object::create(realm, nullptr);
+    array->set_indexed_property_elements({ young_object });
+    EXPECT(array->is_remembered());
+}
@@ -1469,3 +1469,252 @@ TEST_CASE(backreference_to_undefined_capture_groups)
         EXPECT(result2.capture_group_matches.first()[1].view.is_null());
     }
 }
+
+TEST_CASE(exponential_backtracking_falls_back_to_linear_engine)
+{
+    {
+        // Backtracking would take exponential time to find out that this doesn't match.
+        Regex<ECMA262> re("(a+)+$"sv, ECMAScriptFlags::Global);
+        EXPECT(re.parser_result.optimization_data.supports_linear_engine);
+
+        StringBuilder builder;
+        builder.append_repeated('a', 64);
+        builder.append('b');
+        auto subject = builder.to_byte_string();
+        auto result = re.match(subject.view());
+        EXPECT_EQ(result.success, false);
+    }
+    {
+        // Once switched over, the pattern must still find the same matches and captures.
+        Regex<ECMA262> re("(a+)+$"sv, ECMAScriptFlags::Global);
+        re.use_linear_engine = true;
+
+        auto result = re.match("xaaab"sv);
+        EXPECT_EQ(result.success, false);
+
+        result = re.match("xaaa"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 1u);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), "aaa"sv);
+        EXPECT_EQ(result.capture_group_matches.first()[0].view.to_byte_string(), "aaa"sv);
+    }
+    {
+        Regex<ECMA262> re("(a)|b"sv, ECMAScriptFlags::Global);
+        re.use_linear_engine = true;
+
+        auto result = re.match("cbac"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "b"sv);
+        EXPECT_EQ(result.matches[1].view.to_byte_string(), "a"sv);
+        EXPECT_EQ(result.capture_group_matches[1][0].view.to_byte_string(), "a"sv);
+    }
+    {
+        // Backreferences are left to the backtracking engine.
+        Regex<ECMA262> re("(a+)\\1"sv);
+        EXPECT(!re.parser_result.optimization_data.supports_linear_engine);
+    }
+}
+
+TEST_CASE(literal_prefix_search)
+{
+    {
+        Regex<ECMA262> re("(ab)c+d?"sv, ECMAScriptFlags::Global);
+        EXPECT_EQ(re.parser_result.optimization_data.literal_prefix, "abc"sv);
+    }
+    {
+        Regex<ECMA262> re("a*b"sv);
+        EXPECT(re.parser_result.optimization_data.literal_prefix.is_empty());
+    }
+
+    // Long enough for the prefix to be found in the middle of a vector, and in the leftover tail.
+    auto subject = "xxxxxxxxxxxxxxxxxxxxabxxxxxxxxabcdxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxabccxab"sv;
+    {
+        Regex<ECMA262> re("abc+"sv, ECMAScriptFlags::Global);
+        auto result = re.match(subject);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].column, 30u);
+        EXPECT_EQ(result.matches[1].view.to_byte_string(), "abcc"sv);
+        EXPECT_EQ(result.matches[1].column, 73u);
+    }
+    {
+        // The non-ASCII character forces UTF-16 storage.
+        auto utf16_subject = Utf16String::from_utf8(ByteString::formatted("\u00e9{}", subject));
+        Regex<ECMA262> re("abc+"sv, ECMAScriptFlags::Global);
+        auto result = re.match(utf16_subject.utf16_view());
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].column, 31u);
+        EXPECT_EQ(result.matches[1].column, 74u);
+    }
+    {
+        Regex<ECMA262> re("ABC+"sv, ECMAScriptFlags::Global | ECMAScriptFlags::Insensitive);
+        auto result = re.match(subject);
+        EXPECT_EQ(result.matches.size(), 2u);
+    }
+}
+
+static void expect_same_results(RegexResult const& expected, RegexResult const& actual)
+{
+    EXPECT_EQ(actual.success, expected.success);
+    EXPECT_EQ(actual.count, expected.count);
+    EXPECT_EQ(actual.matches.size(), expected.matches.size());
+    if (actual.matches.size() != expected.matches.size())
+        return;
+    for (size_t i = 0; i < expected.matches.size(); ++i) {
+        EXPECT_EQ(actual.matches[i].view.to_byte_string(), expected.matches[i].view.to_byte_string());
+        EXPECT_EQ(actual.matches[i].line, expected.matches[i].line);
+        EXPECT_EQ(actual.matches[i].column, expected.matches[i].column);
+        EXPECT_EQ(actual.matches[i].global_offset, expected.matches[i].global_offset);
+    }
+    EXPECT_EQ(actual.capture_group_matches.size(), expected.capture_group_matches.size());
+    if (actual.capture_group_matches.size() != expected.capture_group_matches.size())
+        return;
+    for (size_t i = 0; i < expected.capture_group_matches.size(); ++i) {
+        EXPECT_EQ(actual.capture_group_matches[i].size(), expected.capture_group_matches[i].size());
+        if (actual.capture_group_matches[i].size() != expected.capture_group_matches[i].size())
+            continue;
+        for (size_t j = 0; j < expected.capture_group_matches[i].size(); ++j) {
+            auto const& expected_group = expected.capture_group_matches[i][j];
+            auto const& actual_group = actual.capture_group_matches[i][j];
+            EXPECT_EQ(actual_group.view.is_null(), expected_group.view.is_null());
+            EXPECT_EQ(actual_group.view.to_byte_string(), expected_group.view.to_byte_string());
+            EXPECT_EQ(actual_group.column, expected_group.column);
+        }
+    }
+}
+
+TEST_CASE(threaded_bytecode_matches_like_bytecode)
+{
+    struct TestCase {
+        StringView pattern;
+        ECMAScriptOptions options;
+        Vector<StringView> subjects;
+    };
+
+    Vector<TestCase> test_cases {
+        { "a|b|cd"sv, ECMAScriptFlags::Global, { "xxcdab"sv, "c"sv, ""sv } },
+        { "(a+)(b*?)c"sv, ECMAScriptFlags::Global, { "aabbc aac abc"sv, "bbbc"sv } },
+        { "(\\w+)\\s\\1"sv, {}, { "hello hello world"sv, "no repeat here"sv } },
+        { "(?<year>\\d{4})-(?<month>\\d{2})"sv, ECMAScriptFlags::Global, { "2024-01 and 1999-12"sv, "24-01"sv } },
+        { "x(?=y)|x(?!z)"sv, ECMAScriptFlags::Global, { "xy xz xa"sv } },
+        { "(?<=\\$)\\d+(?<!0)"sv, ECMAScriptFlags::Global, { "$10 $25 $7"sv } },
+        { "\\bfoo\\B"sv, ECMAScriptFlags::Global, { "foobar foo food"sv } },
+        { "^ab$"sv, ECMAScriptFlags::Multiline, { "ab\nab"sv, "abc\nab"sv } },
+        { "[^aeiou]{2,3}"sv, ECMAScriptFlags::Global, { "strength"sv, "aeiou"sv } },
+        { "HELLO"sv, ECMAScriptFlags::Insensitive, { "say hello"sv } },
+        { "(a|ab)(c|bcd)(d*)"sv, {}, { "abcd"sv } },
+        { "(?:a{2})+?b"sv, ECMAScriptFlags::Global, { "aaaab aab ab"sv } },
+        { ".\\u{1F600}."sv, ECMAScriptFlags::Unicode, { "a\U0001F600b"sv } },
+    };
+
+    for (auto const& test_case : test_cases) {
+        Regex<ECMA262> reference(test_case.pattern, test_case.options);
+        Regex<ECMA262> threaded(test_case.pattern, test_case.options);
+        threaded.threaded_bytecode = regex::ThreadedByteCode::create(threaded.parser_result.bytecode);
+
+        for (auto subject : test_case.subjects) {
+            // Keep the reference on the plain bytecode no matter how often it's been used.
+            reference.match_count_for_tiering = 0;
+            auto expected = reference.match(subject);
+            EXPECT(!reference.threaded_bytecode);
+
+            expect_same_results(expected, threaded.match(subject));
+        }
+    }
+}
+
+TEST_CASE(threaded_bytecode_tiering)
+{
+    Regex<ECMA262> re("(\\d+)-(\\w)"sv, ECMAScriptFlags::Global);
+    auto subject = "12-a 345-b 6-c"sv;
+    auto expected = re.match(subject);
+    EXPECT_EQ(expected.matches.size(), 3u);
+
+    for (size_t i = 1; i < 2 * regex::c_threaded_bytecode_match_threshold; ++i) {
+        EXPECT_EQ(re.threaded_bytecode != nullptr, i >= regex::c_threaded_bytecode_match_threshold);
+        expect_same_results(expected, re.match(subject));
+    }
+    EXPECT(re.threaded_bytecode);
+}
+
+template<typename Parser>
+static void expect_same_results_with_linear_engine(StringView pattern, typename regex::ParserTraits<Parser>::OptionsType options, StringView subject)
+{
+    Regex<Parser> reference(pattern, options);
+    auto expected = reference.match(subject);
+    EXPECT(!reference.use_linear_engine);
+
+    Regex<Parser> linear(pattern, options);
+    linear.use_linear_engine = true;
+    expect_same_results(expected, linear.match(subject));
+}
+
+TEST_CASE(linear_engine_multi_unit_compares)
+{
+    {
+        // POSIX literals are compared a whole string at a time.
+        Regex<PosixExtended> re("(abc|abd)+x"sv);
+        EXPECT(!re.parser_result.optimization_data.supports_linear_engine);
+        re.use_linear_engine = true;
+
+        auto result = re.match("abdabcx"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT_EQ(result.matches.first().view.to_byte_string(), "abdabcx"sv);
+        EXPECT(re.linear_engine_gave_up);
+        EXPECT(!re.use_linear_engine);
+
+        // Once it has given up, the pattern stays on the backtracking engine.
+        result = re.match("abcabcabdx"sv);
+        EXPECT_EQ(result.success, true);
+        EXPECT(!re.use_linear_engine);
+    }
+    {
+        // Backreferences consume as many characters as the group they refer to.
+        Regex<ECMA262> re("(ab)\\1"sv, ECMAScriptFlags::Global);
+        re.use_linear_engine = true;
+
+        auto result = re.match("xabababy abab"sv);
+        EXPECT(re.linear_engine_gave_up);
+        EXPECT_EQ(result.matches.size(), 2u);
+        EXPECT_EQ(result.matches[0].view.to_byte_string(), "abab"sv);
+        EXPECT_EQ(result.matches[0].column, 1u);
+        EXPECT_EQ(result.matches[1].column, 9u);
+    }
+    expect_same_results_with_linear_engine<PosixExtended>("(abc|abd)+x"sv, {}, "abdabcx"sv);
+}
+
+TEST_CASE(linear_engine_multiline_anchors)
+{
+    auto multiline = ECMAScriptFlags::Global | ECMAScriptFlags::Multiline;
+    expect_same_results_with_linear_engine<ECMA262>("^a+$"sv, multiline, "aa\nb\naaa\nab"sv);
+    expect_same_results_with_linear_engine<ECMA262>("^(a|b)*$"sv, multiline, "ab\n\nba\nc"sv);
+    expect_same_results_with_linear_engine<ECMA262>("b$|^a"sv, multiline, "ab\nba\nb"sv);
+    expect_same_results_with_linear_engine<ECMA262>("^a+$"sv, ECMAScriptFlags::Global, "aa\naa"sv);
+
+    Regex<ECMA262> re("^a+$"sv, multiline);
+    re.use_linear_engine = true;
+    auto result = re.match("aa\nb\naaa"sv);
+    EXPECT(!re.linear_engine_gave_up);
+    EXPECT_EQ(result.matches.size(), 2u);
+    EXPECT_EQ(result.matches[1].view.to_byte_string(), "aaa"sv);
+    EXPECT_EQ(result.matches[1].line, 2u);
+}
+
+TEST_CASE(linear_engine_unicode_input)
+{
+    auto unicode = ECMAScriptFlags::Global | ECMAScriptFlags::Unicode;
+    auto subject = Utf16String::from_utf8("x\U0001F600b\U0001F600c ééc b"sv);
+    auto subject_view = subject.utf16_view();
+
+    for (auto pattern : { "(\\u{1F600}|b)+c"sv, "[^x ]+c"sv, ".c"sv, "\\u00e9*c"sv }) {
+        Regex<ECMA262> reference(pattern, unicode);
+        auto expected = reference.match(subject_view);
+        EXPECT(expected.success);
+        EXPECT(!reference.use_linear_engine);
+
+        Regex<ECMA262> linear(pattern, unicode);
+        linear.use_linear_engine = true;
+        expect_same_results(expected, linear.match(subject_view));
+        EXPECT(!linear.linear_engine_gave_up);
+    }
+}
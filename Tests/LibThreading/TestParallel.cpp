@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <AK/Atomic.h>
+#include <AK/FixedArray.h>
+#include <AK/Vector.h>
+#include <LibTest/TestCase.h>
+#include <LibThreading/Parallel.h>
+
+static thread_local bool s_is_calling_thread = false;
+
+TEST_CASE(every_index_is_visited_once)
+{
+    static constexpr size_t count = 10'000;
+
+    auto visits = MUST(FixedArray<Atomic<u32>>::create(count));
+    Threading::for_each_in_parallel(count, [&](size_t index) {
+        visits[index].fetch_add(1);
+    });
+
+    for (size_t i = 0; i < count; ++i)
+        EXPECT_EQ(visits[i].load(), 1u);
+}
+
+TEST_CASE(nothing_is_visited_for_zero_count)
+{
+    size_t calls = 0;
+    Threading::for_each_in_parallel(0, [&](size_t) { ++calls; });
+    EXPECT_EQ(calls, 0u);
+}
+
+TEST_CASE(small_counts_run_in_order_on_the_calling_thread)
+{
+    s_is_calling_thread = true;
+
+    Vector<size_t> indices;
+    Threading::for_each_in_parallel(
+        31, [&](size_t index) {
+            EXPECT(s_is_calling_thread);
+            indices.append(index);
+        },
+        32);
+
+    EXPECT_EQ(indices.size(), 31u);
+    for (size_t i = 0; i < indices.size(); ++i)
+        EXPECT_EQ(indices[i], i);
+
+    s_is_calling_thread = false;
+}
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/MemoryStream.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/Validator.h>
+
+struct TestInstance {
+    NonnullRefPtr<Wasm::Module> module;
+    NonnullOwnPtr<Wasm::ModuleInstance> instance;
+};
+
+static Wasm::ParseResult<NonnullRefPtr<Wasm::Module>> parse(ReadonlyBytes bytes)
+{
+    FixedMemoryStream stream { bytes };
+    return Wasm::Module::parse(stream);
+}
+
+static TestInstance instantiate(Wasm::AbstractMachine& machine, ReadonlyBytes bytes)
+{
+    auto module = MUST(parse(bytes));
+    auto instance = MUST(machine.instantiate(*module, {}));
+    return { move(module), move(instance) };
+}
+
+static Wasm::FunctionAddress export_named(Wasm::ModuleInstance const& instance, StringView name)
+{
+    for (auto const& entry : instance.exports()) {
+        if (entry.name() == name)
+            return entry.value().get<Wasm::FunctionAddress>();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// (module
+//   (memory 1 1 shared)
+//   (func (export "wait") (param i32 i32) (result i32)
+//     (memory.atomic.wait32 (local.get 0) (local.get 1) (i64.const 0))))
+static constexpr u8 wait_module[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x07, 0x01, 0x60, 0x02, 0x7f, 0x7f, 0x01, 0x7f,
+    0x03, 0x02, 0x01, 0x00,
+    0x05, 0x04, 0x01, 0x03, 0x01, 0x01,
+    0x07, 0x08, 0x01, 0x04, 'w', 'a', 'i', 't', 0x00, 0x00,
+    0x0a, 0x0e, 0x01, 0x0c, 0x00, 0x20, 0x00, 0x20, 0x01, 0x42, 0x00, 0xfe, 0x01, 0x02, 0x00, 0x0b
+};
+
+TEST_CASE(wait_traps_where_the_agent_cannot_block)
+{
+    Wasm::AbstractMachine machine;
+    auto test = instantiate(machine, { wait_module, sizeof(wait_module) });
+    auto wait = export_named(*test.instance, "wait"sv);
+
+    auto call = [&](u32 address, u32 expected) {
+        return machine.invoke(wait, { Wasm::Value(address), Wasm::Value(expected) });
+    };
+
+    // The memory is all zeroes, so expecting a 1 is "not-equal", and expecting a 0 times out right away.
+    auto not_equal = call(0, 1);
+    EXPECT(!not_equal.is_trap());
+    EXPECT_EQ(not_equal.values().first().to<i32>(), 1);
+    auto timed_out = call(0, 0);
+    EXPECT(!timed_out.is_trap());
+    EXPECT_EQ(timed_out.values().first().to<i32>(), 2);
+
+    machine.agent_can_block = [] { return false; };
+    EXPECT(call(0, 1).is_trap());
+    EXPECT(call(0, 0).is_trap());
+
+    machine.agent_can_block = [] { return true; };
+    EXPECT(!call(0, 0).is_trap());
+}
+
+static void append_unsigned(Vector<u8>& bytes, u32 value)
+{
+    do {
+        u8 byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0)
+            byte |= 0x80;
+        bytes.append(byte);
+    } while (value != 0);
+}
+
+static void append_section(Vector<u8>& bytes, u8 id, Vector<u8> const& contents)
+{
+    bytes.append(id);
+    append_unsigned(bytes, contents.size());
+    bytes.extend(contents);
+}
+
+struct ExportedFunction {
+    StringView name;
+    u8 type_index { 0 };
+    Vector<u8> body;
+};
+
+// Builds a module with `(memory 1 1 shared)` that exports each of `functions` under its name.
+// Type 0 is `(param i32 i32 i32) (result i32)`, and type 1 is `(param i32) (result i64)`.
+static Vector<u8> build_module(Vector<ExportedFunction> const& functions)
+{
+    Vector<u8> bytes { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00 };
+
+    append_section(bytes, 0x01, { 0x02, 0x60, 0x03, 0x7f, 0x7f, 0x7f, 0x01, 0x7f, 0x60, 0x01, 0x7f, 0x01, 0x7e });
+
+    Vector<u8> types;
+    append_unsigned(types, functions.size());
+    for (auto const& function : functions)
+        types.append(function.type_index);
+    append_section(bytes, 0x03, types);
+
+    append_section(bytes, 0x05, { 0x01, 0x03, 0x01, 0x01 });
+
+    Vector<u8> exports;
+    append_unsigned(exports, functions.size());
+    for (u32 i = 0; i < functions.size(); ++i) {
+        append_unsigned(exports, functions[i].name.length());
+        exports.append(functions[i].name.bytes().data(), functions[i].name.length());
+        exports.append(0x00);
+        append_unsigned(exports, i);
+    }
+    append_section(bytes, 0x07, exports);
+
+    Vector<u8> code;
+    append_unsigned(code, functions.size());
+    for (auto const& function : functions) {
+        append_unsigned(code, function.body.size() + 1);
+        code.append(0x00);
+        code.extend(function.body);
+    }
+    append_section(bytes, 0x0a, code);
+
+    return bytes;
+}
+
+static Vector<ExportedFunction> atomic_functions()
+{
+    return {
+        // (i32.atomic.load (local.get 0))
+        { "load"sv, 0, { 0x20, 0x00, 0xfe, 0x10, 0x02, 0x00, 0x0b } },
+        // (i32.atomic.store (local.get 0) (local.get 1)) (i32.const 0)
+        { "store"sv, 0, { 0x20, 0x00, 0x20, 0x01, 0xfe, 0x17, 0x02, 0x00, 0x41, 0x00, 0x0b } },
+        // (i32.atomic.load8_u (local.get 0))
+        { "load8_u"sv, 0, { 0x20, 0x00, 0xfe, 0x12, 0x00, 0x00, 0x0b } },
+        // (i32.atomic.load16_u (local.get 0))
+        { "load16_u"sv, 0, { 0x20, 0x00, 0xfe, 0x13, 0x01, 0x00, 0x0b } },
+        // (i64.atomic.load32_u (local.get 0))
+        { "i64_load32_u"sv, 1, { 0x20, 0x00, 0xfe, 0x16, 0x02, 0x00, 0x0b } },
+        // (i32.atomic.rmw8.add_u (local.get 0) (local.get 1))
+        { "rmw8_add_u"sv, 0, { 0x20, 0x00, 0x20, 0x01, 0xfe, 0x20, 0x00, 0x00, 0x0b } },
+        // (i32.atomic.rmw.cmpxchg (local.get 0) (local.get 1) (local.get 2))
+        { "cmpxchg"sv, 0, { 0x20, 0x00, 0x20, 0x01, 0x20, 0x02, 0xfe, 0x48, 0x02, 0x00, 0x0b } },
+    };
+}
+
+struct AtomicsTest {
+    AtomicsTest()
+        : bytes(build_module(atomic_functions()))
+        , test(instantiate(machine, bytes.span()))
+    {
+    }
+
+    Wasm::Result call(StringView name, u32 address, u32 a = 0, u32 b = 0)
+    {
+        auto function = export_named(*test.instance, name);
+        if (name == "i64_load32_u"sv)
+            return machine.invoke(function, { Wasm::Value(address) });
+        return machine.invoke(function, { Wasm::Value(address), Wasm::Value(a), Wasm::Value(b) });
+    }
+
+    i32 call_i32(StringView name, u32 address, u32 a = 0, u32 b = 0)
+    {
+        auto result = call(name, address, a, b);
+        VERIFY(!result.is_trap());
+        return result.values().first().to<i32>();
+    }
+
+    Wasm::AbstractMachine machine;
+    Vector<u8> bytes;
+    TestInstance test;
+};
+
+TEST_CASE(atomic_accesses_must_be_naturally_aligned)
+{
+    auto validate = [](u8 align) {
+        // (i32.atomic.load align=(1 << align) (local.get 0))
+        auto module = MUST(parse(build_module({ { "load"sv, 0, { 0x20, 0x00, 0xfe, 0x10, align, 0x00, 0x0b } } }).span()));
+        Wasm::AbstractMachine machine;
+        return machine.validate(*module);
+    };
+
+    EXPECT(!validate(2).is_error());
+    // Unlike plain loads, atomics don't accept a smaller alignment hint, nor a larger one.
+    EXPECT(validate(0).is_error());
+    EXPECT(validate(1).is_error());
+    EXPECT(validate(3).is_error());
+}
+
+TEST_CASE(misaligned_addresses_trap)
+{
+    AtomicsTest test;
+
+    EXPECT(!test.call("load"sv, 0).is_trap());
+    EXPECT(!test.call("load"sv, 4).is_trap());
+    EXPECT(test.call("load"sv, 1).is_trap());
+    EXPECT(test.call("load"sv, 2).is_trap());
+    EXPECT(test.call("store"sv, 3, 42).is_trap());
+    EXPECT(test.call("cmpxchg"sv, 6, 0, 42).is_trap());
+    EXPECT_EQ(test.call_i32("load"sv, 4), 0);
+
+    // Byte accesses are always aligned.
+    EXPECT(!test.call("load8_u"sv, 3).is_trap());
+    EXPECT(!test.call("rmw8_add_u"sv, 3, 1).is_trap());
+
+    // Aligned addresses past the end are still out of bounds.
+    EXPECT(!test.call("load"sv, Wasm::Constants::page_size - 4).is_trap());
+    EXPECT(test.call("load"sv, Wasm::Constants::page_size).is_trap());
+}
+
+TEST_CASE(cmpxchg_returns_the_old_value)
+{
+    AtomicsTest test;
+    test.call_i32("store"sv, 8, 5);
+
+    // The expected value matches, so the replacement is stored.
+    EXPECT_EQ(test.call_i32("cmpxchg"sv, 8, 5, 7), 5);
+    EXPECT_EQ(test.call_i32("load"sv, 8), 7);
+
+    // It doesn't match any more, so memory is left alone.
+    EXPECT_EQ(test.call_i32("cmpxchg"sv, 8, 5, 9), 7);
+    EXPECT_EQ(test.call_i32("load"sv, 8), 7);
+}
+
+TEST_CASE(narrow_accesses_zero_extend)
+{
+    AtomicsTest test;
+    test.call_i32("store"sv, 0, 0xffffffff);
+
+    EXPECT_EQ(test.call_i32("load8_u"sv, 0), 0xff);
+    EXPECT_EQ(test.call_i32("load16_u"sv, 0), 0xffff);
+
+    auto wide = test.call("i64_load32_u"sv, 0);
+    EXPECT(!wide.is_trap());
+    EXPECT_EQ(wide.values().first().to<i64>(), 0xffffffffll);
+
+    // The old byte comes back zero-extended, and the carry doesn't spill into the next byte.
+    EXPECT_EQ(test.call_i32("rmw8_add_u"sv, 0, 1), 0xff);
+    EXPECT_EQ(test.call_i32("load"sv, 0), static_cast<i32>(0xffffff00));
+}
+
+TEST_CASE(shared_tables_are_rejected_by_the_parser)
+{
+    // (module (table 1 1 funcref)), with the limits flag set to 0x01 (unshared) or 0x03 (shared).
+    auto table_module = [](u8 flag) -> Vector<u8> {
+        return { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00, 0x04, 0x05, 0x01, 0x70, flag, 0x01, 0x01 };
+    };
+
+    EXPECT(!parse(table_module(0x01).span()).is_error());
+    EXPECT(parse(table_module(0x03).span()).is_error());
+}
+
+TEST_CASE(synthetic_opcodes_live_under_the_0xff_prefix)
+{
+    // 0xfe is the threads proposal's prefix, so the interpreter's own instructions must not use it.
+    EXPECT_EQ(Wasm::Instructions::memory_atomic_notify.value() >> 56, 0xfeu);
+    EXPECT_EQ(Wasm::Instructions::SyntheticInstructionBase.value() >> 56, 0xffu);
+
+    Vector<u64> synthetic_opcodes;
+#define M(name, ...) synthetic_opcodes.append(Wasm::Instructions::name.value());
+    ENUMERATE_SYNTHETIC_INSTRUCTION_OPCODES(M)
+#undef M
+    EXPECT_EQ(synthetic_opcodes.size(), Wasm::Instructions::SyntheticInstructionCount);
+    for (size_t i = 0; i < synthetic_opcodes.size(); ++i)
+        EXPECT_EQ(synthetic_opcodes[i], Wasm::Instructions::SyntheticInstructionBase.value() + i);
+
+    // Wasm itself has no 0xff prefix, so a module can't name a synthetic instruction.
+    auto module = build_module({ { "synthetic"sv, 0, { 0xff, 0x00, 0x0b } } });
+    EXPECT(parse(module.span()).is_error());
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Atomic.h>
+#include <AK/HashTable.h>
+#include <AK/MemoryStream.h>
+#include <LibThreading/Thread.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+
+using Wasm::MemoryInstance;
+
+static Wasm::MemoryType memory_type(u64 min, u64 max, bool is_shared = false)
+{
+    return Wasm::MemoryType { Wasm::Limits(Wasm::AddressType::I32, min, max, is_shared) };
+}
+
+TEST_CASE(growing_keeps_data_in_place)
+{
+    auto memory = MUST(MemoryInstance::create(memory_type(1, 4)));
+    EXPECT_EQ(memory.size(), Wasm::Constants::page_size);
+    EXPECT_EQ(memory.data().size(), memory.size());
+
+    auto* data = memory.data().data();
+    data[0] = 42;
+    data[memory.size() - 1] = 43;
+
+    EXPECT(memory.grow(2 * Wasm::Constants::page_size).has_value());
+    EXPECT_EQ(memory.size(), 3 * Wasm::Constants::page_size);
+    EXPECT_EQ(memory.type().limits().min(), 3u);
+    EXPECT_EQ(memory.data().data(), data);
+    EXPECT_EQ(data[0], 42);
+    EXPECT_EQ(data[Wasm::Constants::page_size - 1], 43);
+    for (size_t i = Wasm::Constants::page_size; i < memory.size(); ++i) {
+        if (data[i] != 0) {
+            FAIL("Grown pages are not zeroed");
+            break;
+        }
+    }
+
+    EXPECT(!memory.grow(2 * Wasm::Constants::page_size).has_value());
+    EXPECT_EQ(memory.size(), 3 * Wasm::Constants::page_size);
+    EXPECT(memory.grow(Wasm::Constants::page_size).has_value());
+    EXPECT_EQ(memory.data().data(), data);
+}
+
+TEST_CASE(growing_returns_the_previous_size)
+{
+    auto memory = MUST(MemoryInstance::create(memory_type(1, 3)));
+    EXPECT_EQ(memory.grow(0), Wasm::Constants::page_size);
+    EXPECT_EQ(memory.grow(Wasm::Constants::page_size), Wasm::Constants::page_size);
+    EXPECT_EQ(memory.grow(Wasm::Constants::page_size), 2 * Wasm::Constants::page_size);
+    EXPECT(!memory.grow(Wasm::Constants::page_size).has_value());
+}
+
+TEST_CASE(concurrent_growth_of_a_shared_memory)
+{
+    static constexpr size_t thread_count = 4;
+    static constexpr size_t grows_per_thread = 8;
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA auto memory = MUST(MemoryInstance::create(memory_type(0, thread_count * grows_per_thread, true)));
+    EXPECT(memory.is_shared());
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<size_t> hook_calls { 0 };
+    memory.successful_grow_hook = [&] { hook_calls.fetch_add(1); };
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA Optional<size_t> previous_sizes[thread_count][grows_per_thread];
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 0; i < thread_count; ++i) {
+        threads.append(Threading::Thread::construct([&memory, &previous_sizes, i] {
+            for (size_t j = 0; j < grows_per_thread; ++j)
+                previous_sizes[i][j] = memory.grow(Wasm::Constants::page_size);
+            return 0;
+        }));
+        threads.last()->start();
+    }
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    // Every grow saw a different size before it, so none of them were lost.
+    HashTable<size_t> seen_sizes;
+    for (auto const& sizes : previous_sizes) {
+        for (auto const& size : sizes) {
+            EXPECT(size.has_value());
+            EXPECT_EQ(seen_sizes.set(*size), HashSetResult::InsertedNewEntry);
+        }
+    }
+    EXPECT_EQ(memory.size(), thread_count * grows_per_thread * Wasm::Constants::page_size);
+    EXPECT_EQ(memory.data().size(), memory.size());
+    EXPECT(!memory.grow(Wasm::Constants::page_size).has_value());
+
+    // None of that happened on the thread that created the memory.
+    EXPECT_EQ(hook_calls.load(), 0u);
+    EXPECT(memory.grow(0).has_value());
+    EXPECT_EQ(hook_calls.load(), 0u);
+}
+
+TEST_CASE(moving_keeps_data_in_place)
+{
+    auto memory = MUST(MemoryInstance::create(memory_type(1, 2)));
+    auto* data = memory.data().data();
+
+    auto moved = move(memory);
+    EXPECT_EQ(moved.data().data(), data);
+    EXPECT(moved.grow(Wasm::Constants::page_size).has_value());
+    EXPECT_EQ(moved.data().data(), data);
+}
+
+// (module
+//   (memory 1 2)
+//   (func (export "load") (param i32) (result i32) (i32.load (local.get 0)))
+//   (func (export "load_far") (param i32) (result i32) (i32.load offset=4294967295 (local.get 0))))
+static constexpr u8 load_module[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x06, 0x01, 0x60, 0x01, 0x7f, 0x01, 0x7f,
+    0x03, 0x03, 0x02, 0x00, 0x00,
+    0x05, 0x04, 0x01, 0x01, 0x01, 0x02,
+    0x07, 0x13, 0x02, 0x04, 'l', 'o', 'a', 'd', 0x00, 0x00, 0x08, 'l', 'o', 'a', 'd', '_', 'f', 'a', 'r', 0x00, 0x01,
+    0x0a, 0x14, 0x02,
+    0x06, 0x00, 0x20, 0x00, 0x28, 0x02, 0x00, 0x0b,
+    0x0b, 0x00, 0x20, 0x00, 0x28, 0x02, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x0b
+};
+
+static Wasm::FunctionAddress export_named(Wasm::ModuleInstance const& instance, StringView name)
+{
+    for (auto const& entry : instance.exports()) {
+        if (entry.name() == name)
+            return entry.value().get<Wasm::FunctionAddress>();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+// Native code leaves out its bounds checks where the memory has a guard region, and relies on the fault handler instead.
+TEST_CASE(out_of_bounds_accesses_trap_in_baseline_code)
+{
+    Wasm::AbstractMachine machine;
+    machine.enable_baseline_compiler();
+
+    FixedMemoryStream stream { ReadonlyBytes { load_module, sizeof(load_module) } };
+    auto module = MUST(Wasm::Module::parse(stream));
+    auto instance = MUST(machine.instantiate(*module, {}));
+    auto load = export_named(*instance, "load"sv);
+    auto load_far = export_named(*instance, "load_far"sv);
+
+    auto& memory = *machine.store().get(instance->memories().first());
+    memory.data()[Wasm::Constants::page_size - 4] = 0x2a;
+
+    auto call = [&](Wasm::FunctionAddress function, u32 address) {
+        return machine.invoke(function, { Wasm::Value(address) });
+    };
+
+    for (size_t i = 0; i < 2; ++i) {
+        auto result = call(load, Wasm::Constants::page_size - 4);
+        EXPECT(!result.is_trap());
+        EXPECT_EQ(result.values().first().to<i32>(), 0x2a);
+
+        EXPECT(call(load, Wasm::Constants::page_size - 3).is_trap());
+        EXPECT(call(load, NumericLimits<u32>::max()).is_trap());
+        EXPECT(call(load_far, 0).is_trap());
+        EXPECT(call(load_far, NumericLimits<u32>::max()).is_trap());
+    }
+
+    EXPECT(memory.grow(Wasm::Constants::page_size).has_value());
+    auto result = call(load, Wasm::Constants::page_size);
+    EXPECT(!result.is_trap());
+    EXPECT_EQ(result.values().first().to<i32>(), 0);
+    EXPECT(!call(load, Wasm::Constants::page_size - 3).is_trap());
+    EXPECT(call(load, 2 * Wasm::Constants::page_size - 3).is_trap());
+}
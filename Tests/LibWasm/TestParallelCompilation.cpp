@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/MemoryStream.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/Validator.h>
+
+// Enough functions that parsing and validating the code section is spread across threads.
+static constexpr u32 function_count = 1000;
+
+static void append_unsigned(Vector<u8>& bytes, u32 value)
+{
+    do {
+        u8 byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0)
+            byte |= 0x80;
+        bytes.append(byte);
+    } while (value != 0);
+}
+
+static void append_signed(Vector<u8>& bytes, i32 value)
+{
+    for (;;) {
+        u8 byte = value & 0x7f;
+        value >>= 7;
+        if ((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40))) {
+            bytes.append(byte);
+            return;
+        }
+        bytes.append(byte | 0x80);
+    }
+}
+
+static void append_section(Vector<u8>& bytes, u8 id, Vector<u8> const& contents)
+{
+    bytes.append(id);
+    append_unsigned(bytes, contents.size());
+    bytes.extend(contents);
+}
+
+enum class Body {
+    Valid,
+    UnknownInstruction,
+    TrailingBytes,
+    WrongResultType,
+    ExtraResult,
+};
+
+// Builds a module in which function `i` is `(func (result i32) (i32.const i))`, except where `bodies` says otherwise.
+// The first function is exported as "first", and the last one as "last".
+static Vector<u8> build_module(HashMap<u32, Body> const& bodies = {})
+{
+    Vector<u8> bytes { 0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00 };
+
+    append_section(bytes, 0x01, { 0x01, 0x60, 0x00, 0x01, 0x7f });
+
+    Vector<u8> functions;
+    append_unsigned(functions, function_count);
+    for (u32 i = 0; i < function_count; ++i)
+        functions.append(0x00);
+    append_section(bytes, 0x03, functions);
+
+    Vector<u8> exports { 0x02, 0x05, 'f', 'i', 'r', 's', 't', 0x00, 0x00, 0x04, 'l', 'a', 's', 't', 0x00 };
+    append_unsigned(exports, function_count - 1);
+    append_section(bytes, 0x07, exports);
+
+    Vector<u8> code;
+    append_unsigned(code, function_count);
+    for (u32 i = 0; i < function_count; ++i) {
+        Vector<u8> body { 0x00 };
+        switch (bodies.get(i).value_or(Body::Valid)) {
+        case Body::Valid:
+            body.append(0x41);
+            append_signed(body, static_cast<i32>(i));
+            body.append(0x0b);
+            break;
+        case Body::UnknownInstruction:
+            body.extend({ 0x27, 0x0b });
+            break;
+        case Body::TrailingBytes:
+            body.extend({ 0x41, 0x00, 0x0b, 0x01 });
+            break;
+        case Body::WrongResultType:
+            body.extend({ 0x42, 0x00, 0x0b });
+            break;
+        case Body::ExtraResult:
+            body.extend({ 0x41, 0x00, 0x41, 0x00, 0x0b });
+            break;
+        }
+        append_unsigned(code, body.size());
+        code.extend(body);
+    }
+    append_section(bytes, 0x0a, code);
+
+    return bytes;
+}
+
+static Wasm::ParseResult<NonnullRefPtr<Wasm::Module>> parse(Vector<u8> const& bytes)
+{
+    FixedMemoryStream stream { bytes.span() };
+    return Wasm::Module::parse(stream);
+}
+
+static Optional<ByteString> validation_error(Vector<u8> const& bytes)
+{
+    auto module = MUST(parse(bytes));
+    Wasm::AbstractMachine machine;
+    if (auto result = machine.validate(*module); result.is_error())
+        return result.error().error_string;
+    return {};
+}
+
+static Wasm::FunctionAddress export_named(Wasm::ModuleInstance const& instance, StringView name)
+{
+    for (auto const& entry : instance.exports()) {
+        if (entry.name() == name)
+            return entry.value().get<Wasm::FunctionAddress>();
+    }
+    VERIFY_NOT_REACHED();
+}
+
+TEST_CASE(every_function_is_parsed_and_validated)
+{
+    auto module = MUST(parse(build_module()));
+    EXPECT_EQ(module->code_section().functions().size(), function_count);
+
+    Wasm::AbstractMachine machine;
+    auto instance = MUST(machine.instantiate(*module, {}));
+    EXPECT_EQ(module->validation_status(), Wasm::Module::ValidationStatus::Valid);
+
+    for (auto const& code : module->code_section().functions())
+        EXPECT(!code.func().body().compiled_instructions.dispatches.is_empty());
+
+    auto first = machine.invoke(export_named(*instance, "first"sv), {});
+    EXPECT(!first.is_trap());
+    EXPECT_EQ(first.values().first().to<i32>(), 0);
+
+    auto last = machine.invoke(export_named(*instance, "last"sv), {});
+    EXPECT(!last.is_trap());
+    EXPECT_EQ(last.values().first().to<i32>(), static_cast<i32>(function_count - 1));
+}
+
+TEST_CASE(parse_errors_are_reported_in_function_order)
+{
+    auto first_error = parse(build_module({ { 10, Body::UnknownInstruction } }));
+    EXPECT(first_error.is_error());
+
+    auto second_error = parse(build_module({ { 900, Body::TrailingBytes } }));
+    EXPECT(second_error.is_error());
+    EXPECT_NE(first_error.error(), second_error.error());
+
+    auto both_errors = parse(build_module({ { 10, Body::UnknownInstruction }, { 900, Body::TrailingBytes } }));
+    EXPECT(both_errors.is_error());
+    EXPECT_EQ(both_errors.error(), first_error.error());
+}
+
+TEST_CASE(validation_errors_are_reported_in_function_order)
+{
+    EXPECT(!validation_error(build_module()).has_value());
+
+    auto first_error = validation_error(build_module({ { 10, Body::ExtraResult } }));
+    EXPECT(first_error.has_value());
+
+    auto second_error = validation_error(build_module({ { 900, Body::WrongResultType } }));
+    EXPECT(second_error.has_value());
+    EXPECT_NE(first_error, second_error);
+
+    auto both_errors = validation_error(build_module({ { 10, Body::ExtraResult }, { 900, Body::WrongResultType } }));
+    EXPECT_EQ(both_errors, first_error);
+}
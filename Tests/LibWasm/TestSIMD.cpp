@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/SIMD.h>
+#include <AK/Vector.h>
+#include <LibWasm/AbstractMachine/Operators.h>
+
+using namespace AK::SIMD;
+using namespace Wasm::Operators;
+
+TEST_CASE(i8x16_add_sat_s)
+{
+    i8x16 lhs { 127, -128, 100, -100, 1, -1, 0, 50, 127, -128, 100, -100, 1, -1, 0, 50 };
+    i8x16 rhs { 1, -1, 100, -100, -1, 1, 0, 50, 127, -128, 27, -28, 126, -127, 0, 77 };
+    i8x16 expected { 127, -128, 127, -128, 0, 0, 0, 100, 127, -128, 127, -128, 127, -128, 0, 127 };
+
+    auto result = bit_cast<i8x16>(VectorIntegerBinaryOp<16, SaturatingOp<i8, Add>> {}(bit_cast<u128>(lhs), bit_cast<u128>(rhs)));
+    for (size_t i = 0; i < 16; ++i)
+        EXPECT_EQ(result[i], expected[i]);
+}
+
+TEST_CASE(i16x8_sub_sat_u)
+{
+    u16x8 lhs { 0, 1, 65535, 100, 200, 0, 65535, 300 };
+    u16x8 rhs { 1, 1, 65535, 200, 100, 65535, 0, 299 };
+    u16x8 expected { 0, 0, 0, 0, 100, 0, 65535, 1 };
+
+    auto result = bit_cast<u16x8>(VectorIntegerBinaryOp<8, SaturatingOp<u16, Subtract>, MakeUnsigned> {}(bit_cast<u128>(lhs), bit_cast<u128>(rhs)));
+    for (size_t i = 0; i < 8; ++i)
+        EXPECT_EQ(result[i], expected[i]);
+}
+
+TEST_CASE(i32x4_abs_keeps_minimum_value)
+{
+    i32x4 value { -1, NumericLimits<i32>::min(), 42, 0 };
+    auto result = bit_cast<i32x4>(VectorIntegerUnaryOp<4, Absolute> {}(bit_cast<u128>(value)));
+    EXPECT_EQ(result[0], 1);
+    EXPECT_EQ(result[1], NumericLimits<i32>::min());
+    EXPECT_EQ(result[2], 42);
+    EXPECT_EQ(result[3], 0);
+}
+
+TEST_CASE(i16x8_narrow_i32x4_s)
+{
+    i32x4 lhs { 70000, -70000, 32767, -32768 };
+    i32x4 rhs { 1, -1, 40000, -40000 };
+    i16x8 expected { 32767, -32768, 32767, -32768, 1, -1, 32767, -32768 };
+
+    auto result = bit_cast<i16x8>(VectorNarrow<8, i16> {}(bit_cast<u128>(lhs), bit_cast<u128>(rhs)));
+    for (size_t i = 0; i < 8; ++i)
+        EXPECT_EQ(result[i], expected[i]);
+}
+
+TEST_CASE(f32x4_min_max_signed_zero_and_nan)
+{
+    f32x4 lhs { -0.0f, 0.0f, NAN, 1.0f };
+    f32x4 rhs { 0.0f, -0.0f, 1.0f, 2.0f };
+
+    auto minimum = bit_cast<f32x4>(VectorFloatBinaryOp<4, Minimum> {}(bit_cast<u128>(lhs), bit_cast<u128>(rhs)));
+    EXPECT(__builtin_signbit(minimum[0]));
+    EXPECT(__builtin_signbit(minimum[1]));
+    EXPECT(__builtin_isnan(minimum[2]));
+    EXPECT_EQ(minimum[3], 1.0f);
+
+    auto maximum = bit_cast<f32x4>(VectorFloatBinaryOp<4, Maximum> {}(bit_cast<u128>(lhs), bit_cast<u128>(rhs)));
+    EXPECT(!__builtin_signbit(maximum[0]));
+    EXPECT(!__builtin_signbit(maximum[1]));
+    EXPECT(__builtin_isnan(maximum[2]));
+    EXPECT_EQ(maximum[3], 2.0f);
+}
+
+TEST_CASE(i32x4_dot_i16x8_s)
+{
+    i16x8 lhs { 1, 2, -3, 4, 32767, 32767, -32768, -32768 };
+    i16x8 rhs { 5, 6, 7, -8, 32767, 32767, -32768, -32768 };
+
+    auto result = bit_cast<i32x4>(VectorDotProduct<4> {}(bit_cast<u128>(lhs), bit_cast<u128>(rhs)));
+    EXPECT_EQ(result[0], 17);
+    EXPECT_EQ(result[1], -53);
+    EXPECT_EQ(result[2], 2147352578);
+    // 2 * 2^30 wraps around, as the spec asks for.
+    EXPECT_EQ(result[3], NumericLimits<i32>::min());
+}
+
+// Runs the operator over a buffer of vectors the way a Wasm loop would, feeding each result into the next
+// operation so that the work can't be hoisted out of the loop.
+template<typename Op>
+static void run_binary_benchmark()
+{
+    static constexpr size_t vector_count = 4096;
+    static constexpr size_t iteration_count = 1000;
+
+    Vector<u128> vectors;
+    vectors.resize(vector_count);
+    for (size_t i = 0; i < vector_count; ++i)
+        vectors[i] = bit_cast<u128>(u32x4 { static_cast<u32>(i), static_cast<u32>(i * 3), static_cast<u32>(i * 5), static_cast<u32>(i * 7) });
+
+    u128 accumulator = vectors[0];
+    for (size_t iteration = 0; iteration < iteration_count; ++iteration) {
+        for (auto const& vector : vectors)
+            accumulator = Op {}(accumulator, vector);
+        AK::taint_for_optimizer(accumulator);
+    }
+}
+
+BENCHMARK_CASE(i8x16_add)
+{
+    run_binary_benchmark<VectorIntegerBinaryOp<16, Add>>();
+}
+
+BENCHMARK_CASE(i8x16_add_sat_s)
+{
+    run_binary_benchmark<VectorIntegerBinaryOp<16, SaturatingOp<i8, Add>>>();
+}
+
+BENCHMARK_CASE(i16x8_mul)
+{
+    run_binary_benchmark<VectorIntegerBinaryOp<8, Multiply>>();
+}
+
+BENCHMARK_CASE(i32x4_add)
+{
+    run_binary_benchmark<VectorIntegerBinaryOp<4, Add>>();
+}
+
+BENCHMARK_CASE(i32x4_min_s)
+{
+    run_binary_benchmark<VectorIntegerBinaryOp<4, Minimum>>();
+}
+
+BENCHMARK_CASE(i32x4_eq)
+{
+    run_binary_benchmark<VectorCmpOp<4, Equals>>();
+}
+
+BENCHMARK_CASE(i32x4_dot_i16x8_s)
+{
+    run_binary_benchmark<VectorDotProduct<4>>();
+}
+
+BENCHMARK_CASE(f32x4_add)
+{
+    run_binary_benchmark<VectorFloatBinaryOp<4, Add>>();
+}
+
+BENCHMARK_CASE(f32x4_mul)
+{
+    run_binary_benchmark<VectorFloatBinaryOp<4, Multiply>>();
+}
+
+BENCHMARK_CASE(f32x4_min)
+{
+    run_binary_benchmark<VectorFloatBinaryOp<4, Minimum>>();
+}
+
+BENCHMARK_CASE(f64x2_mul)
+{
+    run_binary_benchmark<VectorFloatBinaryOp<2, Multiply>>();
+}
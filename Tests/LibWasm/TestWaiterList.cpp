@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/Atomic.h>
+#include <LibThreading/Thread.h>
+#include <LibWasm/AbstractMachine/WaiterList.h>
+
+using Wasm::WaiterList;
+
+TEST_CASE(wait_returns_not_equal_on_mismatch)
+{
+    u32 value = 1;
+    auto result = WaiterList::the().wait(&value, sizeof(value), 2, AK::Duration::from_milliseconds(100));
+    EXPECT_EQ(result, WaiterList::WaitResult::NotEqual);
+}
+
+TEST_CASE(wait_times_out)
+{
+    u64 value = 0;
+    auto result = WaiterList::the().wait(&value, sizeof(value), 0, AK::Duration::from_milliseconds(10));
+    EXPECT_EQ(result, WaiterList::WaitResult::TimedOut);
+    EXPECT_EQ(WaiterList::the().notify(&value, 1), 0u);
+}
+
+TEST_CASE(notify_wakes_waiters)
+{
+    static constexpr size_t waiter_count = 2;
+
+    IGNORE_USE_IN_ESCAPING_LAMBDA u32 value = 0;
+    IGNORE_USE_IN_ESCAPING_LAMBDA Atomic<WaiterList::WaitResult> results[waiter_count];
+
+    Vector<NonnullRefPtr<Threading::Thread>> threads;
+    for (size_t i = 0; i < waiter_count; ++i) {
+        threads.append(Threading::Thread::construct([&value, &results, i] {
+            results[i] = WaiterList::the().wait(&value, sizeof(value), 0, {});
+            return 0;
+        }));
+        threads.last()->start();
+    }
+
+    // Keep notifying until every thread has gone to sleep and been woken up.
+    u32 woken_count = 0;
+    while (woken_count < waiter_count)
+        woken_count += WaiterList::the().notify(&value, waiter_count);
+
+    for (auto& thread : threads)
+        (void)thread->join();
+
+    EXPECT_EQ(woken_count, waiter_count);
+    for (auto& result : results)
+        EXPECT_EQ(result.load(), WaiterList::WaitResult::Woken);
+}
@@ -13,6 +13,8 @@
 
 TEST_ROOT("Libraries/LibWasm/Tests");
 
+TESTJS_PROGRAM_FLAG(use_baseline_compiler, "Compile functions to native code where supported", "baseline-compiler", 0);
+
 TESTJS_GLOBAL_FUNCTION(read_binary_wasm_file, readBinaryWasmFile)
 {
     auto& realm = *vm.current_realm();
@@ -47,7 +49,11 @@ public:
     explicit WebAssemblyModule(JS::Object& prototype)
         : JS::Object(ConstructWithPrototypeTag::Tag, prototype)
     {
-        m_machine.enable_instruction_count_limit();
+        // NOTE: Native code doesn't count instructions, so the baseline compiler only runs without the limit.
+        if (use_baseline_compiler)
+            m_machine.enable_baseline_compiler();
+        else
+            m_machine.enable_instruction_count_limit();
     }
 
     static Wasm::AbstractMachine& machine() { return m_machine; }
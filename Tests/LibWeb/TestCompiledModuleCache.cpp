@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025, the Ladybird developers.
+ *
+ * SPDX-License-Identifier: BSD-2-Clause
+ */
+
+#include <LibTest/TestCase.h>
+
+#include <AK/MemoryStream.h>
+#include <LibWasm/AbstractMachine/AbstractMachine.h>
+#include <LibWasm/AbstractMachine/Validator.h>
+#include <LibWeb/WebAssembly/CompiledModuleCache.h>
+
+using Web::WebAssembly::Detail::CompiledModuleCache;
+
+// (module
+//   (memory 1)
+//   (data (i32.const 0) "cached")
+//   (func (export "f") (result i32) (i32.const 42)))
+static constexpr u8 module_bytes[] = {
+    0x00, 0x61, 0x73, 0x6d, 0x01, 0x00, 0x00, 0x00,
+    0x01, 0x05, 0x01, 0x60, 0x00, 0x01, 0x7f,
+    0x03, 0x02, 0x01, 0x00,
+    0x05, 0x03, 0x01, 0x00, 0x01,
+    0x07, 0x05, 0x01, 0x01, 'f', 0x00, 0x00,
+    0x0a, 0x06, 0x01, 0x04, 0x00, 0x41, 0x2a, 0x0b,
+    0x0b, 0x0c, 0x01, 0x00, 0x41, 0x00, 0x0b, 0x06, 'c', 'a', 'c', 'h', 'e', 'd'
+};
+
+static NonnullRefPtr<Wasm::Module> compile_module()
+{
+    FixedMemoryStream stream { ReadonlyBytes { module_bytes, sizeof(module_bytes) } };
+    auto module = MUST(Wasm::Module::parse(stream));
+    Wasm::AbstractMachine machine;
+    MUST(machine.validate(*module));
+    return module;
+}
+
+static CompiledModuleCache::Key key(StringView name, String top_level_site = "https://example.com"_string)
+{
+    return { move(top_level_site), Crypto::Hash::SHA256::hash(name.bytes()) };
+}
+
+TEST_CASE(retained_size_covers_compiled_code)
+{
+    FixedMemoryStream stream { ReadonlyBytes { module_bytes, sizeof(module_bytes) } };
+    auto module = MUST(Wasm::Module::parse(stream));
+    auto parsed_size = module->retained_size();
+    EXPECT(parsed_size > sizeof(module_bytes));
+
+    Wasm::AbstractMachine machine;
+    MUST(machine.validate(*module));
+    EXPECT(module->retained_size() > parsed_size);
+}
+
+TEST_CASE(hits_return_the_same_module)
+{
+    CompiledModuleCache cache;
+    auto module = compile_module();
+
+    EXPECT(!cache.find(key("a"sv)));
+    cache.add(key("a"sv), module);
+    EXPECT_EQ(cache.entry_count(), 1u);
+    EXPECT_EQ(cache.total_retained_size(), module->retained_size());
+
+    EXPECT_EQ(cache.find(key("a"sv)).ptr(), module.ptr());
+    EXPECT(!cache.find(key("b"sv)));
+
+    // Adding the same bytes again replaces the entry instead of counting it twice.
+    cache.add(key("a"sv), module);
+    EXPECT_EQ(cache.entry_count(), 1u);
+    EXPECT_EQ(cache.total_retained_size(), module->retained_size());
+}
+
+TEST_CASE(least_recently_used_modules_are_evicted_first)
+{
+    auto module = compile_module();
+    auto retained_size = module->retained_size();
+    CompiledModuleCache cache { 2 * retained_size };
+
+    cache.add(key("a"sv), module);
+    cache.add(key("b"sv), module);
+    EXPECT_EQ(cache.entry_count(), 2u);
+
+    // Using "a" makes "b" the least recently used entry.
+    EXPECT(cache.find(key("a"sv)));
+    cache.add(key("c"sv), module);
+    EXPECT_EQ(cache.entry_count(), 2u);
+    EXPECT_EQ(cache.total_retained_size(), 2 * retained_size);
+    EXPECT(cache.find(key("a"sv)));
+    EXPECT(!cache.find(key("b"sv)));
+    EXPECT(cache.find(key("c"sv)));
+}
+
+TEST_CASE(modules_larger_than_the_budget_are_not_cached)
+{
+    auto module = compile_module();
+    CompiledModuleCache cache { module->retained_size() - 1 };
+
+    cache.add(key("a"sv), module);
+    EXPECT_EQ(cache.entry_count(), 0u);
+    EXPECT_EQ(cache.total_retained_size(), 0u);
+    EXPECT(!cache.find(key("a"sv)));
+}
+
+TEST_CASE(modules_are_not_shared_between_top_level_sites)
+{
+    CompiledModuleCache cache;
+    auto module = compile_module();
+
+    cache.add(key("a"sv, "https://example.com"_string), module);
+    EXPECT(cache.find(key("a"sv, "https://example.com"_string)));
+    EXPECT(!cache.find(key("a"sv, "https://example.org"_string)));
+
+    cache.add(key("a"sv, "https://example.org"_string), module);
+    EXPECT_EQ(cache.entry_count(), 2u);
+    EXPECT_EQ(cache.total_retained_size(), 2 * module->retained_size());
+}
+
+TEST_CASE(clearing_drops_every_module)
+{
+    CompiledModuleCache cache;
+    auto module = compile_module();
+
+    cache.add(key("a"sv), module);
+    cache.add(key("b"sv), module);
+    cache.clear();
+    EXPECT_EQ(cache.entry_count(), 0u);
+    EXPECT_EQ(cache.total_retained_size(), 0u);
+    EXPECT(!cache.find(key("a"sv)));
+
+    cache.add(key("a"sv), module);
+    EXPECT(cache.find(key("a"sv)));
+}
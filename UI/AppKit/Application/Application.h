@@ -33,6 +33,8 @@ private:
 
     virtual void on_devtools_enabled() const override;
     virtual void on_devtools_disabled() const override;
+
+    dispatch_source_t m_memory_pressure_source { nil };
 };
 
 }
@@ -28,6 +28,12 @@ NonnullOwnPtr<Core::EventLoop> Application::create_platform_event_loop()
     if (!browser_options().headless_mode.has_value()) {
         Core::EventLoopManager::install(*new WebView::EventLoopManagerMacOS);
         [::Application sharedApplication];
+
+        m_memory_pressure_source = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL, dispatch_get_main_queue());
+        dispatch_source_set_event_handler(m_memory_pressure_source, ^{
+            WebView::Application::the().system_memory_pressure();
+        });
+        dispatch_resume(m_memory_pressure_source);
     }
 
     return WebView::Application::create_platform_event_loop();
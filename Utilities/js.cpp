@@ -7,9 +7,11 @@
  * SPDX-License-Identifier: BSD-2-Clause
  */
 
+#include <AK/JsonObject.h>
 #include <AK/JsonValue.h>
 #include <AK/NeverDestroyed.h>
 #include <AK/Platform.h>
+#include <AK/ScopeGuard.h>
 #include <AK/StringBuilder.h>
 #include <LibCore/ArgsParser.h>
 #include <LibCore/ConfigFile.h>
@@ -25,6 +27,7 @@
 #include <LibJS/Runtime/DeclarativeEnvironment.h>
 #include <LibJS/Runtime/GlobalEnvironment.h>
 #include <LibJS/Runtime/JSONObject.h>
+#include <LibJS/Runtime/SamplingProfiler.h>
 #include <LibJS/Runtime/StringPrototype.h>
 #include <LibJS/Runtime/ValueInlines.h>
 #include <LibJS/SourceTextModule.h>
@@ -62,6 +65,7 @@ private:
     JS_DECLARE_NATIVE_FUNCTION(load_json);
     JS_DECLARE_NATIVE_FUNCTION(last_value_getter);
     JS_DECLARE_NATIVE_FUNCTION(print);
+    JS_DECLARE_NATIVE_FUNCTION(heap_snapshot);
 };
 
 class ScriptObject final : public JS::GlobalObject {
@@ -79,6 +83,7 @@ private:
     JS_DECLARE_NATIVE_FUNCTION(load_ini);
     JS_DECLARE_NATIVE_FUNCTION(load_json);
     JS_DECLARE_NATIVE_FUNCTION(print);
+    JS_DECLARE_NATIVE_FUNCTION(heap_snapshot);
 };
 
 static bool s_dump_ast = false;
@@ -295,6 +300,17 @@ static JS::ThrowCompletionOr<JS::Value> load_json_impl(JS::VM& vm)
     return JS::JSONObject::parse_json_value(vm, json.value());
 }
 
+static JS::ThrowCompletionOr<JS::Value> heap_snapshot_impl(JS::VM& vm)
+{
+    auto* allocation_sampler = vm.heap().allocation_sampler();
+    if (!allocation_sampler)
+        return vm.throw_completion<JS::Error>("Allocation sampling is not enabled, run with --sample-allocations"sv);
+
+    // NOTE: Collect first, so the snapshot only contains cells that are actually still alive.
+    vm.heap().collect_garbage();
+    return JS::JSONObject::parse_json_value(vm, allocation_sampler->live_heap_snapshot());
+}
+
 void ReplObject::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
@@ -307,6 +323,7 @@ void ReplObject::initialize(JS::Realm& realm)
     define_native_function(realm, "loadINI"_utf16_fly_string, load_ini, 1, attr);
     define_native_function(realm, "loadJSON"_utf16_fly_string, load_json, 1, attr);
     define_native_function(realm, "print"_utf16_fly_string, print, 1, attr);
+    define_native_function(realm, "heapSnapshot"_utf16_fly_string, heap_snapshot, 0, attr);
 
     define_native_accessor(
         realm,
@@ -353,6 +370,7 @@ JS_DEFINE_NATIVE_FUNCTION(ReplObject::repl_help)
 {
     warnln("REPL commands:");
     warnln("    exit(code): exit the REPL with specified code. Defaults to 0.");
+    warnln("    heapSnapshot(): collect garbage and return the live heap by allocation site (requires --sample-allocations).");
     warnln("    help(): display this menu");
     warnln("    loadINI(file): load the given file as INI.");
     warnln("    loadJSON(file): load the given file as JSON.");
@@ -380,6 +398,11 @@ JS_DEFINE_NATIVE_FUNCTION(ReplObject::print)
     return JS::js_undefined();
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ReplObject::heap_snapshot)
+{
+    return heap_snapshot_impl(vm);
+}
+
 void ScriptObject::initialize(JS::Realm& realm)
 {
     Base::initialize(realm);
@@ -389,6 +412,7 @@ void ScriptObject::initialize(JS::Realm& realm)
     define_native_function(realm, "loadINI"_utf16_fly_string, load_ini, 1, attr);
     define_native_function(realm, "loadJSON"_utf16_fly_string, load_json, 1, attr);
     define_native_function(realm, "print"_utf16_fly_string, print, 1, attr);
+    define_native_function(realm, "heapSnapshot"_utf16_fly_string, heap_snapshot, 0, attr);
 }
 
 JS_DEFINE_NATIVE_FUNCTION(ScriptObject::load_ini)
@@ -410,6 +434,11 @@ JS_DEFINE_NATIVE_FUNCTION(ScriptObject::print)
     return JS::js_undefined();
 }
 
+JS_DEFINE_NATIVE_FUNCTION(ScriptObject::heap_snapshot)
+{
+    return heap_snapshot_impl(vm);
+}
+
 class ReplConsoleClient final : public JS::ConsoleClient {
     GC_CELL(ReplConsoleClient, JS::ConsoleClient);
 
@@ -818,11 +847,25 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool use_test262_global = false;
     StringView evaluate_script;
     Vector<StringView> script_paths;
+    Vector<ByteString> disabled_bytecode_passes;
+    StringView sampling_profile_path;
+    size_t allocation_sampling_interval = 0;
+    bool dump_allocation_samples = false;
+    u32 sampling_interval_in_milliseconds = 1;
 
     Core::ArgsParser args_parser;
     args_parser.set_general_help("This is a JavaScript interpreter.");
     args_parser.add_option(s_dump_ast, "Dump the AST", "dump-ast", 'A');
     args_parser.add_option(JS::Bytecode::g_dump_bytecode, "Dump the bytecode", "dump-bytecode", 'd');
+    args_parser.add_option(JS::Bytecode::g_baseline_tier_enabled, "Compile hot bytecode to native code", "baseline-tier", {});
+    args_parser.add_option(JS::Bytecode::g_baseline_tier_hotness_threshold, "Number of calls and loop iterations before bytecode is compiled", "baseline-tier-threshold", {}, "count");
+    args_parser.add_option(JS::Bytecode::g_dump_property_lookup_cache_statistics, "Dump property lookup cache statistics per executable (needs JS_PROPERTY_LOOKUP_CACHE_DEBUG)", "dump-property-lookup-cache-statistics", {});
+    args_parser.add_option(JS::Bytecode::g_dump_bytecode_optimization_statistics, "Dump instruction counts before and after bytecode optimization", "dump-bytecode-optimization-statistics", {});
+    args_parser.add_option(sampling_profile_path, "Sample the running JavaScript and write a profile to the given path (Chrome .cpuprofile if the path ends in .cpuprofile or .json, collapsed stacks otherwise)", "sampling-profile", {}, "path");
+    args_parser.add_option(sampling_interval_in_milliseconds, "Interval between profiler samples (default: 1ms)", "sampling-interval", {}, "milliseconds");
+    args_parser.add_option(allocation_sampling_interval, "Sample one GC allocation per this many bytes, see heapSnapshot()", "sample-allocations", {}, "bytes");
+    args_parser.add_option(dump_allocation_samples, "Dump the live heap by allocation site after each garbage collection", "dump-allocation-samples", {});
+    args_parser.add_option(disabled_bytecode_passes, "Disable a bytecode optimization pass (jump-threading, redundant-mov-elimination, unreachable-block-elimination)", "disable-bytecode-pass", {}, "passes");
     args_parser.add_option(s_as_module, "Treat as module", "as-module", 'm');
     args_parser.add_option(s_print_last_result, "Print last result", "print-last-result", 'l');
     args_parser.add_option(s_strip_ansi, "Disable ANSI colors", "disable-ansi-colors", 'i');
@@ -836,6 +879,13 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     args_parser.add_positional_argument(script_paths, "Path to script files", "scripts", Core::ArgsParser::Required::No);
     args_parser.parse(arguments);
 
+    for (auto const& pass : disabled_bytecode_passes) {
+        if (!JS::Bytecode::disable_bytecode_optimization_pass(pass)) {
+            warnln("Unknown bytecode optimization pass: {}", pass);
+            return 1;
+        }
+    }
+
     [[maybe_unused]] bool syntax_highlight = !disable_syntax_highlight;
 
     AK::set_debug_enabled(!disable_debug_printing);
@@ -845,6 +895,17 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     g_vm = g_vm_storage->ptr();
     g_vm->set_dynamic_imports_allowed(true);
 
+    // NOTE: The VM is never destroyed, so statistics covering all of its executables have to be printed on the way out.
+    ScopeGuard dump_property_lookup_cache_statistics = [] {
+        if (JS::Bytecode::g_dump_property_lookup_cache_statistics)
+            g_vm->bytecode_interpreter().dump_property_lookup_cache_statistics();
+    };
+
+    if (allocation_sampling_interval != 0 || dump_allocation_samples) {
+        g_vm->start_allocation_sampling(allocation_sampling_interval != 0 ? allocation_sampling_interval : 64 * KiB);
+        g_vm->heap().allocation_sampler()->set_should_dump_after_each_collection(dump_allocation_samples);
+    }
+
     if (!disable_debug_printing) {
         // NOTE: These will print out both warnings when using something like Promise.reject().catch(...) -
         // which is, as far as I can tell, correct - a promise is created, rejected without handler, and a
@@ -917,7 +978,18 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
 
         // We resolve modules as if it is the first file
 
-        if (!TRY(parse_and_run(realm, builder.string_view(), source_name)))
+        if (!sampling_profile_path.is_empty())
+            g_vm->start_sampling_profiler(sampling_interval_in_milliseconds);
+
+        auto did_run_successfully = TRY(parse_and_run(realm, builder.string_view(), source_name));
+
+        if (!sampling_profile_path.is_empty()) {
+            auto profiler = g_vm->stop_sampling_profiler();
+            TRY(profiler->write_to_file(sampling_profile_path));
+            warnln("Wrote {} samples to {}", profiler->sample_count(), sampling_profile_path);
+        }
+
+        if (!did_run_successfully)
             return 1;
     }
 
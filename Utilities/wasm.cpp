@@ -302,6 +302,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     bool print_compiled = false;
     bool attempt_instantiate = false;
     bool export_all_imports = false;
+    bool use_baseline_compiler = false;
     [[maybe_unused]] bool wasi = false;
     Optional<u64> specific_function_address;
     ByteString exported_function_to_execute;
@@ -324,6 +325,7 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     parser.add_option(attempt_instantiate, "Attempt to instantiate the module", "instantiate", 'i');
     parser.add_option(exported_function_to_execute, "Attempt to execute the named exported function from the module (implies -i)", "execute", 'e', "name");
     parser.add_option(export_all_imports, "Export noop functions corresponding to imports", "export-noop");
+    parser.add_option(use_baseline_compiler, "Compile functions to native code where supported", "baseline-compiler");
 #if !defined(AK_OS_WINDOWS)
     parser.add_option(wasi, "Enable WASI", "wasi", 'w');
 #endif
@@ -568,6 +570,9 @@ ErrorOr<int> ladybird_main(Main::Arguments arguments)
     if (!exported_function_to_execute.is_empty())
         attempt_instantiate = true;
 
+    if (use_baseline_compiler)
+        machine.enable_baseline_compiler();
+
     auto parse_result = parse(filename);
     if (parse_result.is_null())
         return 1;